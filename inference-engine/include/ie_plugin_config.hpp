@@ -146,6 +146,104 @@ DECLARE_METRIC_KEY(NUMBER_OF_WAITING_INFER_REQUESTS, unsigned int);
  */
 DECLARE_METRIC_KEY(NUMBER_OF_EXEC_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a float value of average time in milliseconds an infer request waited for a free CPU stream.
+ *
+ * String value is "AVERAGE_QUEUE_WAIT_TIME". This is an executable network metric of networks sharing CPU streams
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AVERAGE_QUEUE_WAIT_TIME, float);
+
+/**
+ * @brief Metric to get a float value of maximal time in milliseconds an infer request waited for a free CPU stream.
+ *
+ * String value is "MAX_QUEUE_WAIT_TIME". This is an executable network metric of networks sharing CPU streams
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MAX_QUEUE_WAIT_TIME, float);
+
+/**
+ * @brief Metric to get an unsigned int value of number of infer requests rejected because the queue limit was reached.
+ *
+ * String value is "NUMBER_OF_REJECTED_INFER_REQUESTS". This is an executable network metric of networks sharing CPU streams
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMBER_OF_REJECTED_INFER_REQUESTS, unsigned int);
+
+/**
+ * @brief Metric to get a float value of average number of infer requests executed together in one batch.
+ *
+ * String value is "BATCH_AVERAGE_SIZE". This is an executable network metric of the BATCH device
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(BATCH_AVERAGE_SIZE, float);
+
+/**
+ * @brief Metric to get an unsigned int value of number of batches executed by the underlying device.
+ *
+ * String value is "NUMBER_OF_BATCHES". This is an executable network metric of the BATCH device
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMBER_OF_BATCHES, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned int value of number of batches started partially filled after the timeout.
+ *
+ * String value is "NUMBER_OF_TIMED_OUT_BATCHES". This is an executable network metric of the BATCH device
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMBER_OF_TIMED_OUT_BATCHES, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned int value of number of times the data of infer requests was copied to or from
+ * a batch because a user set own blobs.
+ *
+ * String value is "NUMBER_OF_COPIED_INFER_REQUESTS". This is an executable network metric of the BATCH device
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMBER_OF_COPIED_INFER_REQUESTS, unsigned int);
+
+/**
+ * @brief Metric to get statistics of the graph memory allocated by a CPU executable network with
+ * PluginConfigParams::KEY_CPU_NUMA_LOCAL_MEMORY or PluginConfigParams::KEY_CPU_HUGE_PAGES set.
+ *
+ * String value is "CPU_MEMORY_STATISTICS". The keys of the map are "ALLOCATIONS", "ALLOCATED_BYTES",
+ * "PEAK_ALLOCATED_BYTES", "HUGE_PAGES_BYTES", "TRANSPARENT_HUGE_PAGES_BYTES" and "NUMA_LOCAL_BYTES"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the activation memory plan of a CPU executable network graph.
+ *
+ * String value is "CPU_MEMORY_PLAN". The keys of the map are "PLANNED_BYTES" (the size of the memory shared by
+ * the activations), "NAIVE_BYTES" (the size required without any reuse) and "LOWER_BOUND_BYTES" (the maximal size
+ * of the activations alive at the same time)
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_MEMORY_PLAN, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the footprint of the activation memory shared by the CPU executable networks loaded with
+ * PluginConfigParams::KEY_CPU_SHARED_WORKSPACE set.
+ *
+ * String value is "CPU_SHARED_WORKSPACE_STATISTICS". The keys of the map are "GRAPHS" (the graphs placed in the
+ * shared memory), "ALLOCATED_BYTES" (the memory of all the streams), "REQUIRED_BYTES" (the memory the graphs
+ * would allocate separately) and "WAITS" (the times a network waited for another one using the memory of the stream)
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHARED_WORKSPACE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get statistics of the inference results cache of a CPU executable network loaded with
+ * PluginConfigParams::KEY_CPU_RESULT_CACHE_SIZE set.
+ *
+ * String value is "CPU_RESULT_CACHE_STATISTICS". The keys of the map are "HITS" and "MISSES" (the inferences
+ * which reused the cached outputs and the ones which did not), "ENTRIES", "BYTES" (the memory of the cached inputs
+ * and outputs) and "EVICTIONS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_RESULT_CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get statistics of the shape-specialized graphs of a CPU executable network loaded with
+ * PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE set.
+ *
+ * String value is "CPU_DYNAMIC_SHAPES_STATISTICS". The keys of the map are "NETWORKS" (the networks transformed for
+ * new input shapes, once for all the streams), "GRAPHS" (the graphs the streams created from them) and "HITS"
+ * (the inferences which reused a graph of the stream)
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_DYNAMIC_SHAPES_STATISTICS, std::map<std::string, uint64_t>);
+
 /**
  * @brief Metric which defines the device architecture.
  */
@@ -268,6 +366,128 @@ DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 
+/**
+ * @brief The key to run all CPU executable networks of the process on one shared set of streams.
+ *
+ * Should be passed to LoadNetwork() with values PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * Networks loaded with the same streams configuration submit their infer requests to the same stream threads
+ * instead of creating their own ones, which avoids oversubscription when many networks are loaded.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS);
+
+/**
+ * @brief The key sets a positive integer share of the shared CPU streams the network gets.
+ *
+ * Networks with the same priority receive streams proportionally to their weights. Default value is 1
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_WEIGHT);
+
+/**
+ * @brief The key sets an integer priority class of the network on the shared CPU streams.
+ *
+ * Waiting infer requests of networks with higher priority are always started first. Default value is 0
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_PRIORITY);
+
+/**
+ * @brief The key limits the number of infer requests of the network waiting for a shared CPU stream.
+ *
+ * Requests started above the limit fail with RequestBusy exception. Default value 0 means no limit
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_QUEUE_LIMIT);
+
+/**
+ * @brief The key to execute independent nodes of a CPU network concurrently.
+ *
+ * Should be passed to LoadNetwork() with values PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * Nodes which do not depend on each other (e.g. branches of Inception-like blocks) run in parallel on the threads
+ * of the stream, which helps networks with many small nodes. Networks with state (Memory layers) run sequentially
+ */
+DECLARE_CONFIG_KEY(CPU_DATAFLOW_EXECUTION);
+
+/**
+ * @brief The key allows CPU infer requests to take inputs of shapes other than the ones the network was loaded with.
+ *
+ * The value is a non-negative number of shape-specialized graphs every CPU stream keeps in the least recently used
+ * cache. Default value 0 disables the feature, so the input blobs have to match the network input shapes.
+ * When enabled, an input blob may have any dimensions of the same rank. The original network is reshaped and
+ * transformed for new input shapes once, on the first inference with them, and the transformed network is kept in
+ * a cache of the same size shared by the streams. Every stream creates its graph from it and reuses the graph while
+ * it stays in the cache. Output blobs are reallocated to the output shapes of the current inference
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE);
+
+/**
+ * @brief The key to place the memory of CPU stream graphs on the NUMA node the stream threads run on.
+ *
+ * Should be passed to LoadNetwork() with values PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * Activations and weights are bound to the node of the stream thread that creates the graph and are touched first
+ * from that thread. It is effective when the threads are pinned (see KEY_CPU_BIND_THREAD). Supported on Linux only
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_LOCAL_MEMORY);
+
+/**
+ * @brief The key to back the memory of CPU stream graphs with huge pages to reduce TLB misses.
+ *
+ * Supported values (Linux only):
+ * - PluginConfigParams::NO (default) uses ordinary pages
+ * - PluginConfigParams::YES uses transparent huge pages
+ * - PluginConfigParams::CPU_HUGE_PAGES_2MB and PluginConfigParams::CPU_HUGE_PAGES_1GB use explicit huge pages
+ *   of the given size reserved in the system. Transparent huge pages are used when no reserved pages are left
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_VALUE(CPU_HUGE_PAGES_2MB);
+DECLARE_CONFIG_VALUE(CPU_HUGE_PAGES_1GB);
+
+/**
+ * @brief The key to select the layouts of CPU graph nodes graph-wide instead of node by node.
+ *
+ * Should be passed to LoadNetwork() with values PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * By default every node chooses its layout from the layouts of its parents, so the consumers preferring another
+ * layout get a Reorder. When enabled, the layouts are reselected to minimize the modelled cost of the reorders
+ * and of the slower implementations in the whole graph. The choices nodes make for in-place memory (Concat, Split)
+ * and the layouts of the inputs, outputs and constants are kept
+ */
+DECLARE_CONFIG_KEY(CPU_GLOBAL_LAYOUT_SELECTION);
+
+/**
+ * @brief The key to set the alignment in bytes of the activations placed in the memory of CPU graphs.
+ *
+ * Should be passed to LoadNetwork() with a power of two not less than 32 (default). For instance "64" aligns
+ * the activations to the cache lines and "4096" to the pages at the cost of the bigger memory footprint
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_ALIGNMENT);
+
+/**
+ * @brief The key to share the activation memory among CPU executable networks.
+ *
+ * Should be passed to LoadNetwork() with an arbitrary name, empty string (default) disables the sharing.
+ * The graphs of the networks loaded with the same name and running on the same streams (see KEY_CPU_SHARED_STREAMS)
+ * place their activations in one buffer per stream, which is as big as the biggest of them.
+ * Inferences of such networks on one stream are serialized. Networks with states keep their own memory
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WORKSPACE);
+
+/**
+ * @brief The key to keep FP16 compressed weights of a CPU network in FP16 instead of converting them to FP32 on loading.
+ *
+ * Should be passed to LoadNetwork() with values PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * FullyConnected (MatMul) weights and big Eltwise constants decompressed by a Convert from FP16 stay in FP16 and
+ * are converted to FP32 by the nodes while they are read, which halves their memory at the cost of the conversion.
+ * Other weights (e.g. of Convolution) and FullyConnected nodes with big batches still use FP32 weights
+ */
+DECLARE_CONFIG_KEY(CPU_KEEP_FP16_WEIGHTS);
+
+/**
+ * @brief The key to reuse the outputs of a CPU network inferred again with the same inputs.
+ *
+ * The value is a non-negative number of megabytes the least recently used cache of the inference results may take.
+ * Default value 0 disables the cache. The infer requests of the network share the cache, which keeps copies of both
+ * the inputs and the outputs, and an inference with the inputs equal to cached ones copies the cached outputs instead
+ * of executing the graph. The cache is disabled for networks with state (ReadValue and Assign operations)
+ */
+DECLARE_CONFIG_KEY(CPU_RESULT_CACHE_SIZE);
+
 /**
  * @brief The name for setting performance counters option.
  *
@@ -381,6 +601,23 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief The key to cache the devices reported by Core::GetAvailableDevices for the given number of seconds.
+ *
+ * It is passed to Core::SetConfig() without a device name. The default value "0" disables the cache, so the plugins
+ * are probed on every call. The cache of a device is dropped when its plugin is unregistered or configured
+ */
+DECLARE_CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL);
+
+/**
+ * @brief The key to load the plugins only for the devices referenced by name.
+ *
+ * It is passed to Core::SetConfig() without a device name with PluginConfigParams::YES or PluginConfigParams::NO
+ * (default). With YES Core::GetAvailableDevices reports only the devices of the plugins which are already loaded
+ * by the calls referencing their device names (e.g. LoadNetwork or GetMetric), the other plugins are not loaded
+ */
+DECLARE_CONFIG_KEY(LAZY_DEVICE_DISCOVERY);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -396,6 +633,25 @@ DECLARE_CONFIG_KEY(CACHE_DIR);
  */
 DECLARE_AUTO_CONFIG_KEY(DEVICE_LIST);
 
+/**
+ * @def BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides a BATCH-mangled name for configuration key with name `name`
+ */
+#define BATCH_CONFIG_KEY(name) InferenceEngine::_CONFIG_KEY(BATCH_##name)
+
+#define DECLARE_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(BATCH_##name)
+
+/**
+ * @brief The device executing batches with the batch size in brackets, e.g. "CPU(8)"
+ */
+DECLARE_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief Time in milliseconds to wait for a batch to be filled before the collected requests are executed without the batch.
+ * The default value is "10". A request is not delayed if the batch can not be filled, e.g. it is the only request created
+ */
+DECLARE_BATCH_CONFIG_KEY(TIMEOUT);
+
 }  // namespace InferenceEngine
 
 #include "hetero/hetero_plugin_config.hpp"
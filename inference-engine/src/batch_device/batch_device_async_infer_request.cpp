@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <memory>
+#include <utility>
+
+#include "batch_device_async_infer_request.hpp"
+
+namespace BatchDevicePlugin {
+    using namespace InferenceEngine;
+
+BatchDeviceAsyncInferRequest::BatchDeviceAsyncInferRequest(
+    const BatchDeviceInferRequest::Ptr&         inferRequest,
+    const BatchDeviceExecutableNetwork::Ptr&    batchDeviceExecutableNetwork,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _batchDeviceExecutableNetwork{batchDeviceExecutableNetwork},
+    _inferRequest{inferRequest} {
+    // this executor puts the request to the batch while the task (checking the result) is executed
+    // once the batch (or the request alone, if the batch was not filled in time) is inferred
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(BatchDeviceAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_batchDeviceExecutableNetwork->ScheduleToWorkerInferRequest(_this->_inferRequest.get(), std::move(task));
+        };
+        BatchDeviceAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+              if (nullptr != _inferRequest->_exceptionPtr) {
+                  std::rethrow_exception(_inferRequest->_exceptionPtr);
+              }
+        }}
+    };
+}
+
+void BatchDeviceAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+BatchDeviceAsyncInferRequest::~BatchDeviceAsyncInferRequest() {
+    StopAndWait();
+    _batchDeviceExecutableNetwork->ReleaseInferRequest(_inferRequest.get());
+}
+
+}  // namespace BatchDevicePlugin
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>
+
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include "batch_device_infer_request.hpp"
+#include "batch_device_exec_network.hpp"
+
+namespace BatchDevicePlugin {
+
+class BatchDeviceAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<BatchDeviceAsyncInferRequest>;
+
+    explicit BatchDeviceAsyncInferRequest(const BatchDeviceInferRequest::Ptr&           inferRequest,
+                                          const BatchDeviceExecutableNetwork::Ptr&      batchDeviceExecutableNetwork,
+                                          const InferenceEngine::ITaskExecutor::Ptr&    callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    ~BatchDeviceAsyncInferRequest();
+
+protected:
+    BatchDeviceExecutableNetwork::Ptr                                   _batchDeviceExecutableNetwork;
+    BatchDeviceInferRequest::Ptr                                        _inferRequest;
+};
+
+}  // namespace BatchDevicePlugin
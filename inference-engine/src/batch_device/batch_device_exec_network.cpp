@@ -0,0 +1,324 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <map>
+#include <unordered_map>
+
+#include "ie_metric_helpers.hpp"
+#include <ie_plugin_config.hpp>
+#include "batch_device_exec_network.hpp"
+#include "batch_device_async_infer_request.hpp"
+
+// ------------------------------BatchDeviceExecutableNetwork----------------------------
+namespace BatchDevicePlugin {
+    using namespace InferenceEngine;
+
+BatchDeviceExecutableNetwork::BatchDeviceExecutableNetwork(const SoExecutableNetworkInternal&                  networkWithBatch,
+                                                           const SoExecutableNetworkInternal&                  networkWithoutBatch,
+                                                           const DeviceInformation&                            networkDevice,
+                                                           const std::unordered_map<std::string, Parameter>&   config,
+                                                           const bool                                          needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _networkWithBatch{networkWithBatch},
+    _networkWithoutBatch{networkWithoutBatch},
+    _device{networkDevice},
+    _batchSize{static_cast<std::size_t>(networkDevice.batchSize)},
+    _timeout{std::stoi(config.at(BATCH_CONFIG_KEY(TIMEOUT)).as<std::string>())},
+    _config{config},
+    _needPerfCounters{needPerfCounters} {
+    _taskExecutor.reset();
+    _timeoutThread = std::thread{&BatchDeviceExecutableNetwork::TimeoutLoop, this};
+}
+
+BatchDeviceExecutableNetwork::~BatchDeviceExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _terminate = true;
+    }
+    _timeoutCondVar.notify_all();
+    _timeoutThread.join();
+    /* NOTE: All user requests hold the executable network, so no batch can be collected or executed at this point
+     */
+    _workerRequests.clear();
+}
+
+BatchDeviceExecutableNetwork::WorkerInferRequest& BatchDeviceExecutableNetwork::GetWorkerInferRequest(const std::size_t workerId) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    while (_workerRequests.size() <= workerId) {
+        _workerRequests.emplace_back();
+        auto& workerRequest = _workerRequests.back();
+        workerRequest._inferRequest = { _networkWithBatch, _networkWithBatch->CreateInferRequest() };
+        auto* workerRequestPtr = &workerRequest;
+        workerRequest._inferRequest->SetCallback([workerRequestPtr, this] (std::exception_ptr exceptionPtr) {
+            std::map<std::string, InferenceEngineProfileInfo> perfMap;
+            if (nullptr == exceptionPtr && _needPerfCounters) {
+                perfMap = workerRequestPtr->_inferRequest->GetPerformanceCounts();
+            }
+            // no other batch can be started on the worker until all the requests of this one are submitted again
+            auto executing = std::move(workerRequestPtr->_executing);
+            workerRequestPtr->_executing.clear();
+            for (auto&& batchedTask : executing) {
+                Complete(batchedTask.first, exceptionPtr, perfMap);
+            }
+            for (auto&& batchedTask : executing) {
+                auto capturedTask = std::move(batchedTask.second);
+                capturedTask();
+            }
+        });
+    }
+    return _workerRequests[workerId];
+}
+
+void BatchDeviceExecutableNetwork::ScheduleToWorkerInferRequest(BatchDeviceInferRequest* request, Task task) {
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        workerRequestPtr = &_workerRequests.at(request->_workerId);
+        if (workerRequestPtr->_numRequests < _batchSize) {
+            // the batch can not be filled, so the request is not delayed by the timeout
+            lock.unlock();
+            StartWithoutBatch({request, std::move(task)});
+            return;
+        }
+        auto& batch = workerRequestPtr->_batch;
+        batch.emplace_back(request, std::move(task));
+        if (batch.size() < _batchSize) {
+            if (1 == batch.size()) {
+                workerRequestPtr->_deadline = Clock::now() + _timeout;
+                _timeoutCondVar.notify_one();
+            }
+            return;
+        }
+        // every request of the worker has been submitted, the batch is full
+        workerRequestPtr->_executing = std::move(batch);
+        batch.clear();
+    }
+    StartBatch(*workerRequestPtr);
+}
+
+void BatchDeviceExecutableNetwork::ReleaseInferRequest(BatchDeviceInferRequest* request) {
+    std::vector<BatchedTask> batch;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto& workerRequest = _workerRequests.at(request->_workerId);
+        workerRequest._numRequests--;
+        // the requests collected so far can not be batched anymore
+        batch = std::move(workerRequest._batch);
+        workerRequest._batch.clear();
+    }
+    for (auto&& batchedTask : batch) {
+        StartWithoutBatch(std::move(batchedTask));
+    }
+}
+
+void BatchDeviceExecutableNetwork::StartBatch(WorkerInferRequest& worker) {
+    _numBatches++;
+    try {
+        for (auto&& batchedTask : worker._executing) {
+            if (batchedTask.first->SetBlobsToBatch()) {
+                _numCopiedRequests++;
+            }
+        }
+        worker._inferRequest->StartAsync();
+    } catch (...) {
+        auto executing = std::move(worker._executing);
+        worker._executing.clear();
+        for (auto&& batchedTask : executing) {
+            Complete(batchedTask.first, std::current_exception(), {});
+            auto capturedTask = std::move(batchedTask.second);
+            capturedTask();
+        }
+    }
+}
+
+void BatchDeviceExecutableNetwork::StartWithoutBatch(BatchedTask batchedTask) {
+    _numRequestsWithoutBatch++;
+    auto request = batchedTask.first;
+    auto task = std::make_shared<Task>(std::move(batchedTask.second));
+    auto& inferRequest = request->_requestWithoutBatch;
+    try {
+        if (!inferRequest) {
+            // the blobs of the request slot are shared, so the outputs of the other requests in the batch are intact
+            inferRequest = { _networkWithoutBatch, _networkWithoutBatch->CreateInferRequest() };
+            request->SetBlobsToAnotherRequest(inferRequest);
+        }
+        if (request->SetBlobsToBatch()) {
+            _numCopiedRequests++;
+        }
+        inferRequest->SetCallback([this, request, task] (std::exception_ptr exceptionPtr) {
+            std::map<std::string, InferenceEngineProfileInfo> perfMap;
+            if (nullptr == exceptionPtr && _needPerfCounters) {
+                perfMap = request->_requestWithoutBatch->GetPerformanceCounts();
+            }
+            Complete(request, exceptionPtr, perfMap);
+            auto capturedTask = std::move(*task);
+            capturedTask();
+        });
+        inferRequest->StartAsync();
+    } catch (...) {
+        Complete(request, std::current_exception(), {});
+        auto capturedTask = std::move(*task);
+        capturedTask();
+    }
+}
+
+void BatchDeviceExecutableNetwork::Complete(BatchDeviceInferRequest* request, std::exception_ptr exceptionPtr,
+                                            const std::map<std::string, InferenceEngineProfileInfo>& perfMap) {
+    request->_exceptionPtr = exceptionPtr;
+    if (nullptr != exceptionPtr) {
+        return;
+    }
+    try {
+        if (request->GetBlobsFromBatch()) {
+            _numCopiedRequests++;
+        }
+    } catch (...) {
+        request->_exceptionPtr = std::current_exception();
+    }
+    if (_needPerfCounters) {
+        request->_perfMap = perfMap;
+    }
+}
+
+void BatchDeviceExecutableNetwork::TimeoutLoop() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    while (!_terminate) {
+        WorkerInferRequest* expiredWorkerRequestPtr = nullptr;
+        for (auto&& workerRequest : _workerRequests) {
+            if (!workerRequest._batch.empty() && (nullptr == expiredWorkerRequestPtr ||
+                workerRequest._deadline < expiredWorkerRequestPtr->_deadline)) {
+                expiredWorkerRequestPtr = &workerRequest;
+            }
+        }
+        if (nullptr == expiredWorkerRequestPtr) {
+            _timeoutCondVar.wait(lock);
+        } else if (Clock::now() < expiredWorkerRequestPtr->_deadline) {
+            _timeoutCondVar.wait_until(lock, expiredWorkerRequestPtr->_deadline);
+        } else {
+            // the batch was not filled in time, so the collected requests are executed one by one without the batch
+            auto batch = std::move(expiredWorkerRequestPtr->_batch);
+            expiredWorkerRequestPtr->_batch.clear();
+            _numTimedOutBatches++;
+            lock.unlock();
+            for (auto&& batchedTask : batch) {
+                StartWithoutBatch(std::move(batchedTask));
+            }
+            lock.lock();
+        }
+    }
+}
+
+InferenceEngine::IInferRequestInternal::Ptr BatchDeviceExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                                InferenceEngine::OutputsDataMap networkOutputs) {
+    // every batchSize consecutive user requests own the slots of one worker request,
+    // so the user requests read inputs from and write outputs to the batched blobs directly
+    const auto num = _numRequestsCreated++;
+    const auto workerId = num / _batchSize;
+    auto& workerRequest = GetWorkerInferRequest(workerId);
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        workerRequest._numRequests++;
+    }
+    return std::make_shared<BatchDeviceInferRequest>(networkInputs, networkOutputs, workerRequest._inferRequest,
+                                                     workerId, num % _batchSize, _batchSize);
+}
+
+IInferRequestInternal::Ptr BatchDeviceExecutableNetwork::CreateInferRequest() {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<BatchDeviceAsyncInferRequest>(std::static_pointer_cast<BatchDeviceInferRequest>(syncRequestImpl),
+                                                          std::static_pointer_cast<BatchDeviceExecutableNetwork>(shared_from_this()),
+                                                          _callbackExecutor);
+}
+
+RemoteContext::Ptr BatchDeviceExecutableNetwork::GetContext() const {
+    return _networkWithBatch->GetContext();
+}
+
+void BatchDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    auto timeout = config.find(BATCH_CONFIG_KEY(TIMEOUT));
+    if (timeout == config.end() || config.size() > 1) {
+        IE_THROW() << "The only config supported for the Network's SetConfig is BATCH_TIMEOUT";
+    }
+    const auto value = timeout->second.as<std::string>();
+    int timeoutMs = -1;
+    try {
+        timeoutMs = std::stoi(value);
+    } catch (...) {
+    }
+    if (timeoutMs < 0) {
+        IE_THROW() << "Wrong value for property key " << BATCH_CONFIG_KEY(TIMEOUT) << ". Expected non-negative number of milliseconds";
+    }
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _timeout = std::chrono::milliseconds{timeoutMs};
+        _config[BATCH_CONFIG_KEY(TIMEOUT)] = value;
+    }
+}
+
+InferenceEngine::Parameter BatchDeviceExecutableNetwork::GetConfig(const std::string &name) const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        IE_THROW(NotFound) << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter BatchDeviceExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 1u;
+        try {
+            res = _networkWithBatch->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception &iie) {
+            IE_THROW()
+                    << "The device used with the BATCH device should "
+                    << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                    << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every device request executes batchSize user requests
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(std::max(1u, res) * _batchSize));
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithBatch->GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(BATCH_AVERAGE_SIZE)) {
+        const std::size_t withoutBatch = _numRequestsWithoutBatch;
+        const std::size_t batches = _numBatches;
+        const std::size_t inferences = batches + withoutBatch;
+        IE_SET_METRIC_RETURN(BATCH_AVERAGE_SIZE, 0 == inferences ? 0.f :
+            static_cast<float>(batches * _batchSize + withoutBatch) / inferences);
+    } else if (name == METRIC_KEY(NUMBER_OF_BATCHES)) {
+        IE_SET_METRIC_RETURN(NUMBER_OF_BATCHES, static_cast<unsigned int>(_numBatches));
+    } else if (name == METRIC_KEY(NUMBER_OF_TIMED_OUT_BATCHES)) {
+        IE_SET_METRIC_RETURN(NUMBER_OF_TIMED_OUT_BATCHES, static_cast<unsigned int>(_numTimedOutBatches));
+    } else if (name == METRIC_KEY(NUMBER_OF_COPIED_INFER_REQUESTS)) {
+        IE_SET_METRIC_RETURN(NUMBER_OF_COPIED_INFER_REQUESTS, static_cast<unsigned int>(_numCopiedRequests));
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(BATCH_AVERAGE_SIZE),
+            METRIC_KEY(NUMBER_OF_BATCHES),
+            METRIC_KEY(NUMBER_OF_TIMED_OUT_BATCHES),
+            METRIC_KEY(NUMBER_OF_COPIED_INFER_REQUESTS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { BATCH_CONFIG_KEY(DEVICE), BATCH_CONFIG_KEY(TIMEOUT) };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+
+}  // namespace BatchDevicePlugin
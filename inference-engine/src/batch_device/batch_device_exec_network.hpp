@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <threading/ie_itask_executor.hpp>
+#include "batch_device_infer_request.hpp"
+
+namespace BatchDevicePlugin {
+
+struct DeviceInformation {
+    std::string                         deviceName;
+    std::map<std::string, std::string>  config;
+    int                                 batchSize;
+};
+
+class BatchDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<BatchDeviceExecutableNetwork>;
+    using Clock = std::chrono::steady_clock;
+    using BatchedTask = std::pair<BatchDeviceInferRequest*, InferenceEngine::Task>;
+    struct WorkerInferRequest {
+        InferenceEngine::SoIInferRequestInternal  _inferRequest;
+        // user requests collected to the next batch with the tasks to continue their pipelines
+        std::vector<BatchedTask>                  _batch;
+        // user requests of the batch being executed
+        std::vector<BatchedTask>                  _executing;
+        Clock::time_point                         _deadline;
+        // user requests owning the slots, the batch can be filled only when all batchSize of them exist
+        std::size_t                               _numRequests = 0;
+    };
+
+    explicit BatchDeviceExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&                 networkWithBatch,
+                                          const InferenceEngine::SoExecutableNetworkInternal&                 networkWithoutBatch,
+                                          const DeviceInformation&                                            networkDevice,
+                                          const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                          const bool                                                          needPerfCounters = false);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+    InferenceEngine::RemoteContext::Ptr GetContext() const override;
+    ~BatchDeviceExecutableNetwork();
+
+    void ScheduleToWorkerInferRequest(BatchDeviceInferRequest* request, InferenceEngine::Task task);
+    void ReleaseInferRequest(BatchDeviceInferRequest* request);
+
+protected:
+    WorkerInferRequest& GetWorkerInferRequest(const std::size_t workerId);
+    void StartBatch(WorkerInferRequest& worker);
+    void StartWithoutBatch(BatchedTask batchedTask);
+    void Complete(BatchDeviceInferRequest* request, std::exception_ptr exceptionPtr,
+                  const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap);
+    void TimeoutLoop();
+
+    mutable std::mutex                                          _mutex;
+    std::condition_variable                                     _timeoutCondVar;
+    bool                                                        _terminate = false;
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithBatch;
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithoutBatch;
+    const DeviceInformation                                     _device;
+    const std::size_t                                           _batchSize;
+    std::chrono::milliseconds                                   _timeout;
+    // worker requests are created on demand, one per every batchSize user requests. The deque keeps references valid
+    std::deque<WorkerInferRequest>                              _workerRequests;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _needPerfCounters = false;
+    std::atomic_size_t                                          _numRequestsCreated = {0};
+    std::atomic_size_t                                          _numBatches = {0};
+    std::atomic_size_t                                          _numTimedOutBatches = {0};
+    std::atomic_size_t                                          _numRequestsWithoutBatch = {0};
+    std::atomic_size_t                                          _numCopiedRequests = {0};
+    std::thread                                                 _timeoutThread;
+};
+
+}  // namespace BatchDevicePlugin
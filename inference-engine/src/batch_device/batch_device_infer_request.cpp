@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "batch_device_infer_request.hpp"
+#include <ie_input_info.hpp>
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+
+namespace BatchDevicePlugin {
+
+using namespace InferenceEngine;
+
+namespace {
+// Creates a blob pointing to the slot-th part of the batched blob along the outermost (batch) dimension
+Blob::Ptr CreateSlotBlob(const Blob::Ptr& batchedBlob, const std::size_t slot, const std::size_t batchSize) {
+    auto memoryBlob = as<MemoryBlob>(batchedBlob);
+    if (nullptr == memoryBlob) {
+        IE_THROW(NotImplemented) << "BATCH device supports only memory blobs of the underlying device requests";
+    }
+    const auto& desc = batchedBlob->getTensorDesc();
+    auto blockDims = desc.getBlockingDesc().getBlockDims();
+    const auto& order = desc.getBlockingDesc().getOrder();
+    if (desc.getDims().empty() || order.empty() || 0 != order[0] || 0 != blockDims[0] % batchSize) {
+        IE_THROW() << "BATCH device requires the batch to be the outermost dimension of every network input and output";
+    }
+    auto dims = desc.getDims();
+    dims[0] /= batchSize;
+    blockDims[0] /= batchSize;
+    const auto slotDesc = Layout::BLOCKED == desc.getLayout()
+        ? TensorDesc{desc.getPrecision(), dims, BlockingDesc{blockDims, order}}
+        : TensorDesc{desc.getPrecision(), dims, desc.getLayout()};
+    auto data = memoryBlob->wmap().as<std::uint8_t*>() + slot * (memoryBlob->byteSize() / batchSize);
+    return make_blob_with_precision(slotDesc, data);
+}
+}  // namespace
+
+// ------------------------------BatchDeviceInferRequest----------------------------
+BatchDeviceInferRequest::BatchDeviceInferRequest(const InputsDataMap&           networkInputs,
+                                                 const OutputsDataMap&          networkOutputs,
+                                                 const SoIInferRequestInternal& batchedRequest,
+                                                 const std::size_t              workerId,
+                                                 const std::size_t              slot,
+                                                 const std::size_t              batchSize)
+        : IInferRequestInternal(networkInputs, networkOutputs),
+          _workerId{workerId},
+          _slot{slot},
+          _batchedRequest{batchedRequest} {
+    // the request owns a slot in the batch, so by default the data is read and written there without copies
+    for (const auto& it : _networkInputs) {
+        auto blob = CreateSlotBlob(_batchedRequest->GetBlob(it.first), slot, batchSize);
+        _slotInputs[it.first] = blob;
+        _inputs[it.first] = blob;
+        _deviceInputs[it.first] = blob;
+    }
+    for (const auto& it : _networkOutputs) {
+        auto blob = CreateSlotBlob(_batchedRequest->GetBlob(it.first), slot, batchSize);
+        _slotOutputs[it.first] = blob;
+        _outputs[it.first] = blob;
+    }
+}
+
+bool BatchDeviceInferRequest::SetBlobsToBatch() {
+    // this request is already in BUSY state, so using the internal functions safely
+    // pre-processing (if any) writes directly to the slot in the batch
+    execDataPreprocessing(_deviceInputs);
+    bool copied = false;
+    for (const auto& it : _slotInputs) {
+        const auto& blob = _deviceInputs[it.first];
+        if (blob != it.second) {
+            blob_copy(blob, it.second);
+            copied = true;
+        }
+    }
+    return copied;
+}
+
+bool BatchDeviceInferRequest::GetBlobsFromBatch() {
+    bool copied = false;
+    for (const auto& it : _slotOutputs) {
+        const auto& blob = _outputs[it.first];
+        if (blob != it.second) {
+            blob_copy(it.second, blob);
+            copied = true;
+        }
+    }
+    return copied;
+}
+
+void BatchDeviceInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInternal& req) {
+    for (const auto& it : _slotInputs)
+        req->SetBlob(it.first, it.second);
+    for (const auto& it : _slotOutputs)
+        req->SetBlob(it.first, it.second);
+}
+
+std::map<std::string, InferenceEngineProfileInfo> BatchDeviceInferRequest::GetPerformanceCounts() const {
+    return _perfMap;
+}
+
+void BatchDeviceInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+}  // namespace BatchDevicePlugin
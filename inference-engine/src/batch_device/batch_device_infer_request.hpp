@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+
+namespace BatchDevicePlugin {
+
+class BatchDeviceInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<BatchDeviceInferRequest>;
+    explicit BatchDeviceInferRequest(const InferenceEngine::InputsDataMap&          networkInputs,
+                                     const InferenceEngine::OutputsDataMap&         networkOutputs,
+                                     const InferenceEngine::SoIInferRequestInternal& batchedRequest,
+                                     const std::size_t                               workerId,
+                                     const std::size_t                               slot,
+                                     const std::size_t                               batchSize);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+
+    // Batch-Device impl specific: moves the data between the user blobs and the request slot in the batch.
+    // Both return true if the user has set own blobs, so the data had to be copied
+    bool SetBlobsToBatch();
+    bool GetBlobsFromBatch();
+    // Batch-Device impl specific: sets the blobs of the request slot to the request of the network without the batch
+    void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+
+    const std::size_t                                                   _workerId;
+    const std::size_t                                                   _slot;
+    std::exception_ptr                                                  _exceptionPtr = nullptr;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    // executes the request alone when the batch was not filled in time, created on demand
+    InferenceEngine::SoIInferRequestInternal                            _requestWithoutBatch;
+
+protected:
+    // keeps the batched blobs alive as the blobs of this request point into them
+    InferenceEngine::SoIInferRequestInternal                            _batchedRequest;
+    InferenceEngine::BlobMap                                            _slotInputs;
+    InferenceEngine::BlobMap                                            _slotOutputs;
+};
+
+}  // namespace BatchDevicePlugin
@@ -0,0 +1,219 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <ie_icore.hpp>
+#include "batch_device_plugin.hpp"
+
+// ------------------------------BatchDeviceInferencePlugin----------------------------
+namespace BatchDevicePlugin {
+    using namespace InferenceEngine;
+namespace {
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+    std::vector<std::string> supported_configKeys = {BATCH_CONFIG_KEY(DEVICE), BATCH_CONFIG_KEY(TIMEOUT)};
+
+    void CheckTimeout(const std::string& value) {
+        int timeout = -1;
+        try {
+            timeout = std::stoi(value);
+        } catch (...) {
+        }
+        if (timeout < 0) {
+            IE_THROW() << "Wrong value " << value << " for property key " << BATCH_CONFIG_KEY(TIMEOUT)
+                       << ". Expected non-negative number of milliseconds";
+        }
+    }
+}  // namespace
+
+std::map<std::string, std::string> BatchDeviceInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation BatchDeviceInferencePlugin::ParseMetaDevice(const std::string& deviceBatch,
+                                                              const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceBatch.find_first_of('(');
+    auto closingBracket = deviceBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceBatch.substr(0, openingBracket);
+    if (closingBracket == std::string::npos || openingBracket >= closingBracket) {
+        IE_THROW() << "Batch size for '" << deviceName << "' must be set in brackets, e.g. " << deviceName << "(8)";
+    }
+    int batchSize = 0;
+    try {
+        batchSize = std::stoi(deviceBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+    } catch (...) {
+    }
+    if (batchSize <= 0) {
+        IE_THROW() << "Batch size for '" << deviceName << "' must be > 0, while " << batchSize << " is passed";
+    }
+
+    DeviceIDParser deviceParser(deviceName);
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceParser.getDeviceName()), batchSize };
+}
+
+InferenceEngine::Parameter BatchDeviceInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            IE_THROW() << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        IE_THROW() << "Unsupported config key: " << name;
+    }
+}
+
+void BatchDeviceInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        const auto& name = kvp.first;
+        if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), name))
+            IE_THROW() << "Unsupported config key: " << name;
+        if (name == BATCH_CONFIG_KEY(TIMEOUT))
+            CheckTimeout(kvp.second);
+        _config[name] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "BatchDevicePlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(BatchDeviceInferencePlugin, version)
+
+BatchDeviceInferencePlugin::BatchDeviceInferencePlugin() {
+    _pluginName = "BATCH";
+    _config[BATCH_CONFIG_KEY(TIMEOUT)] = "10";
+}
+
+InferenceEngine::Parameter BatchDeviceInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr BatchDeviceInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                               const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with BATCH device via InferenceEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(BATCH_CONFIG_KEY(DEVICE));
+    if (device == fullConfig.end()) {
+        IE_THROW() << "BATCH_DEVICE key is not set for BATCH device";
+    }
+    const auto& timeout = fullConfig.at(BATCH_CONFIG_KEY(TIMEOUT));
+    CheckTimeout(timeout);
+
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+    const auto batchSize = static_cast<std::size_t>(metaDevice.batchSize);
+
+    // the batch is the outermost dimension of every input, the copy of the network is reshaped to fit batchSize requests
+    auto networkWithBatch = InferenceEngine::details::cloneNetwork(network);
+    auto shapes = networkWithBatch.getInputShapes();
+    for (auto&& shape : shapes) {
+        if (shape.second.empty()) {
+            IE_THROW() << "BATCH device requires every network input to have the batch dimension, while "
+                       << shape.first << " is a scalar";
+        }
+        shape.second[0] *= batchSize;
+    }
+    networkWithBatch.reshape(shapes);
+    const auto outputs = network.getOutputsInfo();
+    for (auto&& output : networkWithBatch.getOutputsInfo()) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        const auto& originalDims = outputs.at(output.first)->getTensorDesc().getDims();
+        if (dims.empty() || dims[0] != originalDims[0] * batchSize) {
+            IE_THROW() << "BATCH device requires every network output to have the batch dimension, while "
+                       << output.first << " does not depend on the batch";
+        }
+    }
+
+    // the network without the batch executes the requests which were not batched in time
+    auto execNetworkWithBatch = GetCore()->LoadNetwork(networkWithBatch, metaDevice.deviceName, metaDevice.config);
+    auto execNetworkWithoutBatch = GetCore()->LoadNetwork(network, metaDevice.deviceName, metaDevice.config);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> batchNetworkConfig;
+    batchNetworkConfig.insert(metaDevice.config.begin(), metaDevice.config.end());
+    batchNetworkConfig[BATCH_CONFIG_KEY(DEVICE)] = device->second;
+    batchNetworkConfig[BATCH_CONFIG_KEY(TIMEOUT)] = timeout;
+
+    bool enablePerfCounters = false;
+    try {
+        enablePerfCounters =
+            execNetworkWithBatch->GetConfig(PluginConfigParams::KEY_PERF_COUNT).as<std::string>() == PluginConfigParams::YES;
+    } catch (...) {
+    }
+    return std::make_shared<BatchDeviceExecutableNetwork>(execNetworkWithBatch,
+                                                          execNetworkWithoutBatch,
+                                                          metaDevice,
+                                                          batchNetworkConfig,
+                                                          enablePerfCounters);
+}
+
+QueryNetworkResult BatchDeviceInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                            const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(BATCH_CONFIG_KEY(DEVICE));
+    if (device == fullConfig.end()) {
+        IE_THROW() << "BATCH_DEVICE key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+    auto queryResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layerQr : queryResult.supportedLayersMap) {
+        layerQr.second = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace BatchDevicePlugin
@@ -4,20 +4,25 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+#ifdef HAVE_SSE
+// Hand-vectorized 3-channel split/merge kernels. Return false when the copy is not covered by them.
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
+static bool blob_copy_4d_sse42_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
     auto* src_ptr = src->buffer().as<data_t*>();
@@ -49,107 +54,43 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
 
     dst_ptr += dst_blk_desc.getOffsetPadding();
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
+    if (src_l == NHWC && dst_l == NCHW && C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
             blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
                                      N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
                                      static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+            return true;
         }
     }
 
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
+    if (src_l == NCHW && dst_l == NHWC && C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
             blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
                                      N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
                                      static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+            return true;
         }
     }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
-
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
-    }
-}
-
-static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
-    switch (src->getTensorDesc().getPrecision()) {
-    case Precision::FP32:
-    case Precision::I32:
-    case Precision::U32:
-        blob_copy_4d_t<Precision::FP32>(src, dst);
-        break;
-
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_4d_t<Precision::U16>(src, dst);
-        break;
-
-    case Precision::U8:
-    case Precision::I8:
-        blob_copy_4d_t<Precision::U8>(src, dst);
-        break;
 
-    default:
-        IE_THROW() << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
-    }
+    return false;
 }
 
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
+static bool blob_copy_5d_sse42_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
     const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
@@ -182,15 +123,13 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
     const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
+    if (src_l == NDHWC && dst_l == NCDHW && C == 3 && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -198,18 +137,17 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
                                      C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
 
-    if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
+    if (src_l == NCDHW && dst_l == NDHWC && C == 3 && C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1) {
         if (PRC == Precision::U8) {
             blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -217,77 +155,248 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
                                      H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
-#else
-    (void)H_dst_stride;
+
+    return false;
+}
+
+static bool blob_copy_sse42(Blob::Ptr src, Blob::Ptr dst) {
+    if (!with_cpu_x86_sse42())
+        return false;
+
+    const auto rank = src->getTensorDesc().getDims().size();
+    switch (src->getTensorDesc().getPrecision()) {
+    case Precision::FP32:
+        return rank == 4 ? blob_copy_4d_sse42_t<Precision::FP32>(src, dst)
+             : rank == 5 ? blob_copy_5d_sse42_t<Precision::FP32>(src, dst) : false;
+    case Precision::U8:
+        return rank == 4 ? blob_copy_4d_sse42_t<Precision::U8>(src, dst)
+             : rank == 5 ? blob_copy_5d_sse42_t<Precision::U8>(src, dst) : false;
+    default:
+        return false;
+    }
+}
 #endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
+
+//----------------------------------------------------------------------
+//
+// Generic strided copy: any rank, any permutation of dimensions, any ROI.
+//
+//----------------------------------------------------------------------
+
+namespace {
+
+// Copy problem in element units. Dimensions are ordered by the destination memory layout,
+// so the last one is the innermost dimension of the destination.
+struct StridedCopy {
+    SizeVector dims;
+    SizeVector src_strides;
+    SizeVector dst_strides;
+    size_t src_offset = 0;
+    size_t dst_offset = 0;
+};
+
+// Strides of a plain (non-blocked) descriptor indexed by logical dimension.
+bool getLogicalStrides(const TensorDesc& desc, SizeVector& strides) {
+    const auto& blk = desc.getBlockingDesc();
+    const auto& order = blk.getOrder();
+    if (order.size() != desc.getDims().size())
+        return false;
+
+    strides.resize(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        strides[order[i]] = blk.getStrides()[i];
+    return true;
+}
+
+StridedCopy makeStridedCopy(const TensorDesc& srcDesc, const TensorDesc& dstDesc) {
+    StridedCopy copy;
+    copy.src_offset = srcDesc.getBlockingDesc().getOffsetPadding();
+    copy.dst_offset = dstDesc.getBlockingDesc().getOffsetPadding();
+
+    SizeVector dims, src_strides, dst_strides;
+    SizeVector src_logical, dst_logical;
+    const auto& dst_blk = dstDesc.getBlockingDesc();
+    const auto& src_blk = srcDesc.getBlockingDesc();
+    if (getLogicalStrides(srcDesc, src_logical) && getLogicalStrides(dstDesc, dst_logical)) {
+        for (auto d : dst_blk.getOrder()) {
+            dims.push_back(srcDesc.getDims()[d]);
+            src_strides.push_back(src_logical[d]);
+            dst_strides.push_back(dst_logical[d]);
         }
+    } else if (src_blk.getBlockDims() == dst_blk.getBlockDims() && src_blk.getOrder() == dst_blk.getOrder()) {
+        // Identically blocked descriptors differ only in strides and offsets
+        dims = dst_blk.getBlockDims();
+        src_strides = src_blk.getStrides();
+        dst_strides = dst_blk.getStrides();
     } else {
-        for (size_t i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
+        IE_THROW() << "Unimplemented blob transformation from layout " << srcDesc.getLayout() << " to "
+                   << dstDesc.getLayout();
+    }
+
+    // Drop unit dimensions and merge neighbours that are contiguous in both blobs
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] == 1)
+            continue;
+        if (!copy.dims.empty() && copy.src_strides.back() == src_strides[i] * dims[i] &&
+            copy.dst_strides.back() == dst_strides[i] * dims[i]) {
+            copy.dims.back() *= dims[i];
+            copy.src_strides.back() = src_strides[i];
+            copy.dst_strides.back() = dst_strides[i];
+            continue;
         }
+        copy.dims.push_back(dims[i]);
+        copy.src_strides.push_back(src_strides[i]);
+        copy.dst_strides.push_back(dst_strides[i]);
+    }
+
+    if (copy.dims.empty()) {
+        copy.dims = {1};
+        copy.src_strides = {1};
+        copy.dst_strides = {1};
     }
+    return copy;
 }
 
-static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
-    switch (src->getTensorDesc().getPrecision()) {
-    case Precision::FP32:
-    case Precision::I32:
-    case Precision::U32:
-        blob_copy_5d_t<Precision::FP32>(src, dst);
-        break;
+template <typename data_t>
+class StridedCopyExecutor {
+public:
+    explicit StridedCopyExecutor(const StridedCopy& copy): copy(copy) {
+        const size_t rank = copy.dims.size();
+        inner = rank - 1;
+
+        // Pick the source-contiguous dimension for a tiled transpose against the destination innermost one
+        transposed = rank;
+        if (copy.dst_strides[inner] == 1 && copy.src_strides[inner] != 1) {
+            for (size_t i = 0; i < inner; i++) {
+                if (copy.src_strides[i] == 1)
+                    transposed = i;
+            }
+        }
 
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_5d_t<Precision::U16>(src, dst);
-        break;
+        for (size_t i = 0; i < inner; i++) {
+            if (i != transposed)
+                outer.push_back(i);
+        }
+    }
 
-    case Precision::U8:
-    case Precision::I8:
-        blob_copy_5d_t<Precision::U8>(src, dst);
-        break;
+    void operator()(const data_t* src, data_t* dst) const {
+        size_t work_amount = 1;
+        for (auto d : outer)
+            work_amount *= copy.dims[d];
+
+        size_t total = work_amount * copy.dims[inner];
+        if (transposed != copy.dims.size())
+            total *= copy.dims[transposed];
+
+        // Threading overhead dominates for small blobs
+        const size_t parallel_threshold = 1 << 16;
+        const int nthr = total * sizeof(data_t) < parallel_threshold ? 1 : parallel_get_max_threads();
+        if (nthr == 1) {
+            run(src, dst, 0, work_amount);
+        } else {
+            parallel_nt(nthr, [&](const int ithr, const int team) {
+                size_t start = 0, end = 0;
+                splitter(work_amount, team, ithr, start, end);
+                run(src, dst, start, end);
+            });
+        }
+    }
 
-    default:
-        IE_THROW() << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
+private:
+    void run(const data_t* src, data_t* dst, size_t start, size_t end) const {
+        if (start >= end)
+            return;
+
+        // Unravel the first work item, then advance the outer coordinates incrementally
+        SizeVector idx(outer.size());
+        size_t src_off = copy.src_offset, dst_off = copy.dst_offset;
+        for (size_t i = outer.size(), rem = start; i-- > 0;) {
+            const size_t d = outer[i];
+            idx[i] = rem % copy.dims[d];
+            rem /= copy.dims[d];
+            src_off += idx[i] * copy.src_strides[d];
+            dst_off += idx[i] * copy.dst_strides[d];
+        }
+
+        for (size_t iwork = start; iwork < end; iwork++) {
+            if (transposed != copy.dims.size())
+                copy_transposed(src + src_off, dst + dst_off);
+            else
+                copy_row(src + src_off, dst + dst_off);
+
+            for (size_t i = outer.size(); i-- > 0;) {
+                const size_t d = outer[i];
+                src_off += copy.src_strides[d];
+                dst_off += copy.dst_strides[d];
+                if (++idx[i] < copy.dims[d])
+                    break;
+                src_off -= idx[i] * copy.src_strides[d];
+                dst_off -= idx[i] * copy.dst_strides[d];
+                idx[i] = 0;
+            }
+        }
+    }
+
+    void copy_row(const data_t* src, data_t* dst) const {
+        const size_t len = copy.dims[inner];
+        const size_t src_stride = copy.src_strides[inner];
+        const size_t dst_stride = copy.dst_strides[inner];
+        if (src_stride == 1 && dst_stride == 1) {
+            std::memcpy(dst, src, len * sizeof(data_t));
+        } else if (dst_stride == 1) {
+            for (size_t i = 0; i < len; i++)
+                dst[i] = src[i * src_stride];
+        } else if (src_stride == 1) {
+            for (size_t i = 0; i < len; i++)
+                dst[i * dst_stride] = src[i];
+        } else {
+            for (size_t i = 0; i < len; i++)
+                dst[i * dst_stride] = src[i * src_stride];
+        }
+    }
+
+    // dst[a * dst_stride + b] = src[a + b * src_stride], walked in square tiles so that
+    // both the source and the destination lines stay in cache.
+    void copy_transposed(const data_t* src, data_t* dst) const {
+        const size_t A = copy.dims[transposed];
+        const size_t B = copy.dims[inner];
+        const size_t src_stride = copy.src_strides[inner];
+        const size_t dst_stride = copy.dst_strides[transposed];
+        // One cache line of elements per tile side
+        const size_t tile = sizeof(data_t) > 8 ? 8 : 64 / sizeof(data_t);
+
+        for (size_t a0 = 0; a0 < A; a0 += tile) {
+            const size_t a1 = std::min(a0 + tile, A);
+            for (size_t b0 = 0; b0 < B; b0 += tile) {
+                const size_t b1 = std::min(b0 + tile, B);
+                for (size_t a = a0; a < a1; a++) {
+                    const data_t* src_l = src + a;
+                    data_t* dst_l = dst + a * dst_stride;
+                    for (size_t b = b0; b < b1; b++)
+                        dst_l[b] = src_l[b * src_stride];
+                }
+            }
+        }
     }
+
+    const StridedCopy& copy;
+    size_t inner = 0;
+    size_t transposed = 0;
+    SizeVector outer;
+};
+
+template <typename data_t>
+void blob_copy_strided_t(Blob::Ptr src, Blob::Ptr dst) {
+    const auto copy = makeStridedCopy(src->getTensorDesc(), dst->getTensorDesc());
+    const StridedCopyExecutor<data_t> executor(copy);
+    executor(src->buffer().as<const data_t*>(), dst->buffer().as<data_t*>());
 }
 
+}  // namespace
+
 void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->buffer() == nullptr) IE_THROW() << "Cannot copy blob data. Source is not allocated.";
 
@@ -300,12 +409,29 @@ void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
         IE_THROW() << "Unimplemented blob transformation from different shapes ";
 
-    if (src->getTensorDesc().getDims().size() == 4)
-        blob_copy_4d(src, dst);
-    else if (src->getTensorDesc().getDims().size() == 5)
-        blob_copy_5d(src, dst);
-    else
-        IE_THROW() << "Unimplemented blob transformation. Only 4d or 5d supported.";
+#ifdef HAVE_SSE
+    if (blob_copy_sse42(src, dst))
+        return;
+#endif  // HAVE_SSE
+
+    // The copy only moves elements, so precisions of the same size share one kernel
+    const auto precision = src->getTensorDesc().getPrecision();
+    switch (precision == Precision::BIN ? 0 : precision.size()) {
+    case 1:
+        blob_copy_strided_t<uint8_t>(src, dst);
+        break;
+    case 2:
+        blob_copy_strided_t<uint16_t>(src, dst);
+        break;
+    case 4:
+        blob_copy_strided_t<uint32_t>(src, dst);
+        break;
+    case 8:
+        blob_copy_strided_t<uint64_t>(src, dst);
+        break;
+    default:
+        IE_THROW() << "Unsupported blob transformation for precision " << precision;
+    }
 }
 
 }  // namespace InferenceEngine
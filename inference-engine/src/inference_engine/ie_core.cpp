@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -51,6 +54,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::KEY_BATCH_DEVICE] = deviceName.substr(6);
     } else if (deviceName_.find("AUTO") == 0) {
         deviceName_ = "AUTO";
         if (deviceName.size() > std::string("AUTO").size()) {
@@ -196,6 +202,42 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL));
+            if (it != config.end()) {
+                int ttl = -1;
+                try {
+                    ttl = std::stoi(it->second);
+                } catch (const std::exception&) {
+                }
+                if (ttl < 0) {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL)
+                               << ". Expected non negative number of seconds";
+                }
+                _availableDevicesCacheTtl = ttl;
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(LAZY_DEVICE_DISCOVERY));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _lazyDeviceDiscovery = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _lazyDeviceDiscovery = false;
+                } else {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(LAZY_DEVICE_DISCOVERY)
+                               << ". Expected only YES/NO";
+                }
+                config.erase(it);
+            }
+        }
+
+        std::chrono::seconds getAvailableDevicesCacheTtl() const {
+            return std::chrono::seconds(_availableDevicesCacheTtl.load());
+        }
+
+        bool isLazyDeviceDiscovery() const {
+            return _lazyDeviceDiscovery;
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -207,6 +249,8 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<int> _availableDevicesCacheTtl {0};
+        std::atomic<bool> _lazyDeviceDiscovery {false};
     };
 
     // Core settings (cache config, etc)
@@ -225,6 +269,15 @@ class Core::Impl : public ICore, public std::enable_shared_from_this<ICore> {
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
+    // plugins of different devices are created in parallel, each plugin is created once
+    mutable std::map<std::string, std::shared_ptr<std::mutex>> pluginCreationMutexes;
+
+    // results of the AVAILABLE_DEVICES metric of the devices, are protected by pluginsMutex
+    struct AvailableDevicesCacheEntry {
+        std::vector<std::string> devicesIDs;
+        std::chrono::steady_clock::time_point time;
+    };
+    mutable std::map<std::string, AvailableDevicesCacheEntry> availableDevicesCache;
 
     bool DeviceSupportsImportExport(const std::string& deviceName) const override {
         auto parsed = parseDeviceNameIntoConfig(deviceName);
@@ -616,6 +669,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                IE_THROW()
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
         // we need to return a copy of Parameter object which is created on Core side,
@@ -634,27 +696,82 @@ public:
         std::vector<std::string> devices;
         const std::string propertyName = METRIC_KEY(AVAILABLE_DEVICES);
 
-        for (auto&& deviceName : GetListOfDevicesInRegistry()) {
-            std::vector<std::string> devicesIDs;
+        const auto deviceNames = GetListOfDevicesInRegistry();
+        const auto cacheTtl = coreConfig.getAvailableDevicesCacheTtl();
+        const bool lazyDiscovery = coreConfig.isLazyDeviceDiscovery();
+        const auto now = std::chrono::steady_clock::now();
+
+        std::vector<std::vector<std::string>> devicesIDs(deviceNames.size());
+        std::vector<size_t> devicesToProbe;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            for (size_t i = 0; i < deviceNames.size(); ++i) {
+                // the plugins which are not referenced by a device name yet are not loaded
+                if (lazyDiscovery && plugins.find(deviceNames[i]) == plugins.end()) {
+                    continue;
+                }
+                auto cached = availableDevicesCache.find(deviceNames[i]);
+                if (cached != availableDevicesCache.end() && now - cached->second.time < cacheTtl) {
+                    devicesIDs[i] = cached->second.devicesIDs;
+                    continue;
+                }
+                devicesToProbe.push_back(i);
+            }
+        }
+
+        // the plugins are loaded and the devices are probed in parallel
+        std::vector<std::exception_ptr> exceptions(deviceNames.size());
+        auto probeDevice = [&](size_t i) {
             try {
-                const Parameter p = GetMetric(deviceName, propertyName);
-                devicesIDs = p.as<std::vector<std::string>>();
+                const Parameter p = GetMetric(deviceNames[i], propertyName);
+                devicesIDs[i] = p.as<std::vector<std::string>>();
             } catch (Exception&) {
                 // plugin is not created by e.g. invalid env
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        };
+        if (devicesToProbe.size() == 1) {
+            probeDevice(devicesToProbe.front());
+        } else {
+            std::vector<std::future<void>> probes;
+            for (auto i : devicesToProbe) {
+                probes.push_back(std::async(std::launch::async, probeDevice, i));
+            }
+            for (auto&& probe : probes) {
+                probe.wait();
+            }
+        }
+
+        for (auto i : devicesToProbe) {
+            if (!exceptions[i]) {
+                continue;
+            }
+            try {
+                std::rethrow_exception(exceptions[i]);
             } catch (const std::exception& ex) {
-                IE_THROW() << "An exception is thrown while trying to create the " << deviceName
+                IE_THROW() << "An exception is thrown while trying to create the " << deviceNames[i]
                                 << " device and call GetMetric: " << ex.what();
             } catch (...) {
-                IE_THROW() << "Unknown exception is thrown while trying to create the " << deviceName
+                IE_THROW() << "Unknown exception is thrown while trying to create the " << deviceNames[i]
                                 << " device and call GetMetric";
             }
+        }
+
+        if (cacheTtl.count() > 0) {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            for (auto i : devicesToProbe) {
+                availableDevicesCache[deviceNames[i]] = {devicesIDs[i], now};
+            }
+        }
 
-            if (devicesIDs.size() > 1) {
-                for (auto&& deviceID : devicesIDs) {
-                    devices.push_back(deviceName + '.' + deviceID);
+        for (size_t i = 0; i < deviceNames.size(); ++i) {
+            if (devicesIDs[i].size() > 1) {
+                for (auto&& deviceID : devicesIDs[i]) {
+                    devices.push_back(deviceNames[i] + '.' + deviceID);
                 }
-            } else if (!devicesIDs.empty()) {
-                devices.push_back(deviceName);
+            } else if (!devicesIDs[i].empty()) {
+                devices.push_back(deviceNames[i]);
             }
         }
 
@@ -669,66 +786,104 @@ public:
     InferencePlugin GetCPPPluginByName(const std::string& deviceName) const {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "Core::Impl::GetCPPPluginByName");
 
-        std::lock_guard<std::mutex> lock(pluginsMutex);
+        std::shared_ptr<std::mutex> creationMutex;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
 
-        auto it = pluginRegistry.find(deviceName);
-        if (it == pluginRegistry.end()) {
-            IE_THROW() << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            if (pluginRegistry.find(deviceName) == pluginRegistry.end()) {
+                IE_THROW() << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
+
+            auto plugin = plugins.find(deviceName);
+            if (plugin != plugins.end()) {
+                return plugin->second;
+            }
+
+            auto& mutex = pluginCreationMutexes[deviceName];
+            if (!mutex) {
+                mutex = std::make_shared<std::mutex>();
+            }
+            creationMutex = mutex;
         }
 
-        // Plugin is in registry, but not created, let's create
+        // Plugin is in registry, but not created, let's create.
+        // The library is loaded without pluginsMutex, so the plugins of other devices are created meanwhile
+        std::lock_guard<std::mutex> creationLock(*creationMutex);
 
-        if (plugins.find(deviceName) == plugins.end()) {
-            PluginDescriptor desc = it->second;
+        PluginDescriptor desc;
+        std::vector<IExtensionPtr> pluginExtensions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto plugin = plugins.find(deviceName);
+            if (plugin != plugins.end()) {
+                return plugin->second;
+            }
+            desc = pluginRegistry.at(deviceName);
+            pluginExtensions = extensions;
+        }
+        const auto registeredConfig = desc.defaultConfig;
 
-            try {
-                InferencePlugin plugin{desc.libraryLocation};
+        try {
+            InferencePlugin plugin{desc.libraryLocation};
 
-                {
-                    plugin.SetName(deviceName);
+            {
+                plugin.SetName(deviceName);
+
+                // Set Inference Engine class reference to plugins
+                std::weak_ptr<InferenceEngine::ICore> mutableCore = std::const_pointer_cast<InferenceEngine::ICore>(
+                        shared_from_this());
+                plugin.SetCore(mutableCore);
+            }
 
-                    // Set Inference Engine class reference to plugins
-                    std::weak_ptr<InferenceEngine::ICore> mutableCore = std::const_pointer_cast<InferenceEngine::ICore>(
-                            shared_from_this());
-                    plugin.SetCore(mutableCore);
+            // Add registered extensions to new plugin
+            allowNotImplemented([&](){
+                for (const auto& ext : pluginExtensions) {
+                    plugin.AddExtension(ext);
                 }
+            });
 
-                // Add registered extensions to new plugin
-                allowNotImplemented([&](){
-                    for (const auto& ext : extensions) {
-                        plugin.AddExtension(ext);
+            // configuring
+            {
+                if (DeviceSupportsCacheDir(plugin)) {
+                    auto cacheConfig = coreConfig.getCacheConfig();
+                    if (cacheConfig._cacheManager) {
+                        desc.defaultConfig[CONFIG_KEY(CACHE_DIR)] = cacheConfig._cacheDir;
                     }
+                }
+                allowNotImplemented([&]() {
+                    plugin.SetConfig(desc.defaultConfig);
                 });
 
-                // configuring
-                {
-                    if (DeviceSupportsCacheDir(plugin)) {
-                        auto cacheConfig = coreConfig.getCacheConfig();
-                        if (cacheConfig._cacheManager) {
-                            desc.defaultConfig[CONFIG_KEY(CACHE_DIR)] = cacheConfig._cacheDir;
-                        }
+                allowNotImplemented([&]() {
+                    for (auto&& extensionLocation : desc.listOfExtentions) {
+                        plugin.AddExtension(std::make_shared<Extension>(extensionLocation));
                     }
-                    allowNotImplemented([&]() {
-                        plugin.SetConfig(desc.defaultConfig);
-                    });
+                });
+            }
 
-                    allowNotImplemented([&]() {
-                        for (auto&& extensionLocation : desc.listOfExtentions) {
-                            plugin.AddExtension(std::make_shared<Extension>(extensionLocation));
-                        }
-                    });
-                }
+            std::lock_guard<std::mutex> lock(pluginsMutex);
 
-                plugins[deviceName] = plugin;
-            } catch (const Exception& ex) {
-                IE_THROW() << "Failed to create plugin " << FileUtils::fromFilePath(desc.libraryLocation) << " for device " << deviceName
-                                   << "\n"
-                                   << "Please, check your environment\n"
-                                   << ex.what() << "\n";
+            // the extensions and the config could be added to the core while the plugin was created
+            for (size_t i = pluginExtensions.size(); i < extensions.size(); ++i) {
+                try {
+                    plugin.AddExtension(extensions[i]);
+                } catch (...) {}
+            }
+            const auto& currentConfig = pluginRegistry.at(deviceName).defaultConfig;
+            if (currentConfig != registeredConfig) {
+                allowNotImplemented([&]() {
+                    plugin.SetConfig(currentConfig);
+                });
             }
-        }
 
-        return plugins[deviceName];
+            plugins[deviceName] = plugin;
+            return plugin;
+        } catch (const Exception& ex) {
+            IE_THROW() << "Failed to create plugin " << FileUtils::fromFilePath(desc.libraryLocation) << " for device " << deviceName
+                               << "\n"
+                               << "Please, check your environment\n"
+                               << ex.what() << "\n";
+        }
     }
 
     /**
@@ -743,6 +898,7 @@ public:
         }
 
         plugins.erase(deviceName);
+        availableDevicesCache.erase(deviceName);
     }
 
     /**
@@ -820,6 +976,13 @@ public:
             IE_THROW() << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
         }
 
+        // the devices may be reported differently with the new config
+        if (deviceName.empty()) {
+            availableDevicesCache.clear();
+        } else {
+            availableDevicesCache.erase(deviceName);
+        }
+
         // set config for already created plugins
         for (auto& plugin : plugins) {
             if (deviceName.empty() || deviceName == plugin.first) {
@@ -900,6 +1063,12 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("MULTI");
+        } else if (deviceName.find("BATCH") == 0) {
+            auto pos = deviceName.find_first_of(":");
+            if (pos != std::string::npos) {
+                deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
+            }
+            deviceNames.push_back("BATCH");
         } else if (deviceName.find("AUTO") == 0) {
             auto pos = deviceName.find_first_of(":");
             if (pos != std::string::npos) {
@@ -1082,6 +1251,12 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
                                 "You can configure the devices with SetConfig before creating the MULTI on top.";
     }
 
+    // BATCH case
+    if (deviceName.find("BATCH:") == 0) {
+        IE_THROW() << "SetConfig is supported only for BATCH itself (without devices). "
+                               "You can configure the devices with SetConfig before creating the BATCH on top.";
+    }
+
     // AUTO case
     if (deviceName.find("AUTO:") == 0) {
         IE_THROW() << "SetConfig is supported only for AUTO itself (without devices). "
@@ -1119,6 +1294,14 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
                    "GetConfig is also possible for the individual devices before creating the MULTI on top.";
         }
     }
+    // BATCH case
+    {
+        if (deviceName.find("BATCH:") == 0) {
+            IE_THROW()
+                << "You can only GetConfig of the BATCH itself (without devices). "
+                   "GetConfig is also possible for the individual devices before creating the BATCH on top.";
+        }
+    }
     // AUTO case
     {
         if (deviceName.find("AUTO:") == 0) {
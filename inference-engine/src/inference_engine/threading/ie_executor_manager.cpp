@@ -5,6 +5,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "threading/ie_executor_manager.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
@@ -22,22 +23,27 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+static bool isSameStreamsConfig(const IStreamsExecutor::Config& executorConfig, const IStreamsExecutor::Config& config) {
+    if (executorConfig._name == config._name &&
+        executorConfig._streams == config._streams &&
+        executorConfig._threadsPerStream == config._threadsPerStream &&
+        executorConfig._threadBindingType == config._threadBindingType &&
+        executorConfig._threadBindingStep == config._threadBindingStep &&
+        executorConfig._threadBindingOffset == config._threadBindingOffset)
+        return executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE
+               || executorConfig._threadPreferredCoreType == config._threadPreferredCoreType;
+    return false;
+}
+
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    destroyRetiredExecutors();
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
         const auto& executor = it.second;
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name &&
-            executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
-            if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE
-                 || executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
+        if (isSameStreamsConfig(it.first, config))
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -45,6 +51,32 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+SharedStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    destroyRetiredExecutors();
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    for (const auto& executor : sharedCpuStreamsExecutors) {
+        if (isSameStreamsConfig(executor->GetConfig(), config))
+            return executor;
+    }
+    auto newExec = std::make_shared<SharedStreamsExecutor>(config);
+    sharedCpuStreamsExecutors.push_back(newExec);
+    return newExec;
+}
+
+void ExecutorManagerImpl::retireCPUStreamsExecutor(IStreamsExecutor::Ptr executor) {
+    std::lock_guard<std::mutex> guard(retiredExecutorMutex);
+    retiredCpuStreamsExecutors.push_back(std::move(executor));
+}
+
+// The streams are joined outside of the lock, as their last tasks may still be finishing
+void ExecutorManagerImpl::destroyRetiredExecutors() {
+    std::vector<IStreamsExecutor::Ptr> retired;
+    {
+        std::lock_guard<std::mutex> guard(retiredExecutorMutex);
+        std::swap(retired, retiredCpuStreamsExecutors);
+    }
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -55,12 +87,25 @@ size_t ExecutorManagerImpl::getIdleCPUStreamsExecutorsNumber() {
     return cpuStreamsExecutors.size();
 }
 
+// for tests purposes
+size_t ExecutorManagerImpl::getSharedCPUStreamsExecutorsNumber() {
+    return sharedCpuStreamsExecutors.size();
+}
+
+// for tests purposes
+size_t ExecutorManagerImpl::getRetiredCPUStreamsExecutorsNumber() {
+    std::lock_guard<std::mutex> guard(retiredExecutorMutex);
+    return retiredCpuStreamsExecutors.size();
+}
+
 void ExecutorManagerImpl::clear(const std::string& id) {
+    destroyRetiredExecutors();
     std::lock_guard<std::mutex> stream_guard(streamExecutorMutex);
     std::lock_guard<std::mutex> task_guard(taskExecutorMutex);
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedCpuStreamsExecutors.clear();
     } else {
         executors.erase(id);
         cpuStreamsExecutors.erase(
@@ -69,6 +114,12 @@ void ExecutorManagerImpl::clear(const std::string& id) {
                               return it.first._name == id;
                            }),
             cpuStreamsExecutors.end());
+        sharedCpuStreamsExecutors.erase(
+            std::remove_if(sharedCpuStreamsExecutors.begin(), sharedCpuStreamsExecutors.end(),
+                           [&](const SharedStreamsExecutor::Ptr& executor) {
+                              return executor->GetConfig()._name == id;
+                           }),
+            sharedCpuStreamsExecutors.end());
     }
 }
 
@@ -125,6 +176,14 @@ size_t ExecutorManager::getIdleCPUStreamsExecutorsNumber() {
     return _impl.getIdleCPUStreamsExecutorsNumber();
 }
 
+size_t ExecutorManager::getSharedCPUStreamsExecutorsNumber() {
+    return _impl.getSharedCPUStreamsExecutorsNumber();
+}
+
+size_t ExecutorManager::getRetiredCPUStreamsExecutorsNumber() {
+    return _impl.getRetiredCPUStreamsExecutorsNumber();
+}
+
 void ExecutorManager::clear(const std::string& id) {
     _impl.clear(id);
 }
@@ -133,4 +192,12 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+SharedStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
+void ExecutorManager::retireCPUStreamsExecutor(IStreamsExecutor::Ptr executor) {
+    _impl.retireCPUStreamsExecutor(std::move(executor));
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,262 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "threading/ie_cpu_streams_executor.hpp"
+#include "threading/ie_executor_manager.hpp"
+#include "threading/ie_shared_streams_executor.hpp"
+
+namespace InferenceEngine {
+
+using Clock = std::chrono::steady_clock;
+
+struct SharedStreamsExecutor::ClientState {
+    explicit ClientState(const ClientConfig& config) : _config{config} {
+        if (0 == _config._weight) {
+            IE_THROW() << "Weight of the shared streams client " << _config._name << " must be positive";
+        }
+    }
+
+    ClientConfig                                _config;
+    std::queue<std::pair<Task, Clock::time_point>> _tasks;
+    ClientStatistics                            _statistics;
+    double                                      _totalWaitMs = 0;
+    // Weighted amount of service received so far, the smallest one is served first
+    double                                      _virtualTime = 0;
+    bool                                        _released = false;
+};
+
+// Started tasks hold the implementation, so it outlives all the clients until the last task is completed
+struct SharedStreamsExecutor::Impl : public std::enable_shared_from_this<SharedStreamsExecutor::Impl> {
+    explicit Impl(const IStreamsExecutor::Config& config) :
+        _config{config},
+        _capacity{std::max(1, config._streams)},
+        _executor{std::make_shared<CPUStreamsExecutor>(config)} {
+    }
+
+    ~Impl() {
+        if (this == _running) {
+            // The last reference is released by a task in a stream thread that can not join itself,
+            // so the streams are stopped by the executor manager from another thread
+            ExecutorManager::getInstance()->retireCPUStreamsExecutor(std::move(_executor));
+        }
+    }
+
+    // Marks the thread that runs a task of the implementation
+    struct Running {
+        explicit Running(const Impl* impl) : _previous{_running} {
+            _running = impl;
+        }
+        ~Running() {
+            _running = _previous;
+        }
+        const Impl* _previous;
+    };
+
+    // Synchronous callers wait for their tasks anyway, so only the asynchronous ones are limited by the queue size
+    void Enqueue(const std::shared_ptr<ClientState>& state, Task task, bool limited) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            const auto maxQueueSize = state->_config._maxQueueSize;
+            if (limited && 0 != maxQueueSize && state->_tasks.size() >= maxQueueSize) {
+                state->_statistics._rejected++;
+                IE_THROW(RequestBusy) << "Shared streams queue of " << state->_config._name
+                                      << " is full: " << maxQueueSize << " tasks are waiting";
+            }
+            // A client that was idle does not accumulate credit for the time it did not use streams
+            if (state->_tasks.empty()) {
+                state->_virtualTime = std::max(state->_virtualTime, _virtualTime);
+            }
+            state->_tasks.emplace(std::move(task), Clock::now());
+        }
+        Dispatch();
+    }
+
+    // Waits for the tasks of the client like the destructor of a streams executor. A task on the streams can not
+    // wait for the others as they may need its stream, so the client is removed after its last task instead.
+    void Release(const std::shared_ptr<ClientState>& state) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        state->_released = true;
+        if (this != _running) {
+            _completed.wait(lock, [&] { return state->_tasks.empty() && 0 == state->_statistics._executing; });
+        }
+        RemoveIfDone(state);
+    }
+
+    // Moves waiting tasks to the free streams. Tasks are submitted outside of the lock as the underlying
+    // executor may run them in the calling thread.
+    void Dispatch() {
+        std::vector<Task> ready;
+        auto self = shared_from_this();
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            while (_executing < _capacity) {
+                auto state = Select();
+                if (nullptr == state) {
+                    break;
+                }
+                auto task = std::move(state->_tasks.front().first);
+                const auto waitMs = std::chrono::duration<double, std::milli>(
+                    Clock::now() - state->_tasks.front().second).count();
+                state->_tasks.pop();
+
+                auto& statistics = state->_statistics;
+                statistics._executing++;
+                state->_totalWaitMs += waitMs;
+                statistics._maxWaitMs = std::max(statistics._maxWaitMs, waitMs);
+                _virtualTime = state->_virtualTime;
+                state->_virtualTime += 1.0 / state->_config._weight;
+                _executing++;
+
+                ready.emplace_back([self, state, task] () mutable {
+                    // The reference is moved out of the task, so it is released while the thread is marked.
+                    // The client task is destroyed before, so nothing runs in the thread after the streams are retired.
+                    Running running{self.get()};
+                    auto impl = std::move(self);
+                    try {
+                        task();
+                    } catch (...) {
+                        task = {};
+                        impl->Complete(state);
+                        throw;
+                    }
+                    task = {};
+                    impl->Complete(state);
+                });
+            }
+        }
+        for (auto&& task : ready) {
+            _executor->run(std::move(task));
+        }
+    }
+
+    void Complete(const std::shared_ptr<ClientState>& state) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _executing--;
+            auto& statistics = state->_statistics;
+            statistics._executing--;
+            statistics._executed++;
+            RemoveIfDone(state);
+        }
+        _completed.notify_all();
+        Dispatch();
+    }
+
+    // The highest priority first, then the client with the least weighted service
+    std::shared_ptr<ClientState> Select() const {
+        std::shared_ptr<ClientState> selected;
+        for (auto&& state : _clients) {
+            if (state->_tasks.empty()) {
+                continue;
+            }
+            if (nullptr == selected ||
+                state->_config._priority > selected->_config._priority ||
+                (state->_config._priority == selected->_config._priority &&
+                 state->_virtualTime < selected->_virtualTime)) {
+                selected = state;
+            }
+        }
+        return selected;
+    }
+
+    void RemoveIfDone(const std::shared_ptr<ClientState>& state) {
+        if (state->_released && state->_tasks.empty() && 0 == state->_statistics._executing) {
+            _clients.erase(std::remove(_clients.begin(), _clients.end(), state), _clients.end());
+        }
+    }
+
+    ClientStatistics GetStatistics(const ClientState& state) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto statistics = state._statistics;
+        statistics._waiting = state._tasks.size();
+        const auto started = statistics._executed + statistics._executing;
+        statistics._averageWaitMs = 0 == started ? 0 : state._totalWaitMs / started;
+        return statistics;
+    }
+
+    IStreamsExecutor::Config                    _config;
+    const int                                   _capacity;
+    std::mutex                                  _mutex;
+    std::condition_variable                     _completed;
+    std::vector<std::shared_ptr<ClientState>>   _clients;
+    int                                         _executing = 0;
+    double                                      _virtualTime = 0;
+    std::shared_ptr<CPUStreamsExecutor>         _executor;
+    static thread_local const Impl*             _running;
+};
+
+thread_local const SharedStreamsExecutor::Impl* SharedStreamsExecutor::Impl::_running = nullptr;
+
+SharedStreamsExecutor::Client::Client(const std::shared_ptr<Impl>& impl, const ClientConfig& config) :
+    _impl{impl},
+    _state{std::make_shared<ClientState>(config)} {
+    std::lock_guard<std::mutex> lock{_impl->_mutex};
+    _impl->_clients.push_back(_state);
+}
+
+SharedStreamsExecutor::Client::~Client() {
+    _impl->Release(_state);
+}
+
+void SharedStreamsExecutor::Client::run(Task task) {
+    _impl->Enqueue(_state, std::move(task), true);
+}
+
+void SharedStreamsExecutor::Client::runAndWait(const std::vector<Task>& tasks) {
+    std::vector<std::packaged_task<void()>> packagedTasks;
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        packagedTasks.emplace_back([&tasks, i] {tasks[i]();});
+        futures.emplace_back(packagedTasks.back().get_future());
+    }
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        _impl->Enqueue(_state, [&packagedTasks, i] {packagedTasks[i]();}, false);
+    }
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    for (auto&& future : futures) {
+        future.get();
+    }
+}
+
+void SharedStreamsExecutor::Client::Execute(Task task) {
+    _impl->_executor->Execute(std::move(task));
+}
+
+int SharedStreamsExecutor::Client::GetStreamId() {
+    return _impl->_executor->GetStreamId();
+}
+
+int SharedStreamsExecutor::Client::GetNumaNodeId() {
+    return _impl->_executor->GetNumaNodeId();
+}
+
+SharedStreamsExecutor::ClientStatistics SharedStreamsExecutor::Client::GetStatistics() const {
+    return _impl->GetStatistics(*_state);
+}
+
+SharedStreamsExecutor::SharedStreamsExecutor(const IStreamsExecutor::Config& config) :
+    _impl{std::make_shared<Impl>(config)} {
+}
+
+SharedStreamsExecutor::Client::Ptr SharedStreamsExecutor::CreateClient(const ClientConfig& config) {
+    return Client::Ptr{new Client{_impl, config}};
+}
+
+const IStreamsExecutor::Config& SharedStreamsExecutor::GetConfig() const {
+    return _impl->_config;
+}
+
+}  // namespace InferenceEngine
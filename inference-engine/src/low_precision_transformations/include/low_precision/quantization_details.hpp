@@ -46,6 +46,30 @@ public:
             std::vector<float>& outputHighValues,
             size_t& outputIntervalsCount);
 
+    /**
+     * @brief Caches the details of FakeQuantize operations requested in the current thread while the scope is alive.
+     * Cached details are reused while the operation keeps the same inputs, levels and output shape.
+     */
+    class TRANSFORMATIONS_API CacheScope {
+    public:
+        struct Cache;
+
+        CacheScope();
+        ~CacheScope();
+
+        CacheScope(const CacheScope&) = delete;
+        CacheScope& operator=(const CacheScope&) = delete;
+
+        /**
+         * @brief Returns the number of the details returned from the cache of this scope.
+         */
+        size_t getHitsCount() const;
+
+    private:
+        std::unique_ptr<Cache> cache;
+        Cache* previous;
+    };
+
     static QuantizationDetails getDetails(std::shared_ptr<opset1::FakeQuantize>);
     bool hasNegativeOutput() const;
     float maxOutput(const size_t channel) const;
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <ngraph/ngraph.hpp>
@@ -293,15 +294,27 @@ public:
     bool isPrecisionPreserved(const std::shared_ptr<Node>& layer) const noexcept override;
 
 private:
+    struct OperationTransformations {
+        std::vector<LayerTransformationPtr> transformations;
+        std::vector<element::Type> precisionsOnActivations;
+    };
+
     LowPrecisionTransformations transformations;
 
+    // The managers interface is queried for the neighbours of each handled operation,
+    // so the transformations of the operation types are looked up once in the constructor.
+    std::unordered_map<std::string, OperationTransformations> operationTransformations;
+
+    void initializeOperationTransformations();
+    const OperationTransformations* findOperationTransformations(const Node& op) const noexcept;
+
     void registerAllMatchers(
-        std::map<std::string, LayerTransformationPtr> transformations,
+        const std::map<std::string, LayerTransformationPtr>& transformations,
         GraphRewrite& pass,
         TransformationContext& context);
 
     void registerAllMatchers(
-        std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>> transformations,
+        const std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>>& transformations,
         GraphRewrite& pass,
         TransformationContext& context);
 };
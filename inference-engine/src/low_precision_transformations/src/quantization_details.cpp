@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -22,6 +23,50 @@ namespace ngraph {
 namespace pass {
 namespace low_precision {
 
+struct QuantizationDetails::CacheScope::Cache {
+    struct Entry {
+        std::weak_ptr<Node> quantize;
+        std::vector<std::weak_ptr<Node>> inputs;
+        size_t levels;
+        PartialShape outputShape;
+        std::shared_ptr<QuantizationDetails> details;
+    };
+
+    // the entry is stale if the operation was replaced or one of its inputs was reconnected
+    static bool isActual(const Entry& entry, const std::shared_ptr<opset1::FakeQuantize>& quantize) {
+        if ((entry.quantize.lock() != quantize) ||
+            (entry.levels != quantize->get_levels()) ||
+            !(entry.outputShape == quantize->get_output_partial_shape(0))) {
+            return false;
+        }
+        for (size_t i = 0; i < entry.inputs.size(); ++i) {
+            if (entry.inputs[i].lock().get() != quantize->get_input_node_ptr(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::unordered_map<const Node*, Entry> entries;
+    size_t hitsCount = 0;
+};
+
+namespace {
+thread_local QuantizationDetails::CacheScope::Cache* currentCache = nullptr;
+}  // namespace
+
+QuantizationDetails::CacheScope::CacheScope() : cache(new Cache()), previous(currentCache) {
+    currentCache = cache.get();
+}
+
+QuantizationDetails::CacheScope::~CacheScope() {
+    currentCache = previous;
+}
+
+size_t QuantizationDetails::CacheScope::getHitsCount() const {
+    return cache->hitsCount;
+}
+
 QuantizationDetails::QuantizationDetails()
     : levels(),
       inputLowValues({}),
@@ -64,14 +109,15 @@ bool QuantizationDetails::outputLayoutIsSupported(std::shared_ptr<opset1::FakeQu
         return false;
     }
 
-    const size_t inputLowValuesSize = as_type_ptr<opset1::Constant>(quantize->get_input_node_shared_ptr(1))->cast_vector<float>().size();
-    const size_t inputHighValuesSize = as_type_ptr<opset1::Constant>(quantize->get_input_node_shared_ptr(2))->cast_vector<float>().size();
+    // the values are not read: the count of the constant values is the size of its shape
+    const size_t inputLowValuesSize = shape_size(quantize->get_input_node_ptr(1)->get_output_shape(0));
+    const size_t inputHighValuesSize = shape_size(quantize->get_input_node_ptr(2)->get_output_shape(0));
     if (inputLowValuesSize != inputHighValuesSize) {
         return false;
     }
 
-    const size_t outputLowValuesSize = as_type_ptr<opset1::Constant>(quantize->get_input_node_shared_ptr(3))->cast_vector<float>().size();
-    const size_t outputHighValuesSize = as_type_ptr<opset1::Constant>(quantize->get_input_node_shared_ptr(4))->cast_vector<float>().size();
+    const size_t outputLowValuesSize = shape_size(quantize->get_input_node_ptr(3)->get_output_shape(0));
+    const size_t outputHighValuesSize = shape_size(quantize->get_input_node_ptr(4)->get_output_shape(0));
     if (outputLowValuesSize != outputHighValuesSize) {
         return false;
     }
@@ -126,6 +172,15 @@ void QuantizationDetails::getOutputIntervals(
 
 
 QuantizationDetails QuantizationDetails::getDetails(std::shared_ptr<opset1::FakeQuantize> quantize) {
+    CacheScope::Cache::Entry* entry = nullptr;
+    if (currentCache != nullptr) {
+        entry = &currentCache->entries[quantize.get()];
+        if ((entry->details != nullptr) && CacheScope::Cache::isActual(*entry, quantize)) {
+            ++currentCache->hitsCount;
+            return *entry->details;
+        }
+    }
+
     std::vector<float> inputLowValues;
     std::vector<float> inputHighValues;
     size_t inputIntervalsCount;
@@ -142,7 +197,7 @@ QuantizationDetails QuantizationDetails::getDetails(std::shared_ptr<opset1::Fake
         THROW_IE_LPT_EXCEPTION(*quantize) << "Expected output channels count " << outputIntervalsCount << " but found " << outputChannelsCount;
     }
 
-    return QuantizationDetails(
+    const QuantizationDetails details(
             quantize->get_levels(),
             inputLowValues,
             inputHighValues,
@@ -151,6 +206,19 @@ QuantizationDetails QuantizationDetails::getDetails(std::shared_ptr<opset1::Fake
             inputIntervalsCount,
             outputIntervalsCount,
             outputChannelsCount);
+
+    if (entry != nullptr) {
+        entry->quantize = quantize;
+        entry->inputs.clear();
+        for (size_t i = 0; i < quantize->get_input_size(); ++i) {
+            entry->inputs.push_back(quantize->get_input_node_shared_ptr(i));
+        }
+        entry->levels = quantize->get_levels();
+        entry->outputShape = quantize->get_output_partial_shape(0);
+        entry->details = std::make_shared<QuantizationDetails>(details);
+    }
+
+    return details;
 }
 
 bool QuantizationDetails::hasNegativeOutput() const {
@@ -292,7 +292,9 @@ bool LowPrecisionTransformer::isFunctionQuantized(const std::shared_ptr<const Fu
     return false;
 }
 
-LowPrecisionTransformer::LowPrecisionTransformer(): transformations(LowPrecisionTransformer::getAllTransformations()) {}
+LowPrecisionTransformer::LowPrecisionTransformer(): transformations(LowPrecisionTransformer::getAllTransformations()) {
+    initializeOperationTransformations();
+}
 
 template <typename BaseOp>
 void make_matcher_type_relaxed(ngraph::pass::GraphRewrite* transformation) {
@@ -359,7 +361,51 @@ TypeRelaxedReplacer::TypeRelaxedReplacer() {
 }
 
 LowPrecisionTransformer::LowPrecisionTransformer(const LowPrecisionTransformations& transformations)
-    : transformations(transformations) {}
+    : transformations(transformations) {
+    initializeOperationTransformations();
+}
+
+void LowPrecisionTransformer::initializeOperationTransformations() {
+    std::vector<std::string> operationTypes;
+    for (const auto& it : transformations.branchSpecificTransformations) {
+        operationTypes.push_back(it.first);
+    }
+    for (const auto& it : transformations.transformations) {
+        operationTypes.push_back(it.first);
+    }
+    for (const auto& it : transformations.cleanupTransformations) {
+        operationTypes.push_back(it.first);
+    }
+    for (const auto& it : transformations.standaloneCleanupTransformations) {
+        operationTypes.push_back(it.typeName);
+    }
+
+    for (const auto& operationType : operationTypes) {
+        if (operationTransformations.count(operationType) != 0ul) {
+            continue;
+        }
+
+        std::vector<LayerTransformationPtr> typeTransformations = transformations.find(operationType);
+        if (typeTransformations.empty()) {
+            continue;
+        }
+
+        OperationTransformations& operation = operationTransformations[operationType];
+        operation.transformations = std::move(typeTransformations);
+        operation.precisionsOnActivations = operation.transformations[0]->getPrecisionsOnActivations();
+        for (const auto& transform : operation.transformations) {
+            operation.precisionsOnActivations = NetworkHelper::precisionIntersection(
+                operation.precisionsOnActivations,
+                transform->getPrecisionsOnActivations());
+        }
+    }
+}
+
+const LowPrecisionTransformer::OperationTransformations* LowPrecisionTransformer::findOperationTransformations(
+    const Node& op) const noexcept {
+    const auto it = operationTransformations.find(LowPrecisionTransformations::getType(op));
+    return it == operationTransformations.end() ? nullptr : &it->second;
+}
 
 void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
     if (!isFunctionQuantized(network)) {
@@ -376,6 +422,9 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
 
     TransformationContext context(network);
 
+    // each FakeQuantize operation is analyzed by its own transformations and by the transformations of its neighbours
+    QuantizationDetails::CacheScope quantizationDetailsCache;
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "TypeRelaxedReplacer");
 
     // Extend necessary operations with polymorphic semantics
@@ -425,7 +474,7 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
     {
         // Step #4: standalone cleanup transformations execution
 
-        for (auto it : transformations.standaloneCleanupTransformations) {
+        for (const auto& it : transformations.standaloneCleanupTransformations) {
             GraphRewrite pass;
             it.transformation->registerMatcherIn(pass, context);
             pass.run_on_function(network);
@@ -436,27 +485,20 @@ void LowPrecisionTransformer::transform(std::shared_ptr<Function> network) {
 }
 
 std::vector<element::Type> LowPrecisionTransformer::getPrecisionsOnActivations(const Node& op) const noexcept {
-    const std::string operantionType = LowPrecisionTransformations::getType(op);
-    const std::vector<LayerTransformationPtr> transformation = transformations.find(operantionType);
-    if (transformation.empty()) {
+    const OperationTransformations* operation = findOperationTransformations(op);
+    if (operation == nullptr) {
         return std::vector<element::Type>();
     }
-    std::vector<element::Type> precisions = transformation[0]->getPrecisionsOnActivations();
-
-    for (const auto& transform : transformation) {
-        precisions = NetworkHelper::precisionIntersection(precisions, transform->getPrecisionsOnActivations());
-    }
-    return precisions;
+    return operation->precisionsOnActivations;
 }
 
 bool LowPrecisionTransformer::isQuantized(const std::shared_ptr<Node>& layer) const noexcept {
-    const std::string operantionType = LowPrecisionTransformations::getType(*layer);
-    const std::vector<LayerTransformationPtr> transformation = transformations.find(operantionType);
-    if (transformation.empty()) {
+    const OperationTransformations* operation = findOperationTransformations(*layer);
+    if (operation == nullptr) {
         return false;
     }
 
-    for (const auto& transform : transformation) {
+    for (const auto& transform : operation->transformations) {
         if (!transform->isQuantized(layer)) {
             return false;
         }
@@ -465,13 +507,12 @@ bool LowPrecisionTransformer::isQuantized(const std::shared_ptr<Node>& layer) co
 }
 
 bool LowPrecisionTransformer::isPrecisionPreserved(const std::shared_ptr<Node>& layer) const noexcept {
-    const std::string operantionType = LowPrecisionTransformations::getType(*layer);
-    const std::vector<LayerTransformationPtr> transformation = transformations.find(operantionType);
-    if (transformation.empty()) {
+    const OperationTransformations* operation = findOperationTransformations(*layer);
+    if (operation == nullptr) {
         return false;
     }
 
-    for (const auto& transform : transformation) {
+    for (const auto& transform : operation->transformations) {
         if (!transform->isPrecisionPreserved(layer)) {
             return false;
         }
@@ -480,20 +521,20 @@ bool LowPrecisionTransformer::isPrecisionPreserved(const std::shared_ptr<Node>&
 }
 
 void LowPrecisionTransformer::registerAllMatchers(
-    std::map<std::string, LayerTransformationPtr> transformations,
+    const std::map<std::string, LayerTransformationPtr>& transformations,
     GraphRewrite& pass,
     TransformationContext& context) {
-    for (auto it : transformations) {
+    for (const auto& it : transformations) {
         it.second->registerMatcherIn(pass, context);
     }
 }
 
 void LowPrecisionTransformer::registerAllMatchers(
-    std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>> transformations,
+    const std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>>& transformations,
     GraphRewrite& pass,
     TransformationContext& context) {
-    for (auto it : transformations) {
-        for (auto transform : it.second) {
+    for (const auto& it : transformations) {
+        for (const auto& transform : it.second) {
             transform.second->registerMatcherIn(pass, context);
         }
     }
@@ -74,6 +74,104 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS) {
+            if (val == PluginConfigParams::YES) sharedStreams = true;
+            else if (val == PluginConfigParams::NO) sharedStreams = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i <= 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT
+                                   << ". Expected only positive integer numbers";
+            sharedStreamsWeight = static_cast<unsigned int>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS_PRIORITY) {
+            try {
+                sharedStreamsPriority = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS_PRIORITY
+                                   << ". Expected only integer numbers";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUEUE_LIMIT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUEUE_LIMIT
+                                   << ". Expected only non-negative integer numbers";
+            sharedStreamsQueueLimit = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION) {
+            if (val == PluginConfigParams::YES) dataflowExecution = true;
+            else if (val == PluginConfigParams::NO) dataflowExecution = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            dynamicShapesCacheSize = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_NUMA_LOCAL_MEMORY) {
+            if (val == PluginConfigParams::YES) numaLocalMemory = true;
+            else if (val == PluginConfigParams::NO) numaLocalMemory = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_NUMA_LOCAL_MEMORY
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::NO) hugePages = NoHugePages;
+            else if (val == PluginConfigParams::YES) hugePages = TransparentHugePages;
+            else if (val == PluginConfigParams::CPU_HUGE_PAGES_2MB) hugePages = HugePages2MB;
+            else if (val == PluginConfigParams::CPU_HUGE_PAGES_1GB) hugePages = HugePages1GB;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                                   << ". Expected only YES/NO/" << PluginConfigParams::CPU_HUGE_PAGES_2MB
+                                   << "/" << PluginConfigParams::CPU_HUGE_PAGES_1GB;
+        } else if (key == PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION) {
+            if (val == PluginConfigParams::YES) globalLayoutSelection = true;
+            else if (val == PluginConfigParams::NO) globalLayoutSelection = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_MEMORY_ALIGNMENT) {
+            int val_i = 0;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 32 || (val_i & (val_i - 1)) != 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_MEMORY_ALIGNMENT
+                                   << ". Expected only powers of two not less than 32";
+            memoryAlignment = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_WORKSPACE) {
+            sharedWorkspace = val;
+        } else if (key == PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS) {
+            if (val == PluginConfigParams::YES) keepFP16Weights = true;
+            else if (val == PluginConfigParams::NO) keepFP16Weights = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_RESULT_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RESULT_CACHE_SIZE
+                                   << ". Expected only non-negative integer numbers";
+            resultCacheSize = static_cast<size_t>(val_i);
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -151,6 +249,47 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        if (sharedStreams == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT, std::to_string(sharedStreamsWeight) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS_PRIORITY, std::to_string(sharedStreamsPriority) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUEUE_LIMIT, std::to_string(sharedStreamsQueueLimit) });
+        if (dataflowExecution == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, std::to_string(dynamicShapesCacheSize) });
+        if (numaLocalMemory == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_NUMA_LOCAL_MEMORY, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_NUMA_LOCAL_MEMORY, PluginConfigParams::NO });
+        switch (hugePages) {
+            case NoHugePages:
+                _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::NO });
+            break;
+            case TransparentHugePages:
+                _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::YES });
+            break;
+            case HugePages2MB:
+                _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::CPU_HUGE_PAGES_2MB });
+            break;
+            case HugePages1GB:
+                _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, PluginConfigParams::CPU_HUGE_PAGES_1GB });
+            break;
+        }
+        if (globalLayoutSelection == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_MEMORY_ALIGNMENT, std::to_string(memoryAlignment) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_WORKSPACE, sharedWorkspace });
+        if (keepFP16Weights == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_RESULT_CACHE_SIZE, std::to_string(resultCacheSize) });
         IE_SUPPRESS_DEPRECATED_START
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         IE_SUPPRESS_DEPRECATED_END
@@ -20,12 +20,32 @@ struct Config {
         On,
     };
 
+    enum HugePagesMode {
+        NoHugePages,
+        TransparentHugePages,
+        HugePages2MB,
+        HugePages1GB,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
+    bool sharedStreams = false;
+    unsigned int sharedStreamsWeight = 1;
+    int sharedStreamsPriority = 0;
+    size_t sharedStreamsQueueLimit = 0;
+    bool dataflowExecution = false;
+    size_t dynamicShapesCacheSize = 0;
+    bool numaLocalMemory = false;
+    HugePagesMode hugePages = NoHugePages;
+    bool globalLayoutSelection = false;
+    size_t memoryAlignment = 32;
+    std::string sharedWorkspace = "";
+    bool keepFP16Weights = false;
+    size_t resultCacheSize = 0;
 
 #if defined(__arm__) || defined(__aarch64__)
     // Currently INT8 mode is not optimized on ARM, fallback to FP32 mode.
@@ -85,7 +85,8 @@ enum Type {
     ExperimentalDetectronPriorGridGenerator,
     ExperimentalDetectronGenerateProposalsSingleImage,
     ExtractImagePatches,
-    NonMaxSuppression
+    NonMaxSuppression,
+    MHA
 };
 
 enum Algorithm {
@@ -144,6 +145,14 @@ enum Algorithm {
     EltwiseRoundHalfToEven,
     EltwiseRoundHalfAwayFromZero,
     EltwiseErf,
+    EltwiseLog,
+    EltwiseNegative,
+    EltwiseFloor,
+    EltwiseCeiling,
+    EltwiseSign,
+    EltwiseSin,
+    EltwiseCos,
+    EltwiseSoftSign,
 
     // FakeQuantize algorithms
     FQCommon,
@@ -178,28 +187,18 @@ enum Algorithm {
     ReduceSumSquare,
 
     // Math algorithms
-    MathAbs,
     MathAcos,
     MathAcosh,
     MathAsin,
     MathAsinh,
     MathAtan,
     MathAtanh,
-    MathCeiling,
-    MathCos,
     MathCosh,
     MathErf,
-    MathFloor,
     MathHardSigmoid,
-    MathLog,
-    MathNegative,
     MathReciprocal,
     MathSelu,
-    MathSign,
-    MathSin,
     MathSinh,
-    MathSoftPlus,
-    MathSoftsign,
     MathTan
 };
 
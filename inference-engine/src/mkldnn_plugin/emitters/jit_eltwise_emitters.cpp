@@ -1579,6 +1579,8 @@ void jit_sqrt_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const st
 /// Negate ///
 jit_negative_emitter::jit_negative_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
 : jit_emitter(host, host_isa, node, exec_prc) {}
+jit_negative_emitter::jit_negative_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {}
 
 size_t jit_negative_emitter::get_inputs_num() const { return 1; }
 
@@ -1784,4 +1786,266 @@ size_t jit_erf_emitter::aux_vecs_count() const {
     return 5ul;
 }
 
+/// FLOOR ///
+jit_floor_emitter::jit_floor_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_floor_emitter::get_inputs_num() const { return 1; }
+
+void jit_floor_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_floor_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+    h->uni_vroundps(vmm_dst, vmm_src, 1);
+}
+
+/// CEILING ///
+jit_ceiling_emitter::jit_ceiling_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_ceiling_emitter::get_inputs_num() const { return 1; }
+
+void jit_ceiling_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_ceiling_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+    h->uni_vroundps(vmm_dst, vmm_src, 2);
+}
+
+/// SIGN ///
+jit_sign_emitter::jit_sign_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    prepare_table();
+}
+
+size_t jit_sign_emitter::get_inputs_num() const { return 1; }
+
+void jit_sign_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_sign_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+    Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
+    Vmm vmm_aux1 = Vmm(aux_vec_idxs[1]);
+
+    // dst = (src > 0) - (src < 0), NaN gives zero
+    if (isa == cpu::x64::sse41) {
+        h->movups(vmm_aux0, table_val("zero"));
+        h->cmpps(vmm_aux0, vmm_src, _cmp_lt_os);
+        h->movups(vmm_aux1, vmm_src);
+        h->cmpps(vmm_aux1, table_val("zero"), _cmp_lt_os);
+        h->andps(vmm_aux0, table_val("one"));
+        h->andps(vmm_aux1, table_val("one"));
+        h->movups(vmm_dst, vmm_aux0);
+        h->subps(vmm_dst, vmm_aux1);
+    } else if (isa == cpu::x64::avx2) {
+        h->vcmpps(vmm_aux0, vmm_src, table_val("zero"), _cmp_gt_os);
+        h->vcmpps(vmm_aux1, vmm_src, table_val("zero"), _cmp_lt_os);
+        h->vandps(vmm_aux0, vmm_aux0, table_val("one"));
+        h->vandps(vmm_aux1, vmm_aux1, table_val("one"));
+        h->vsubps(vmm_dst, vmm_aux0, vmm_aux1);
+    } else {
+        h->vcmpps(k_mask, vmm_src, table_val("zero"), _cmp_gt_os);
+        h->uni_vmovups(vmm_aux0, table_val("zero"));
+        h->vblendmps(vmm_aux0 | k_mask, vmm_aux0, table_val("one"));
+        h->vcmpps(k_mask, vmm_src, table_val("zero"), _cmp_lt_os);
+        h->uni_vmovups(vmm_aux1, table_val("zero"));
+        h->vblendmps(vmm_aux1 | k_mask, vmm_aux1, table_val("one"));
+        h->vsubps(vmm_dst, vmm_aux0, vmm_aux1);
+    }
+}
+
+void jit_sign_emitter::register_table_entries() {
+    push_arg_entry_of("zero", 0x00000000, true);
+    push_arg_entry_of("one", 0x3f800000, true);
+}
+
+size_t jit_sign_emitter::aux_vecs_count() const {
+    return 2;
+}
+
+/// SIN ///
+jit_sin_emitter::jit_sin_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    prepare_table();
+}
+
+size_t jit_sin_emitter::get_inputs_num() const { return 1; }
+
+void jit_sin_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_sin_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+    Vmm vmm_n = Vmm(aux_vec_idxs[0]);
+    Vmm vmm_r = Vmm(aux_vec_idxs[1]);
+    Vmm vmm_aux = Vmm(aux_vec_idxs[2]);
+    Vmm vmm_sign = Vmm(aux_vec_idxs[3]);
+
+    // n = round(x / pi), for cos n = round(x / pi + 1/2)
+    h->uni_vmovups(vmm_n, vmm_src);
+    h->uni_vmulps(vmm_n, vmm_n, table_val("inv_pi"));
+    if (is_cos)
+        h->uni_vaddps(vmm_n, vmm_n, table_val("half"));
+    h->uni_vroundps(vmm_n, vmm_n, 0);
+
+    // odd n flips the sign of the result
+    h->uni_vcvtps2dq(vmm_sign, vmm_n);
+    h->uni_vpslld(vmm_sign, vmm_sign, 31);
+
+    // r = x - n * pi (cos: x - (n - 1/2) * pi), pi is split into three parts to keep r exact
+    if (is_cos)
+        h->uni_vsubps(vmm_n, vmm_n, table_val("half"));
+    h->uni_vmovups(vmm_r, vmm_src);
+    h->uni_vmovups(vmm_aux, vmm_n);
+    h->uni_vmulps(vmm_aux, vmm_aux, table_val("pi_hi"));
+    h->uni_vsubps(vmm_r, vmm_r, vmm_aux);
+    h->uni_vmovups(vmm_aux, vmm_n);
+    h->uni_vmulps(vmm_aux, vmm_aux, table_val("pi_mid"));
+    h->uni_vsubps(vmm_r, vmm_r, vmm_aux);
+    h->uni_vmovups(vmm_aux, vmm_n);
+    h->uni_vmulps(vmm_aux, vmm_aux, table_val("pi_lo"));
+    h->uni_vsubps(vmm_r, vmm_r, vmm_aux);
+
+    // sin(r) = r + r * r^2 * P(r^2)
+    h->uni_vmovups(vmm_aux, vmm_r);
+    h->uni_vmulps(vmm_aux, vmm_aux, vmm_r);
+    h->uni_vmovups(vmm_n, table_val("pol5"));
+    h->uni_vfmadd213ps(vmm_n, vmm_aux, table_val("pol4"));
+    h->uni_vfmadd213ps(vmm_n, vmm_aux, table_val("pol3"));
+    h->uni_vfmadd213ps(vmm_n, vmm_aux, table_val("pol2"));
+    h->uni_vfmadd213ps(vmm_n, vmm_aux, table_val("pol1"));
+    h->uni_vmulps(vmm_n, vmm_n, vmm_aux);
+    h->uni_vfmadd213ps(vmm_n, vmm_r, vmm_r);
+
+    h->uni_vxorps(vmm_dst, vmm_n, vmm_sign);
+}
+
+void jit_sin_emitter::register_table_entries() {
+    push_arg_entry_of("inv_pi", 0x3ea2f983, true);  // 1 / pi
+    push_arg_entry_of("half", 0x3f000000, true);
+    push_arg_entry_of("pi_hi", 0x40490000, true);   // 3.140625
+    push_arg_entry_of("pi_mid", 0x3a7da000, true);  // 9.67502593994140625e-4
+    push_arg_entry_of("pi_lo", 0x34222169, true);   // 1.509957990978376432e-7
+
+    push_arg_entry_of("pol1", 0xbe2aaaab, true);    // -1 / 3!
+    push_arg_entry_of("pol2", 0x3c088889, true);    //  1 / 5!
+    push_arg_entry_of("pol3", 0xb9500d01, true);    // -1 / 7!
+    push_arg_entry_of("pol4", 0x3638ef1d, true);    //  1 / 9!
+    push_arg_entry_of("pol5", 0xb2d7322b, true);    // -1 / 11!
+}
+
+size_t jit_sin_emitter::aux_vecs_count() const {
+    return 4;
+}
+
+/// COS ///
+jit_cos_emitter::jit_cos_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_sin_emitter(host, host_isa, node, exec_prc) {
+    is_cos = true;
+}
+
+/// SOFTSIGN ///
+jit_softsign_emitter::jit_softsign_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    prepare_table();
+}
+
+size_t jit_softsign_emitter::get_inputs_num() const { return 1; }
+
+void jit_softsign_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_softsign_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+    Vmm vmm_aux0 = Vmm(aux_vec_idxs[0]);
+
+    // dst = src / (1 + |src|)
+    h->uni_vmovups(vmm_aux0, vmm_src);
+    h->uni_vandps(vmm_aux0, vmm_aux0, table_val("positive_mask"));
+    h->uni_vaddps(vmm_aux0, vmm_aux0, table_val("one"));
+    h->uni_vdivps(vmm_dst, vmm_src, vmm_aux0);
+}
+
+void jit_softsign_emitter::register_table_entries() {
+    push_arg_entry_of("positive_mask", 0x7fffffff, true);
+    push_arg_entry_of("one", 0x3f800000, true);
+}
+
+size_t jit_softsign_emitter::aux_vecs_count() const {
+    return 1;
+}
+
 } // namespace MKLDNNPlugin
@@ -20,6 +20,8 @@
 #include <utility>
 #include <cstring>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/assign.hpp>
+#include <ngraph/op/read_value.hpp>
 #include <transformations/utils/utils.hpp>
 
 using namespace MKLDNNPlugin;
@@ -35,17 +37,25 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const NetworkSpecializer &specializer) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+        _network(network),
+    _specializer(specializer) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
     }
+    for (const auto& input : _network.getInputsInfo()) {
+        _networkInputShapes[input.first] = input.second->getTensorDesc().getDims();
+    }
+    for (const auto& output : _network.getOutputsInfo()) {
+        _networkOutputShapes[output.first] = output.second->getTensorDesc().getDims();
+    }
     bool isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
     if (_cfg.batchLimit > 1) {
@@ -55,21 +65,51 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    // the networks share the activations only when their requests are executed on the same streams
+    const void* workspaceExecutor = nullptr;
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+        workspaceExecutor = _taskExecutor.get();
+    } else if (cfg.sharedStreams) {
+        // all networks with the same streams configuration are scheduled on one set of stream threads
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
+        streamsExecutorConfig._name = "CPUSharedStreamsExecutor";
+        auto sharedExecutor = InferenceEngine::ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig);
+        _sharedStreamsClient = sharedExecutor->CreateClient({_name, _cfg.sharedStreamsWeight, _cfg.sharedStreamsPriority,
+                                                             _cfg.sharedStreamsQueueLimit});
+        _taskExecutor = _sharedStreamsClient;
+        workspaceExecutor = sharedExecutor.get();
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        workspaceExecutor = _taskExecutor.get();
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
+    if (cfg.sharedStreams && !cfg.exclusiveAsyncRequests) {
+        _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPUSharedCallbackExecutor");
+    } else if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
             IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
     } else {
         _callbackExecutor = _taskExecutor;
     }
 
+    if (_cfg.numaLocalMemory || _cfg.hugePages != Config::NoHugePages) {
+        _memoryAllocator = std::make_shared<MKLDNNMemoryAllocator>(_cfg.numaLocalMemory, _cfg.hugePages);
+    }
+
+    if (!_cfg.sharedWorkspace.empty()) {
+        _sharedWorkspace = MKLDNNSharedWorkspace::get(_cfg.sharedWorkspace, workspaceExecutor);
+    }
+
+    // the outputs of the networks with state depend on the previous inferences as well
+    if (_cfg.resultCacheSize != 0 &&
+        !ngraph::op::util::has_op_with_type<ngraph::op::ReadValueBase>(function) &&
+        !ngraph::op::util::has_op_with_type<ngraph::op::AssignBase>(function)) {
+        _resultCache = std::make_shared<MKLDNNResultCache>(_cfg.resultCacheSize << 20);
+    }
+
     // Workaround for initializing friendly names for all the OPs
     // Otherwise they are initialized concurrently without thread safety.
     // TODO: Can be removed after 57069 is done.
@@ -129,6 +169,9 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setSharedWorkspace(_sharedWorkspace, streamId % _graphs.size());
+                // the graph is created in the stream thread, so its memory is placed on the stream NUMA node
+                MKLDNNMemoryAllocator::Scope allocatorScope{_memoryAllocator.get()};
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -146,6 +189,111 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+std::shared_ptr<const MKLDNNExecNetwork::SpecializedNetwork> MKLDNNExecNetwork::GetSpecializedNetwork(const InputShapes& inputShapes) {
+    auto findNetwork = [&] () -> std::shared_ptr<const SpecializedNetwork> {
+        std::lock_guard<std::mutex> lock{_specializedNetworksMutex};
+        auto itNetwork = std::find_if(_specializedNetworks.begin(), _specializedNetworks.end(),
+                                      [&](const std::shared_ptr<const SpecializedNetwork>& network) {
+            return network->_inputShapes == inputShapes;
+        });
+        if (itNetwork == _specializedNetworks.end()) {
+            return nullptr;
+        }
+        _specializedNetworks.splice(_specializedNetworks.begin(), _specializedNetworks, itNetwork);
+        return _specializedNetworks.front();
+    };
+
+    if (auto network = findNetwork()) {
+        return network;
+    }
+    // the streams looking up the cached networks do not wait for the transformations
+    std::lock_guard<std::mutex> lock{_specializerMutex};
+    if (auto network = findNetwork()) {
+        return network;
+    }
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::GetSpecializedNetwork");
+    auto network = std::make_shared<SpecializedNetwork>();
+    network->_inputShapes = inputShapes;
+    network->_network = _specializer(inputShapes);
+    for (const auto& output : network->_network.getOutputsInfo()) {
+        network->_outputShapes[output.first] = output.second->getTensorDesc().getDims();
+    }
+    // the friendly names are initialized here, since the streams create their graphs from the network concurrently
+    for (const auto& op : network->_network.getFunction()->get_ops()) {
+        op->get_friendly_name();
+    }
+    _specializedNetworksCount++;
+
+    size_t cacheSize = 0;
+    {
+        std::lock_guard<std::mutex> cfgLock{_cfgMutex};
+        cacheSize = _cfg.dynamicShapesCacheSize;
+    }
+    std::lock_guard<std::mutex> networksLock{_specializedNetworksMutex};
+    _specializedNetworks.push_front(network);
+    while (_specializedNetworks.size() > std::max<size_t>(cacheSize, 1)) {
+        _specializedNetworks.pop_back();
+    }
+    return network;
+}
+
+MKLDNNGraph& MKLDNNExecNetwork::GetGraphForShapes(Graph::Lock& graphLock, const InputShapes& inputShapes,
+                                                  const InputShapes*& outputShapes,
+                                                  std::shared_ptr<MKLDNNGraph>& specializedGraph) {
+    outputShapes = &_networkOutputShapes;
+    specializedGraph.reset();
+    if (!_specializer || inputShapes == _networkInputShapes) {
+        return graphLock._graph;
+    }
+
+    auto& graphs = graphLock._graph._specializedGraphs;
+    auto itGraph = std::find_if(graphs.begin(), graphs.end(), [&](const std::shared_ptr<SpecializedGraph>& graph) {
+        return graph->_network->_inputShapes == inputShapes;
+    });
+    if (itGraph != graphs.end()) {
+        graphs.splice(graphs.begin(), graphs, itGraph);
+        _specializedGraphsHits++;
+    } else {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::GetGraphForShapes");
+        int streamId = 0;
+        int numaNodeId = 0;
+        auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+        if (nullptr != streamsExecutor) {
+            streamId = streamsExecutor->GetStreamId();
+            numaNodeId = streamsExecutor->GetNumaNodeId();
+        }
+        Config cfg;
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            cfg = _cfg;
+        }
+
+        auto graph = std::make_shared<SpecializedGraph>();
+        graph->_network = GetSpecializedNetwork(inputShapes);
+        graph->_graph.setConfig(cfg);
+        graph->_graph.setSharedWorkspace(_sharedWorkspace, streamId % _graphs.size());
+        {
+            MKLDNNMemoryAllocator::Scope allocatorScope{_memoryAllocator.get()};
+            graph->_graph.CreateGraph(graph->_network->_network, extensionManager, _numaNodesWeights[numaNodeId]);
+        }
+        for (auto &node : graph->_graph.GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                IE_THROW(NotImplemented) << "Input shapes of networks with state cannot be changed";
+            }
+        }
+        _specializedGraphsCount++;
+        graphs.push_front(graph);
+        // the graph for the current shapes is kept anyway
+        while (graphs.size() > std::max<size_t>(cfg.dynamicShapesCacheSize, 1)) {
+            graphs.pop_back();
+        }
+    }
+    specializedGraph = std::shared_ptr<MKLDNNGraph>(graphs.front(), &graphs.front()->_graph);
+    outputShapes = &graphs.front()->_network->_outputShapes;
+    return graphs.front()->_graph;
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -156,6 +304,9 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
         if (graphLock._graph.IsReady()) {
             graphLock._graph.setProperty(properties);
         }
+        for (auto& specializedGraph : graphLock._graph._specializedGraphs) {
+            specializedGraph->_graph.setProperty(properties);
+        }
     }
 }
 
@@ -195,6 +346,26 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_MEMORY_PLAN));
+        if (_sharedStreamsClient) {
+            metrics.push_back(METRIC_KEY(NUMBER_OF_WAITING_INFER_REQUESTS));
+            metrics.push_back(METRIC_KEY(NUMBER_OF_EXEC_INFER_REQUESTS));
+            metrics.push_back(METRIC_KEY(AVERAGE_QUEUE_WAIT_TIME));
+            metrics.push_back(METRIC_KEY(MAX_QUEUE_WAIT_TIME));
+            metrics.push_back(METRIC_KEY(NUMBER_OF_REJECTED_INFER_REQUESTS));
+        }
+        if (_memoryAllocator) {
+            metrics.push_back(METRIC_KEY(CPU_MEMORY_STATISTICS));
+        }
+        if (_sharedWorkspace) {
+            metrics.push_back(METRIC_KEY(CPU_SHARED_WORKSPACE_STATISTICS));
+        }
+        if (_resultCache) {
+            metrics.push_back(METRIC_KEY(CPU_RESULT_CACHE_STATISTICS));
+        }
+        if (_specializer) {
+            metrics.push_back(METRIC_KEY(CPU_DYNAMIC_SHAPES_STATISTICS));
+        }
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -209,6 +380,66 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_MEMORY_PLAN)) {
+        const auto& plan = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.getMemoryPlan();
+        std::map<std::string, uint64_t> result = {
+            {"PLANNED_BYTES",      plan.plannedBytes},
+            {"NAIVE_BYTES",        plan.naiveBytes},
+            {"LOWER_BOUND_BYTES",  plan.lowerBoundBytes},
+        };
+        IE_SET_METRIC_RETURN(CPU_MEMORY_PLAN, result);
+    } else if (_sharedStreamsClient && name == METRIC_KEY(NUMBER_OF_WAITING_INFER_REQUESTS)) {
+        IE_SET_METRIC_RETURN(NUMBER_OF_WAITING_INFER_REQUESTS,
+                             static_cast<unsigned int>(_sharedStreamsClient->GetStatistics()._waiting));
+    } else if (_sharedStreamsClient && name == METRIC_KEY(NUMBER_OF_EXEC_INFER_REQUESTS)) {
+        IE_SET_METRIC_RETURN(NUMBER_OF_EXEC_INFER_REQUESTS,
+                             static_cast<unsigned int>(_sharedStreamsClient->GetStatistics()._executing));
+    } else if (_sharedStreamsClient && name == METRIC_KEY(AVERAGE_QUEUE_WAIT_TIME)) {
+        IE_SET_METRIC_RETURN(AVERAGE_QUEUE_WAIT_TIME,
+                             static_cast<float>(_sharedStreamsClient->GetStatistics()._averageWaitMs));
+    } else if (_sharedStreamsClient && name == METRIC_KEY(MAX_QUEUE_WAIT_TIME)) {
+        IE_SET_METRIC_RETURN(MAX_QUEUE_WAIT_TIME,
+                             static_cast<float>(_sharedStreamsClient->GetStatistics()._maxWaitMs));
+    } else if (_sharedStreamsClient && name == METRIC_KEY(NUMBER_OF_REJECTED_INFER_REQUESTS)) {
+        IE_SET_METRIC_RETURN(NUMBER_OF_REJECTED_INFER_REQUESTS,
+                             static_cast<unsigned int>(_sharedStreamsClient->GetStatistics()._rejected));
+    } else if (_memoryAllocator && name == METRIC_KEY(CPU_MEMORY_STATISTICS)) {
+        const auto statistics = _memoryAllocator->getStatistics();
+        std::map<std::string, uint64_t> result = {
+            {"ALLOCATIONS",                   statistics.allocations},
+            {"ALLOCATED_BYTES",               statistics.allocatedBytes},
+            {"PEAK_ALLOCATED_BYTES",          statistics.peakAllocatedBytes},
+            {"HUGE_PAGES_BYTES",              statistics.hugePagesBytes},
+            {"TRANSPARENT_HUGE_PAGES_BYTES",  statistics.transparentHugePagesBytes},
+            {"NUMA_LOCAL_BYTES",              statistics.numaLocalBytes},
+        };
+        IE_SET_METRIC_RETURN(CPU_MEMORY_STATISTICS, result);
+    } else if (_sharedWorkspace && name == METRIC_KEY(CPU_SHARED_WORKSPACE_STATISTICS)) {
+        const auto statistics = _sharedWorkspace->getStatistics();
+        std::map<std::string, uint64_t> result = {
+            {"GRAPHS",           statistics.graphs},
+            {"ALLOCATED_BYTES",  statistics.allocatedBytes},
+            {"REQUIRED_BYTES",   statistics.requiredBytes},
+            {"WAITS",            statistics.waits},
+        };
+        IE_SET_METRIC_RETURN(CPU_SHARED_WORKSPACE_STATISTICS, result);
+    } else if (_specializer && name == METRIC_KEY(CPU_DYNAMIC_SHAPES_STATISTICS)) {
+        std::map<std::string, uint64_t> result = {
+            {"NETWORKS",  _specializedNetworksCount.load()},
+            {"GRAPHS",    _specializedGraphsCount.load()},
+            {"HITS",      _specializedGraphsHits.load()},
+        };
+        IE_SET_METRIC_RETURN(CPU_DYNAMIC_SHAPES_STATISTICS, result);
+    } else if (_resultCache && name == METRIC_KEY(CPU_RESULT_CACHE_STATISTICS)) {
+        const auto statistics = _resultCache->getStatistics();
+        std::map<std::string, uint64_t> result = {
+            {"HITS",       statistics.hits},
+            {"MISSES",     statistics.misses},
+            {"ENTRIES",    statistics.entries},
+            {"BYTES",      statistics.bytes},
+            {"EVICTIONS",  statistics.evictions},
+        };
+        IE_SET_METRIC_RETURN(CPU_RESULT_CACHE_STATISTICS, result);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
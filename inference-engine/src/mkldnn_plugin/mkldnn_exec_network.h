@@ -9,12 +9,18 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_memory_allocator.h"
+#include "mkldnn_shared_workspace.h"
+#include "mkldnn_result_cache.h"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_shared_streams_executor.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
+#include <list>
 #include <string>
+#include <functional>
 #include <unordered_map>
 
 namespace MKLDNNPlugin {
@@ -22,6 +28,9 @@ namespace MKLDNNPlugin {
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
+    using InputShapes = std::map<std::string, InferenceEngine::SizeVector>;
+    // Returns the transformed network reshaped to the given input shapes
+    using NetworkSpecializer = std::function<InferenceEngine::CNNNetwork(const InputShapes&)>;
 
     std::shared_ptr<InferenceEngine::IInferRequestInternal>
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
@@ -30,7 +39,8 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const NetworkSpecializer &specializer = {});
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -52,8 +62,29 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // Set when the network runs on the process-wide shared CPU streams
+    InferenceEngine::SharedStreamsExecutor::Client::Ptr _sharedStreamsClient;
+    // Set when the graphs memory is NUMA local or backed by huge pages
+    MKLDNNMemoryAllocator::Ptr                  _memoryAllocator;
+    // Set when the activations are shared with other networks on the same streams
+    MKLDNNSharedWorkspace::Ptr                  _sharedWorkspace;
+    // Set when the outputs of the repeated inputs are reused
+    MKLDNNResultCache::Ptr                      _resultCache;
+    // The network transformed for input shapes other than the network ones, it is shared by the streams
+    struct SpecializedNetwork {
+        InputShapes                 _inputShapes;
+        InputShapes                 _outputShapes;
+        InferenceEngine::CNNNetwork _network;
+    };
+    // A graph of a stream created from a specialized network
+    struct SpecializedGraph {
+        std::shared_ptr<const SpecializedNetwork>   _network;
+        MKLDNNGraph                                 _graph;
+    };
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
+        // the most recently used graphs go first, the requests keep the graphs they used alive after the eviction
+        std::list<std::shared_ptr<SpecializedGraph>> _specializedGraphs;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             Graph&                          _graph;
@@ -69,6 +100,32 @@ protected:
      */
     Graph::Lock GetGraph();
 
+    /* Returns the graph of the stream for the given input shapes. It is either the stream graph itself or
+     * a graph from its cache of specialized graphs. The missing graph is created in the current thread from
+     * the specialized network shared by the streams.
+     * @p outputShapes is set to the output shapes of the returned graph
+     * @p specializedGraph owns the returned specialized graph, so it stays valid after it is evicted from the cache.
+     * It is reset if the stream graph is returned
+     */
+    MKLDNNGraph& GetGraphForShapes(Graph::Lock& graphLock, const InputShapes& inputShapes, const InputShapes*& outputShapes,
+                                   std::shared_ptr<MKLDNNGraph>& specializedGraph);
+
+    /* Returns the network transformed for the given input shapes from the cache shared by the streams.
+     * The missing network is transformed once, the streams needing it at the same time wait for it
+     */
+    std::shared_ptr<const SpecializedNetwork> GetSpecializedNetwork(const InputShapes& inputShapes);
+
+    NetworkSpecializer                          _specializer;
+    std::mutex                                  _specializerMutex;
+    // the most recently used networks go first, the graphs created from the evicted networks keep them alive
+    std::list<std::shared_ptr<const SpecializedNetwork>> _specializedNetworks;
+    std::mutex                                  _specializedNetworksMutex;
+    std::atomic<uint64_t>                       _specializedNetworksCount = {0};
+    std::atomic<uint64_t>                       _specializedGraphsCount = {0};
+    std::atomic<uint64_t>                       _specializedGraphsHits = {0};
+    InputShapes                                 _networkInputShapes;
+    InputShapes                                 _networkOutputShapes;
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
@@ -17,6 +17,7 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_layout_selector.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
@@ -27,6 +28,7 @@
 #include <nodes/mkldnn_convert_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -331,6 +333,7 @@ void MKLDNNGraph::InitGraph() {
     InitDescriptors();
     RemoveDroppedEdges();
 
+    SelectPrimitiveDescriptorsGlobally();
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -338,6 +341,8 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    BuildExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -382,6 +387,14 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+void MKLDNNGraph::SelectPrimitiveDescriptorsGlobally() {
+    if (!config.globalLayoutSelection)
+        return;
+
+    MKLDNNLayoutSelector selector;
+    selector.SelectPrimitiveDescriptors(*this);
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -565,6 +578,13 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     size_t edge_clusters_count = edge_clusters.size();
 
+    // The state is kept in the activations between the inferences, the shared memory is overwritten by other graphs
+    bool shareWorkspace = sharedWorkspace != nullptr;
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            shareWorkspace = false;
+    }
+
     for (size_t i = 0; i < edge_clusters_count;) {
         auto &cluster = edge_clusters[i];
         bool erase = false;
@@ -581,6 +601,13 @@ void MKLDNNGraph::AllocateWithReuse() {
             }
         }
 
+        // The data filled once on load are kept aside of the shared memory
+        if (!erase && shareWorkspace && std::any_of(cluster.begin(), cluster.end(), isConstOutput)) {
+            for (auto &edge : cluster)
+                edge->allocate();
+            erase = true;
+        }
+
         if (erase) {
             std::swap(edge_clusters[i], edge_clusters[edge_clusters_count - 1]);
             --edge_clusters_count;
@@ -591,15 +618,21 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     edge_clusters.resize(edge_clusters_count);
 
-    const int64_t alignment = 32;  // 32 bytes
+    const int64_t alignment = static_cast<int64_t>(config.memoryAlignment);  // in bytes
+
+    // Nodes of one level may run concurrently, so in the dataflow mode the lifetimes are measured in levels:
+    // the memory is reused only by the tensors produced after all consumers of the previous ones have finished
+    auto execTime = [&](const MKLDNNNodePtr& node) {
+        return nodeLevels.empty() ? node->execIndex : nodeLevels[node->execIndex];
+    };
 
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = execTime(edge->getParent());
+            int e_finish = execTime(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -649,14 +682,38 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    memoryPlan.plannedBytes = total_size;
+    memoryPlan.naiveBytes = static_cast<size_t>(memSolver.totalSize()) * alignment;
+    memoryPlan.lowerBoundBytes = static_cast<size_t>(memSolver.maxDepth()) * alignment;
+
+    // oneDNN aligns the buffers to the cache line, the workspace is shifted for the bigger alignments
+    const size_t base_alignment = 64;
+    const size_t alignment_padding = static_cast<size_t>(alignment) > base_alignment ? static_cast<size_t>(alignment) : 0;
+
+    int8_t* workspace_ptr = nullptr;
+    if (shareWorkspace && !edge_clusters.empty()) {
+        workspaceAllocation = sharedWorkspace->allocate(sharedWorkspaceStream, total_size + alignment_padding);
+    }
+    if (workspaceAllocation) {
+        memWorkspace.reset();
+        workspace_ptr = workspaceAllocation->data();
+    } else {
+        memWorkspace = std::make_shared<MKLDNNMemory>(eng);
+        const TensorDesc workspaceDesc(Precision::I8, {total_size + alignment_padding}, Layout::C);
+        memWorkspace->Create(MKLDNNMemoryDesc(workspaceDesc));
+        workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    }
 
     if (edge_clusters.empty())
         return;
 
-    auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    if (alignment_padding) {
+        const auto address = reinterpret_cast<uintptr_t>(workspace_ptr);
+        workspace_ptr += (alignment_padding - address % alignment_padding) % alignment_padding;
+    }
 
+    // the inputs are zeroed below while another graph may run on the shared memory
+    auto workspaceLock = lockSharedWorkspace();
     for (int i = 0; i < edge_clusters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clusters[i]) {
@@ -705,6 +762,24 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+bool MKLDNNGraph::canFuseInputNormalization(const std::string& name, const InferenceEngine::TensorDesc& desc) const {
+    if (_normalizePreprocMap.find(name) == _normalizePreprocMap.end())
+        return false;
+
+    auto input = inputNodesMap.find(name);
+    if (input == inputNodesMap.end())
+        return false;
+
+    if (!NormalizePreprocess::isFusedPrecisionSupported(desc.getPrecision()) ||
+        !one_of(desc.getLayout(), InferenceEngine::NCHW, InferenceEngine::NHWC))
+        return false;
+
+    // The fused kernel writes FP32 values in the user blob layout, so the graph input memory must have exactly that layout
+    const auto& interMem = input->second->getChildEdgeAt(0)->getMemory();
+    InferenceEngine::TensorDesc interDesc(InferenceEngine::Precision::FP32, desc.getDims(), desc.getBlockingDesc());
+    return interMem.GetDataType() == mkldnn::memory::data_type::f32 && MKLDNNMemoryDesc{interDesc} == interMem.GetDesc();
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
@@ -715,6 +790,15 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
+        // todo: make sure 'name' exists in this map...
+        auto normalizer = _normalizePreprocMap.find(name);
+        if (normalizer != _normalizePreprocMap.end() && canFuseInputNormalization(name, in->getTensorDesc())) {
+            // precision conversion, mean/scale and copy to the graph input memory are done in one pass
+            normalizer->second.NormalizeImage(outDims, ext_data_ptr, in->getTensorDesc().getPrecision(),
+                                              reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
+            return;
+        }
+
         if (ext_data_ptr != inter_data_ptr) {
             auto ext_tdesc = MKLDNNMemoryDesc {in->getTensorDesc()};
 
@@ -724,11 +808,10 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
             input->second->getChildEdgeAt(0)->getMemory().SetData(ext_mem, 0, false);
         }
 
-        // todo: make sure 'name' exists in this map...
-        if (_normalizePreprocMap.find(name) != _normalizePreprocMap.end()) {
+        if (normalizer != _normalizePreprocMap.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _normalizePreprocMap[name].NormalizeImage(outDims, reinterpret_cast<float *>(inter_data_ptr),
-                                                          in->getTensorDesc().getLayout());
+                normalizer->second.NormalizeImage(outDims, reinterpret_cast<float *>(inter_data_ptr),
+                                                  in->getTensorDesc().getLayout());
             } else {
                 IE_THROW() << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
             }
@@ -810,6 +893,52 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     ENABLE_CPU_DEBUG_CAP(NodeDumper nd(config.debugCaps, infer_count));
 
+    if (!executionLevels.empty()) {
+        auto executeNode = [&](const MKLDNNNodePtr& node, mkldnn::stream& strm) {
+            PERF(node);
+
+            if (batch > 0)
+                node->setDynamicBatchLim(batch);
+
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+            node->execute(strm);
+        };
+
+        for (auto &level : executionLevels) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
+
+            // The blobs are dumped out of the concurrent execution: the inputs before the whole level, the outputs after it
+            ENABLE_CPU_DEBUG_CAP(for (auto &node : level) nd.dumpInputBlobs(node));
+
+            if (level.size() == 1) {
+                executeNode(level.front(), stream);
+            } else {
+                // The nodes of the level are started as tasks on the threads of the current stream.
+                // Parallel regions of the nodes are nested into the tasks, so the threads are shared among the running nodes
+                std::vector<std::exception_ptr> exceptions(level.size());
+                parallel_for(level.size(), [&](size_t i) {
+                    try {
+                        mkldnn::stream nodeStream(eng);
+                        executeNode(level[i], nodeStream);
+                    } catch (...) {
+                        exceptions[i] = std::current_exception();
+                    }
+                });
+                for (auto &exception : exceptions) {
+                    if (exception)
+                        std::rethrow_exception(exception);
+                }
+            }
+
+            ENABLE_CPU_DEBUG_CAP(for (auto &node : level) nd.dumpOutputBlobs(node));
+        }
+
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+
     for (int i = 0; i < graphNodes.size(); i++) {
         if (request != nullptr) {
             request->ThrowIfCanceled();
@@ -833,6 +962,52 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::BuildExecutionLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::BuildExecutionLevels");
+
+    executionLevels.clear();
+    nodeLevels.clear();
+
+    if (!config.dataflowExecution || parallel_get_max_threads() == 1)
+        return;
+
+    // The state is read and written in the order of the nodes which is not expressed by the edges
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    nodeLevels.resize(graphNodes.size(), 0);
+    std::vector<std::vector<MKLDNNNodePtr>> levels;
+    // graphNodes are sorted topologically, so the levels of all parents are known when the node is visited
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            if (!parent->isConstant())
+                level = std::max(level, nodeLevels[parent->execIndex] + 1);
+        }
+        nodeLevels[node->execIndex] = level;
+
+        if (levels.size() <= static_cast<size_t>(level))
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+
+    // Without independent nodes the dataflow execution has no gain, so the ordinary sequential one is used
+    bool hasConcurrentNodes = std::any_of(levels.begin(), levels.end(),
+                                          [](const std::vector<MKLDNNNodePtr>& level) { return level.size() > 1; });
+    if (!hasConcurrentNodes) {
+        nodeLevels.clear();
+        return;
+    }
+
+    executionLevels = std::move(levels);
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
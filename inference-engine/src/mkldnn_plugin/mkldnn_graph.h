@@ -10,6 +10,7 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_shared_workspace.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -56,6 +57,12 @@ public:
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
 
+    /**
+     * Checks whether mean/scale normalization of the input may be fused with the precision conversion
+     * and the copy of the user blob into the graph input memory.
+     */
+    bool canFuseInputNormalization(const std::string& name, const InferenceEngine::TensorDesc& desc) const;
+
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(const InferenceEngine::BlobMap &out);
 
@@ -172,6 +179,36 @@ public:
         return isQuantizedFlag;
     }
 
+    struct MemoryPlan {
+        // size of the workspace shared by the activations
+        size_t plannedBytes = 0;
+        // size of the activations allocated separately
+        size_t naiveBytes = 0;
+        // maximal size of the activations alive at the same time
+        size_t lowerBoundBytes = 0;
+    };
+
+    const MemoryPlan& getMemoryPlan() const {
+        return memoryPlan;
+    }
+
+    /**
+     * Places the activations in the memory shared with the graphs of other networks running on the stream.
+     * Should be called before CreateGraph, graphs with states keep their own memory
+     */
+    void setSharedWorkspace(const MKLDNNSharedWorkspace::Ptr& workspace, int streamId) {
+        sharedWorkspace = workspace;
+        sharedWorkspaceStream = streamId;
+    }
+
+    /**
+     * Serializes the graph with the other graphs using its memory. Should be held from the input copies to
+     * the output ones. The lock is empty if the memory is not shared
+     */
+    std::unique_lock<std::mutex> lockSharedWorkspace() {
+        return workspaceAllocation ? workspaceAllocation->lock() : std::unique_lock<std::mutex>();
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -183,6 +220,10 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executionLevels.clear();
+        nodeLevels.clear();
+        memoryPlan = {};
+        workspaceAllocation.reset();
         _normalizePreprocMap.clear();
     }
     Status status { NotReady };
@@ -195,12 +236,24 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MemoryPlan memoryPlan;
+
+    MKLDNNSharedWorkspace::Ptr sharedWorkspace;
+    int sharedWorkspaceStream = 0;
+    // the part of the shared memory used instead of memWorkspace
+    std::shared_ptr<MKLDNNSharedWorkspace::Allocation> workspaceAllocation;
 
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Dataflow execution: nodes grouped by the length of the longest path to them from the graph inputs.
+    // Nodes of one level do not depend on each other, so they are executed concurrently
+    std::vector<std::vector<MKLDNNNodePtr>> executionLevels;
+    // Levels of the nodes indexed by execIndex. They are the time line of the memory solver in this mode
+    std::vector<int> nodeLevels;
+
     std::map<std::string, NormalizePreprocess> _normalizePreprocMap;
     std::string _name;
 
@@ -213,8 +266,14 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    /**
+     * @brief Reselects the primitive descriptors of the nodes to minimize the number of the Reorder nodes graph-wide.
+     * Is applied only when enabled by the configuration (see KEY_CPU_GLOBAL_LAYOUT_SELECTION).
+     */
+    void SelectPrimitiveDescriptorsGlobally();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void BuildExecutionLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
@@ -11,12 +11,14 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include <nodes/mkldnn_transpose_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_rnn.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -41,6 +43,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "mkldnn_itt.h"
 
@@ -51,7 +54,18 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndFP16Weights");
+    FuseEltwiseAndFP16Weights(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "SetSparseWeightsToFullyConnected");
+    SetSparseWeightsToFullyConnected(graph);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -75,6 +89,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FusePerformedAsScaleShiftAndFakeQuantize(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "SetQuantizedInputToRNN");
+    SetQuantizedInputToRNN(graph);
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndZeroPoints");
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
@@ -260,6 +277,234 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndBias(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstantInput = [](const MKLDNNNodePtr& node, Precision precision) {
+        return node->getType() == Input && node->isConstant() && node->getOriginalOutputPrecisionAtPort(0) == precision &&
+               dynamic_cast<MKLDNNInputNode*>(node.get()) != nullptr;
+    };
+
+    auto isSuitableEltwise = [](const MKLDNNNodePtr& node, Algorithm algorithm) {
+        return node->getType() == Eltwise && node->getAlgorithm() == algorithm && node->getFusedWith().empty() &&
+               node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1;
+    };
+
+    // Reads the constant of the eltwise as the values per output channel and group of [O, K] or [O, G, K / G] weights
+    auto readPerChannel = [&](const MKLDNNNodePtr& eltwise, const SizeVector& weightsDims, std::vector<float>& values) {
+        const auto constant = eltwise->getParentEdgesAtPort(1)[0]->getParent();
+        if (!isConstantInput(constant, Precision::FP32))
+            return false;
+
+        const auto dims = getNormalizedDimsBySize(eltwise->getParentEdgesAtPort(1)[0]->getDims().ToSizeVector(), weightsDims.size());
+        if (dims.size() != weightsDims.size() || dims.back() != 1)
+            return false;
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (dims[i] != 1 && dims[i] != weightsDims[i])
+                return false;
+        }
+
+        const auto data = static_cast<const float*>(dynamic_cast<MKLDNNInputNode*>(constant.get())->getMemoryPtr()->GetPtr());
+        const size_t O = weightsDims[0];
+        const size_t G = weightsDims.size() == 3 ? weightsDims[1] : 1;
+        values.resize(O * G);
+        for (size_t o = 0; o < O; o++) {
+            for (size_t g = 0; g < G; g++) {
+                values[o * G + g] = data[(dims[0] == 1 ? 0 : o) * (G == 1 ? 1 : dims[1]) + (G == 1 || dims[1] == 1 ? 0 : g)];
+            }
+        }
+        return true;
+    };
+
+    // For the bigger batches the computations dominate over the weights reading, so the weights are decompressed once
+    // by the constant nodes and the inner product primitive is used
+    const size_t maxBatchForDecompression = 64;
+
+    for (auto& node : graphNodes) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode || !fcNode->getFusedWith().empty() || !one_of(fcNode->getParentEdgeAt(0)->getDims().ndims(), 2, 3))
+            continue;
+        const auto srcDims = fcNode->getParentEdgeAt(0)->getDims().ToSizeVector();
+        if (std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>()) > maxBatchForDecompression)
+            continue;
+
+        // Input(fp16) -> Convert -> FullyConnected
+        auto parent = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (parent->getType() == Convert && parent->getChildEdges().size() == 1 &&
+            isConstantInput(parent->getParentEdgesAtPort(0)[0]->getParent(), Precision::FP16)) {
+            const auto convert = parent;
+            const auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+            const auto weightsDims = convert->getParentEdgesAtPort(0)[0]->getDims().ToSizeVector();
+            if (weightsDims != SizeVector{fcNode->getChildEdgeAt(0)->getDims().ToSizeVector().back(), srcDims.back()})
+                continue;
+
+            fcNode->setWeightsDecompression(dynamic_cast<MKLDNNInputNode*>(weights.get())->getMemoryPtr(), {}, {}, 1);
+            graph.DropNode(convert);
+            fcNode->addOriginalLayer(convert->getOriginalLayers());
+            fcNode->setOriginalInputPrecisionAtPort(1, Precision::FP16);
+            continue;
+        }
+
+        // Input(u8/i8) -> Convert -> [Subtract] -> Multiply -> [Reshape] -> FullyConnected
+        MKLDNNNodePtr reshape;
+        if (parent->getType() == Reshape && parent->getChildEdges().size() == 1) {
+            reshape = parent;
+            parent = reshape->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        const auto multiply = parent;
+        if (!isSuitableEltwise(multiply, EltwiseMultiply))
+            continue;
+        parent = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        MKLDNNNodePtr subtract;
+        if (isSuitableEltwise(parent, EltwiseSubtract)) {
+            subtract = parent;
+            parent = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        const auto convert = parent;
+        if (convert->getType() != Convert || convert->getChildEdges().size() != 1)
+            continue;
+        const auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstantInput(weights, Precision::U8) && !isConstantInput(weights, Precision::I8))
+            continue;
+
+        const auto weightsDims = convert->getParentEdgesAtPort(0)[0]->getDims().ToSizeVector();
+        const size_t O = fcNode->getChildEdgeAt(0)->getDims().ToSizeVector().back();
+        const size_t K = srcDims.back();
+        const bool perChannel = !reshape && weightsDims.size() == 2 && weightsDims[0] == O && weightsDims[1] == K;
+        const bool grouped = reshape && weightsDims.size() == 3 && weightsDims[0] == O && weightsDims[1] * weightsDims[2] == K;
+        if (!perChannel && !grouped)
+            continue;
+
+        std::vector<float> scales, zeroPoints;
+        if (!readPerChannel(multiply, weightsDims, scales) || (subtract && !readPerChannel(subtract, weightsDims, zeroPoints)))
+            continue;
+
+        const auto weightsPrecision = weights->getOriginalOutputPrecisionAtPort(0);
+        fcNode->setWeightsDecompression(dynamic_cast<MKLDNNInputNode*>(weights.get())->getMemoryPtr(), std::move(scales), std::move(zeroPoints),
+                                        grouped ? weightsDims[1] : 1);
+
+        for (const auto& decompressionNode : {multiply, subtract}) {
+            if (!decompressionNode)
+                continue;
+            auto constantEdge = decompressionNode->getParentEdgesAtPort(1)[0];
+            constantEdge->drop();
+            graph.RemoveEdge(constantEdge);
+            graph.DropNode(decompressionNode);
+            fcNode->addOriginalLayer(decompressionNode->getOriginalLayers());
+        }
+        graph.DropNode(convert);
+        fcNode->addOriginalLayer(convert->getOriginalLayers());
+
+        // the compressed weights pass through the Reshape which groups the input channels
+        if (reshape) {
+            reshape->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshape->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseEltwiseAndFP16Weights(MKLDNNGraph &graph) {
+    // the Eltwise JIT kernels read FP16 inputs with F16C instructions
+    if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx2))
+        return;
+
+    auto& graphNodes = graph.GetNodes();
+
+    // Input(fp16) -> Convert -> Eltwise: the constant is converted by the Eltwise while it is read instead of
+    // being converted to FP32 once on the network loading
+    for (auto& node : graphNodes) {
+        if (node->getType() != Convert || node->getChildEdges().size() != 1 ||
+            node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        const auto weights = node->getParentEdgesAtPort(0)[0]->getParent();
+        if (weights->getType() != Input || !weights->isConstant() || weights->getOriginalOutputPrecisionAtPort(0) != Precision::FP16)
+            continue;
+        // the Eltwise uses the planar layout for the inputs up to 3D, so the FP16 constant is not reordered
+        const auto childEdge = node->getChildEdgeAt(0);
+        const auto eltwise = childEdge->getChild();
+        if (eltwise->getType() != Eltwise || !eltwise->getFusedWith().empty() || childEdge->getDims().ndims() > 3)
+            continue;
+
+        const int port = childEdge->getOutputNum();
+        graph.DropNode(node);
+        eltwise->addOriginalLayer(node->getOriginalLayers());
+        eltwise->setOriginalInputPrecisionAtPort(port, Precision::FP16);
+    }
+}
+
+void MKLDNNGraphOptimizer::SetSparseWeightsToFullyConnected(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (auto& node : graphNodes) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode || fcNode->withWeightsDecompression() || !fcNode->getFusedWith().empty() ||
+            !one_of(fcNode->getParentEdgeAt(0)->getDims().ndims(), 2, 3) ||
+            !one_of(fcNode->getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+            continue;
+
+        const auto weights = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (weights->getType() != Input || !weights->isConstant() || weights->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+            fcNode->getParentEdgesAtPort(1)[0]->getDims().ndims() != 2)
+            continue;
+        auto inputNode = dynamic_cast<MKLDNNInputNode*>(weights.get());
+        if (!inputNode)
+            continue;
+
+        // the operations which FuseFullyConnectedAndSimpleOperation would fuse into the dense inner product
+        size_t fusableOperations = 0;
+        if (fcNode->getParentEdgeAt(0)->getDims().ndims() != 3) {
+            MKLDNNNodePtr last = fcNode;
+            while (last->getChildEdges().size() == 1 && fcNode->canFuse(last->getChildEdgeAt(0)->getChild())) {
+                last = last->getChildEdgeAt(0)->getChild();
+                fusableOperations++;
+            }
+        }
+
+        // the node keeps using the inner product primitive when the weights are not sparse enough
+        fcNode->setSparseWeights(inputNode->getMemoryPtr(), fusableOperations);
+    }
+}
+
+void MKLDNNGraphOptimizer::SetQuantizedInputToRNN(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isPerTensor = [](const std::vector<float>& values) {
+        return values.size() == 1;
+    };
+
+    for (auto& node : graphNodes) {
+        auto rnnNode = std::dynamic_pointer_cast<MKLDNNRNN>(node);
+        if (!rnnNode || !rnnNode->canBeQuantized() ||
+            !one_of(rnnNode->getOriginalInputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+            continue;
+
+        const auto parent = rnnNode->getParentEdgesAtPort(0)[0]->getParent();
+        auto fakeQuantize = std::dynamic_pointer_cast<MKLDNNFakeQuantizeNode>(parent);
+        if (!fakeQuantize || fakeQuantize->isBinarization() || fakeQuantize->getLevels() != 256 ||
+            fakeQuantize->getChildEdges().size() != 1 || !fakeQuantize->getFusedWith().empty())
+            continue;
+
+        // the primitive has a single scale and shift of the layer input
+        if (!isPerTensor(fakeQuantize->getCropLow()) || !isPerTensor(fakeQuantize->getCropHigh()) ||
+            !isPerTensor(fakeQuantize->getInputScale()) || !isPerTensor(fakeQuantize->getInputShift()) ||
+            !isPerTensor(fakeQuantize->getOutputScale()) || !isPerTensor(fakeQuantize->getOutputShift()) ||
+            fakeQuantize->getOutputScale()[0] <= 0.f)
+            continue;
+
+        // FakeQuantize produces the quantized values and the RNN restores their range as (q - shift) / scale
+        const float outputScale = fakeQuantize->getOutputScale()[0];
+        const float outputShift = fakeQuantize->getOutputShift()[0];
+        rnnNode->setDataQuantization(1.f / outputScale, -outputShift / outputScale);
+        rnnNode->setOriginalInputPrecisionAtPort(0, Precision::U8);
+
+        fakeQuantize->setOutputScale({1.f});
+        fakeQuantize->setOutputShift({0.f});
+        fakeQuantize->setOriginalOutputPrecisionAtPort(0, Precision::U8);
+        fakeQuantize->setOutputPrecision(Precision::U8);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -34,6 +34,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    dynamicShapes = static_cast<bool>(execNetwork->_specializer);
 
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
@@ -106,9 +107,19 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
         auto inPrec = input.second->getTensorDesc().getPrecision();
-        if (graph->hasMeanImageFor(input.first) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
+
+        // User can initialize input via setBlob API using tensorDesc with default (ANY) layout.
+        // Currently IE doesn't specify behavior in such scenario, so we assume real layout is equal to the network input.
+        if (input.second->getTensorDesc().getLayout() == InferenceEngine::ANY) {
+            input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
+        }
+
+        // the graph converts the data to FP32 itself while normalizing, so no intermediate blob is needed in that case
+        const bool fusedNormalization = graph->canFuseInputNormalization(input.first, input.second->getTensorDesc());
+        if (!fusedNormalization && graph->hasMeanImageFor(input.first) &&
+                one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
             inPrec = InferenceEngine::Precision::FP32;
-        } else {
+        } else if (!fusedNormalization) {
             inPrec = normalizeToSupportedPrecision(inPrec);
         }
 
@@ -116,12 +127,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             IE_THROW() << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
         }
 
-        // User can initialize input via setBlob API using tensorDesc with default (ANY) layout.
-        // Currently IE doesn't specify behavior in such scenario, so we assume real layout is equal to the network input.
-        if (input.second->getTensorDesc().getLayout() == InferenceEngine::ANY) {
-            input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
-        }
-
         pushInput(input.first, input.second, inPrec);
     }
 }
@@ -175,6 +180,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     execDataPreprocessing(_inputs);
 
+    std::unique_ptr<MKLDNNResultCache::Key> resultCacheKey;
+    if (execNetwork->_resultCache) {
+        resultCacheKey.reset(new MKLDNNResultCache::Key(_inputs, m_curBatch));
+        if (resultCacheKey->valid() && PullCachedOutputs(*resultCacheKey))
+            return;
+    }
+
+    if (dynamicShapes) {
+        std::map<std::string, InferenceEngine::SizeVector> inputShapes;
+        for (const auto& input : _inputs) {
+            inputShapes[input.first] = input.second->getTensorDesc().getDims();
+        }
+        const std::map<std::string, InferenceEngine::SizeVector>* outputShapes = nullptr;
+        graph = &(execNetwork->GetGraphForShapes(graphLock, inputShapes, outputShapes, specializedGraph));
+        reallocateOutputs(*outputShapes);
+    }
+
+    // the memory shared with other networks is owned by this request until the outputs are copied
+    auto workspaceLock = graph->lockSharedWorkspace();
+
     changeDefaultPtr();
 
     ThrowIfCanceled();
@@ -194,6 +219,36 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
+
+    if (resultCacheKey && resultCacheKey->valid()) {
+        execNetwork->_resultCache->insert(*resultCacheKey, _outputs);
+    }
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::PullCachedOutputs(const MKLDNNResultCache::Key& key) {
+    auto cachedOutputs = execNetwork->_resultCache->find(key);
+    if (!cachedOutputs)
+        return false;
+
+    if (dynamicShapes) {
+        std::map<std::string, InferenceEngine::SizeVector> outputShapes;
+        for (const auto& output : *cachedOutputs) {
+            outputShapes[output.first] = output.second->getTensorDesc().getDims();
+        }
+        reallocateOutputs(outputShapes);
+    }
+    // the output blobs set by the user may have other precisions or layouts than the ones the outputs were cached in
+    for (const auto& output : *cachedOutputs) {
+        auto it = _outputs.find(output.first);
+        if (it == _outputs.end() || !InferenceEngine::as<InferenceEngine::MemoryBlob>(it->second) ||
+            it->second->getTensorDesc() != output.second->getTensorDesc())
+            return false;
+    }
+    for (const auto& output : *cachedOutputs) {
+        auto dst = InferenceEngine::as<InferenceEngine::MemoryBlob>(_outputs[output.first]);
+        cpu_memcpy(dst->buffer().as<uint8_t*>(), output.second->cbuffer().as<const uint8_t*>(), output.second->byteSize());
+    }
+    return true;
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
@@ -235,13 +290,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
             _inputs[name] = make_blob_with_precision(desc);
             _inputs[name]->allocate();
-            if (blobs[name]->getTensorDesc() == desc &&
+            if (blobs[name]->getTensorDesc() == desc && !dynamicShapes &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
             }
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        checkBlob(data, name, true, dynamicShapes ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
         // check if preprocess required, but still wasn't set
         auto preProcessedInput = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
             [&](const std::pair<std::string, InferenceEngine::InputInfo::Ptr>& pair)
@@ -295,12 +350,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             }
 
             _outputs[name] = data;
-            if (!externalPtr.count(name) && data->getTensorDesc() == blobs[name]->getTensorDesc() && !graph->getProperty().batchLimit) {
+            if (!externalPtr.count(name) && data->getTensorDesc() == blobs[name]->getTensorDesc() && !dynamicShapes &&
+                !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             }
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkBlob(data, name, false, dynamicShapes ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
     }
     if (!data) {
         IE_THROW() << "Cannot find blob with name: " << name;
@@ -349,21 +405,34 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                IE_THROW() << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            if (dynamicShapes) {
+                // any dimensions of the same rank and layout are accepted, the graph for them is chosen in InferImpl
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Rank mismatch.";
+                }
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Layout mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    IE_THROW() << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
-            }
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
+                }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
             }
 
             InferenceEngine::BlobMap blobs;
@@ -371,7 +440,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             if (blobs.find(name) == blobs.end())
                 IE_THROW() << "MKLDNN graph doesn't contain input node with name: " << name;
 
-            if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() &&
+            if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() && !dynamicShapes &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -389,19 +458,27 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW(ParameterMismatch) << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            IE_THROW() << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+        if (dynamicShapes) {
+            // the blob is replaced by a new one in InferImpl if its dimensions do not match the inference output
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output blob. Rank mismatch.";
+            }
+        } else {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                IE_THROW() << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
 
         InferenceEngine::BlobMap blobs;
@@ -409,7 +486,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
         if (blobs.find(name) == blobs.end())
             IE_THROW() << "MKLDNN graph doesn't contain output node with name: " << name;
 
-        if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() &&
+        if (data->getTensorDesc() == blobs.at(name)->getTensorDesc() && !dynamicShapes &&
                 !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -419,6 +496,34 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!dynamicShapes) {
+        IInferRequestInternal::checkBlobs();
+        return;
+    }
+    // the dimensions are checked against the network ones only by the rank in SetBlob
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::reallocateOutputs(const std::map<std::string, InferenceEngine::SizeVector>& outputShapes) {
+    for (const auto& outputShape : outputShapes) {
+        auto output = _outputs.find(outputShape.first);
+        if (output == _outputs.end() || output->second->getTensorDesc().getDims() == outputShape.second)
+            continue;
+        const auto& desc = output->second->getTensorDesc();
+        const auto layout = desc.getDims().size() == outputShape.second.size() && desc.getLayout() != InferenceEngine::Layout::BLOCKED
+            ? desc.getLayout()
+            : InferenceEngine::TensorDesc::getLayoutByDims(outputShape.second);
+        output->second = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), outputShape.second, layout));
+        output->second->allocate();
+    }
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_result_cache.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -32,6 +33,8 @@ public:
 
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
 
+    void checkBlobs() override;
+
     void SetBatch(int batch = -1) override;
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
@@ -51,15 +54,22 @@ private:
     void PushInputData();
     void PushStates();
     void PullStates();
+    // returns false if the outputs of the inputs are not cached, so the graph has to be inferred
+    bool PullCachedOutputs(const MKLDNNResultCache::Key& key);
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    void reallocateOutputs(const std::map<std::string, InferenceEngine::SizeVector>& outputShapes);
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    // input shapes may differ from the network ones, each shape is executed by its own specialized graph
+    bool                                dynamicShapes = false;
+    // owns `graph` when it is a specialized graph, so the graph outlives its eviction from the stream cache
+    std::shared_ptr<MKLDNNGraph>        specializedGraph;
 };
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,323 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_selector.h"
+
+#include "mkldnn_extension_utils.h"
+#include "mkldnn_itt.h"
+#include "utils/general_utils.h"
+
+#include <algorithm>
+#include <functional>
+#ifdef CPU_DEBUG_CAPS
+#include <iostream>
+#endif
+#include <limits>
+#include <numeric>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// The costs are measured in the bytes of the memory traffic.
+// Every step down the list of the implementation priorities is considered as the additional pass over the data of the node
+constexpr double implRankPenalty = 16.0;
+// Reorder reads and writes the whole tensor and has the fixed overhead of the primitive execution
+constexpr double reorderBytesFactor = 2.0;
+constexpr double reorderOverhead = 1024.0;
+// Every refinement sweep never increases the cost, the limit only bounds the compilation time
+constexpr size_t maxRefinementSweeps = 4;
+
+size_t getBytes(const TensorDesc& desc) {
+    const auto& dims = desc.getDims();
+    return std::accumulate(dims.begin(), dims.end(), desc.getPrecision().size(), std::multiplies<size_t>());
+}
+
+// Nodes with the custom selection logic (in-place memory, graph inputs and outputs) keep their greedy selection
+bool hasFixedDescriptor(const MKLDNNNodePtr& node) {
+    return one_of(node->getType(), Input, Output, Reorder, Concatenation, Split, MemoryInput, MemoryOutput, TensorIterator) ||
+           node->isConstant();
+}
+
+}  // namespace
+
+void MKLDNNLayoutSelector::initNodes(MKLDNNGraph& graph) {
+    const auto& graphNodes = graph.GetNodes();
+    nodes.clear();
+    nodeIndices.clear();
+    nodes.reserve(graphNodes.size());
+
+    for (const auto& node : graphNodes) {
+        NodeInfo info;
+        info.node = node;
+        nodeIndices[node.get()] = nodes.size();
+
+        const auto& descs = node->getSupportedPrimitiveDescriptors();
+        const auto* selectedDesc = node->getSelectedPrimitiveDescriptor();
+        if (selectedDesc == nullptr) {
+            nodes.push_back(info);
+            continue;
+        }
+        const int selectedIdx = static_cast<int>(selectedDesc - descs.data());
+
+        const auto& priority = node->getPrimitivesPriority();
+        auto getRank = [&](impl_desc_type type) {
+            return static_cast<size_t>(std::distance(priority.begin(), std::find(priority.begin(), priority.end(), type)));
+        };
+        if (!hasFixedDescriptor(node) && getRank(selectedDesc->getImplementationType()) < priority.size()) {
+            for (int i = 0; i < static_cast<int>(descs.size()); i++) {
+                if (getRank(descs[i].getImplementationType()) < priority.size() &&
+                    descs[i].getConfig().inConfs.size() <= node->getParentEdges().size())
+                    info.candidates.push_back(i);
+            }
+        }
+        if (std::find(info.candidates.begin(), info.candidates.end(), selectedIdx) == info.candidates.end())
+            info.candidates = {selectedIdx};
+        info.selected = std::distance(info.candidates.begin(),
+                                      std::find(info.candidates.begin(), info.candidates.end(), selectedIdx));
+
+        // the best implementation type available for the node has zero execution cost
+        std::vector<size_t> ranks;
+        for (auto idx : info.candidates)
+            ranks.push_back(getRank(descs[idx].getImplementationType()));
+        std::vector<size_t> distinctRanks = ranks;
+        std::sort(distinctRanks.begin(), distinctRanks.end());
+        distinctRanks.erase(std::unique(distinctRanks.begin(), distinctRanks.end()), distinctRanks.end());
+
+        for (size_t c = 0; c < info.candidates.size(); c++) {
+            const auto& config = descs[info.candidates[c]].getConfig();
+            size_t bytes = 0;
+            for (const auto& inConf : config.inConfs)
+                bytes += getBytes(inConf.desc);
+            for (const auto& outConf : config.outConfs)
+                bytes += getBytes(outConf.desc);
+            const auto rank = std::distance(distinctRanks.begin(), std::find(distinctRanks.begin(), distinctRanks.end(), ranks[c]));
+            info.costs.push_back(implRankPenalty * rank * bytes);
+        }
+        nodes.push_back(info);
+    }
+
+    edges.clear();
+    inEdges.assign(nodes.size(), {});
+    outEdges.assign(nodes.size(), {});
+    for (const auto& edge : graph.GetEdges()) {
+        const auto parent = edge->getParent();
+        const auto child = edge->getChild();
+        if (!parent || !child || parent->isConstant())
+            continue;
+        const auto parentIt = nodeIndices.find(parent.get());
+        const auto childIt = nodeIndices.find(child.get());
+        if (parentIt == nodeIndices.end() || childIt == nodeIndices.end() ||
+            nodes[parentIt->second].candidates.empty() || nodes[childIt->second].candidates.empty())
+            continue;
+
+        inEdges[childIt->second].push_back(edges.size());
+        outEdges[parentIt->second].push_back(edges.size());
+        edges.push_back({edge, parentIt->second, childIt->second});
+    }
+}
+
+size_t MKLDNNLayoutSelector::reorderBytes(const EdgeInfo& edge, size_t parentCandidate, size_t childCandidate) const {
+    const auto& parent = nodes[edge.parent];
+    const auto& child = nodes[edge.child];
+    const auto& outConfs = parent.node->getSupportedPrimitiveDescriptors()[parent.candidates[parentCandidate]].getConfig().outConfs;
+    const auto& inConfs = child.node->getSupportedPrimitiveDescriptors()[child.candidates[childCandidate]].getConfig().inConfs;
+    if (outConfs.empty())
+        return 0;
+
+    int inNum = edge.edge->getInputNum();
+    if (inNum < 0 || inNum >= outConfs.size())
+        inNum = 0;
+    const int outNum = edge.edge->getOutputNum();
+    if (outNum < 0 || outNum >= inConfs.size())
+        return 0;
+
+    const auto& parentDesc = outConfs[inNum].desc;
+    return MKLDNNExtensionUtils::initTensorsAreEqual(parentDesc, inConfs[outNum].desc) ? 0 : getBytes(parentDesc);
+}
+
+double MKLDNNLayoutSelector::edgeCost(const EdgeInfo& edge, size_t parentCandidate, size_t childCandidate) const {
+    const size_t bytes = reorderBytes(edge, parentCandidate, childCandidate);
+    return bytes == 0 ? 0.0 : reorderOverhead + reorderBytesFactor * bytes;
+}
+
+double MKLDNNLayoutSelector::localCost(size_t nodeIdx, size_t candidate, const std::vector<size_t>& selection) const {
+    double cost = nodes[nodeIdx].costs[candidate];
+    for (auto e : inEdges[nodeIdx])
+        cost += edgeCost(edges[e], selection[edges[e].parent], candidate);
+    for (auto e : outEdges[nodeIdx])
+        cost += edgeCost(edges[e], candidate, selection[edges[e].child]);
+    return cost;
+}
+
+double MKLDNNLayoutSelector::totalCost(const std::vector<size_t>& selection) const {
+    double cost = 0.0;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (!nodes[i].candidates.empty())
+            cost += nodes[i].costs[selection[i]];
+    }
+    for (const auto& edge : edges)
+        cost += edgeCost(edge, selection[edge.parent], selection[edge.child]);
+    return cost;
+}
+
+/*
+ * Every node is attached to the first of its non-constant parents, which makes the spanning forest of the graph.
+ * The minimal cost of the subtree of every node is computed for each candidate of the node bottom-up
+ * (the nodes are sorted topologically, so the children of the forest follow their parents), then the candidates
+ * are assigned top-down from the roots. All the edges between the node and its parent in the forest are taken
+ * into account, the other edges are left for the refinement.
+ */
+std::vector<size_t> MKLDNNLayoutSelector::solveSpanningForest() const {
+    const size_t nodesNum = nodes.size();
+    const size_t noParent = std::numeric_limits<size_t>::max();
+
+    std::vector<size_t> treeParent(nodesNum, noParent);
+    std::vector<std::vector<size_t>> treeChildren(nodesNum);
+    for (size_t i = 0; i < nodesNum; i++) {
+        for (auto e : inEdges[i]) {
+            const auto parent = edges[e].parent;
+            if (parent < i) {
+                treeParent[i] = parent;
+                treeChildren[parent].push_back(i);
+                break;
+            }
+        }
+    }
+
+    // subtreeCosts[i][c] - the minimal cost of the subtree of the node i if its candidate c is selected
+    std::vector<std::vector<double>> subtreeCosts(nodesNum);
+    // choices[i][c] - the best candidate of the node i if the candidate c of its parent in the forest is selected
+    std::vector<std::vector<size_t>> choices(nodesNum);
+    for (size_t i = nodesNum; i-- > 0;) {
+        const auto& node = nodes[i];
+        if (node.candidates.empty())
+            continue;
+        subtreeCosts[i] = node.costs;
+        for (auto child : treeChildren[i]) {
+            const auto& childNode = nodes[child];
+            auto& childChoices = choices[child];
+            childChoices.assign(node.candidates.size(), childNode.selected);
+            for (size_t c = 0; c < node.candidates.size(); c++) {
+                auto childCost = [&](size_t cc) {
+                    double cost = subtreeCosts[child][cc];
+                    for (auto e : inEdges[child]) {
+                        if (edges[e].parent == i)
+                            cost += edgeCost(edges[e], c, cc);
+                    }
+                    return cost;
+                };
+                // the greedy choice wins the ties
+                double bestCost = childCost(childNode.selected);
+                for (size_t cc = 0; cc < childNode.candidates.size(); cc++) {
+                    const double cost = childCost(cc);
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        childChoices[c] = cc;
+                    }
+                }
+                subtreeCosts[i][c] += bestCost;
+            }
+        }
+    }
+
+    std::vector<size_t> selection(nodesNum, 0);
+    for (size_t i = 0; i < nodesNum; i++) {
+        const auto& node = nodes[i];
+        if (node.candidates.empty())
+            continue;
+        if (treeParent[i] != noParent) {
+            selection[i] = choices[i][selection[treeParent[i]]];
+            continue;
+        }
+        selection[i] = node.selected;
+        for (size_t c = 0; c < node.candidates.size(); c++) {
+            if (subtreeCosts[i][c] < subtreeCosts[i][selection[i]])
+                selection[i] = c;
+        }
+    }
+    return selection;
+}
+
+// Iterated conditional modes: every node selects the best candidate for the fixed selection of its neighbours
+void MKLDNNLayoutSelector::refine(std::vector<size_t>& selection) const {
+    for (size_t sweep = 0; sweep < maxRefinementSweeps; sweep++) {
+        bool sweepChanged = false;
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (nodes[i].candidates.size() < 2)
+                continue;
+            double bestCost = localCost(i, selection[i], selection);
+            for (size_t c = 0; c < nodes[i].candidates.size(); c++) {
+                const double cost = localCost(i, c, selection);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    selection[i] = c;
+                    sweepChanged = true;
+                }
+            }
+        }
+        if (!sweepChanged)
+            break;
+    }
+}
+
+void MKLDNNLayoutSelector::collectStatistics(const std::vector<size_t>& selection, size_t& reorders, size_t& bytes) const {
+    reorders = 0;
+    bytes = 0;
+    for (const auto& edge : edges) {
+        const size_t edgeBytes = reorderBytes(edge, selection[edge.parent], selection[edge.child]);
+        if (edgeBytes != 0) {
+            reorders++;
+            bytes += edgeBytes;
+        }
+    }
+}
+
+MKLDNNLayoutSelector::Statistics MKLDNNLayoutSelector::SelectPrimitiveDescriptors(MKLDNNGraph& graph) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNLayoutSelector::SelectPrimitiveDescriptors");
+    initNodes(graph);
+
+    std::vector<size_t> greedySelection(nodes.size(), 0);
+    bool hasAlternatives = false;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        greedySelection[i] = nodes[i].selected;
+        hasAlternatives |= nodes[i].candidates.size() > 1;
+    }
+
+    Statistics statistics;
+    collectStatistics(greedySelection, statistics.reordersBefore, statistics.bytesBefore);
+
+    std::vector<size_t> selection = greedySelection;
+    if (hasAlternatives) {
+        auto globalSelection = solveSpanningForest();
+        refine(globalSelection);
+        if (totalCost(globalSelection) < totalCost(greedySelection))
+            selection = globalSelection;
+    }
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (selection[i] != greedySelection[i])
+            nodes[i].node->selectPrimitiveDescriptorByIndex(nodes[i].candidates[selection[i]]);
+    }
+    collectStatistics(selection, statistics.reordersAfter, statistics.bytesAfter);
+
+    nodes.clear();
+    nodeIndices.clear();
+    edges.clear();
+    inEdges.clear();
+    outEdges.clear();
+    ENABLE_CPU_DEBUG_CAP(printStatistics(graph, statistics));
+    return statistics;
+}
+
+#ifdef CPU_DEBUG_CAPS
+void MKLDNNLayoutSelector::printStatistics(MKLDNNGraph& graph, const Statistics& statistics) {
+    if (graph.getConfig().debugCaps.layoutSelectionStatistics.empty())
+        return;
+
+    std::cout << "Layout selection for " << graph.GetName() << ": reorders " << statistics.reordersBefore << " -> "
+              << statistics.reordersAfter << ", bytes moved " << statistics.bytesBefore << " -> " << statistics.bytesAfter << std::endl;
+}
+#endif
@@ -0,0 +1,80 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+#include "utils/debug_capabilities.h"
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Graph-wide selection of the primitive descriptors.
+ * Every node selects its primitive descriptor greedily from the descriptors of the already processed parents,
+ * so the layouts which are preferable for the consumers are not taken into account and the Reorder nodes are
+ * inserted between the nodes with the different layouts. The selector starts from the greedy selection and
+ * minimizes the modelled cost of the whole graph: the execution cost of the node depends on the implementation
+ * type of the descriptor, the cost of the edge is the cost of the Reorder, which is needed when the output
+ * descriptor of the parent differs from the input descriptor of the child.
+ * The problem is solved exactly by the dynamic programming over the spanning forest of the graph, the rest of
+ * the edges (residual connections, shared inputs) are taken into account by the local refinement afterwards.
+ * The new selection is applied only when its cost is lower than the cost of the greedy one.
+ */
+class MKLDNNLayoutSelector {
+public:
+    struct Statistics {
+        // Reorders and the bytes moved by them on the non-constant edges, modelled from the selected descriptors
+        size_t reordersBefore = 0;
+        size_t bytesBefore = 0;
+        size_t reordersAfter = 0;
+        size_t bytesAfter = 0;
+    };
+
+    /**
+     * @brief Reselects the primitive descriptors of the graph nodes.
+     * The statistics are also printed when requested by the debug capabilities (OV_CPU_LAYOUT_SELECTION_STATISTICS)
+     */
+    Statistics SelectPrimitiveDescriptors(MKLDNNGraph& graph);
+
+private:
+    struct NodeInfo {
+        MKLDNNNodePtr node;
+        // indices of the supported primitive descriptors which may be selected
+        std::vector<int> candidates;
+        std::vector<double> costs;
+        // position of the selected descriptor in the candidates
+        size_t selected = 0;
+    };
+
+    struct EdgeInfo {
+        MKLDNNEdgePtr edge;
+        size_t parent;
+        size_t child;
+    };
+
+    void initNodes(MKLDNNGraph& graph);
+    // returns the size of the tensor which is reordered on the edge, zero if the descriptors match
+    size_t reorderBytes(const EdgeInfo& edge, size_t parentCandidate, size_t childCandidate) const;
+    double edgeCost(const EdgeInfo& edge, size_t parentCandidate, size_t childCandidate) const;
+    double localCost(size_t nodeIdx, size_t candidate, const std::vector<size_t>& selection) const;
+    double totalCost(const std::vector<size_t>& selection) const;
+    std::vector<size_t> solveSpanningForest() const;
+    void refine(std::vector<size_t>& selection) const;
+    void collectStatistics(const std::vector<size_t>& selection, size_t& reorders, size_t& bytes) const;
+#ifdef CPU_DEBUG_CAPS
+    static void printStatistics(MKLDNNGraph& graph, const Statistics& statistics);
+#endif
+
+    std::vector<NodeInfo> nodes;
+    std::unordered_map<const MKLDNNNode*, size_t> nodeIndices;
+    // non-constant edges, the reorders on the constant ones are executed once on the network loading
+    std::vector<EdgeInfo> edges;
+    // indices of the edges grouped by the child and by the parent
+    std::vector<std::vector<size_t>> inEdges;
+    std::vector<std::vector<size_t>> outEdges;
+};
+
+}  // namespace MKLDNNPlugin
@@ -15,6 +15,7 @@
 #include <mkldnn_types.h>
 #include <dnnl_types.h>
 #include "mkldnn_memory.h"
+#include "mkldnn_memory_allocator.h"
 #include "mkldnn_extension_utils.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -61,6 +62,16 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
     if (data == nullptr) {
+        auto allocator = MKLDNNMemoryAllocator::current();
+        if (allocator != nullptr && desc.data.format_kind != dnnl_format_kind_wino) {
+            auto buffer = allocator->allocate(desc.get_size());
+            if (buffer) {
+                // the primitive may be shared by the nodes, so it owns the buffer
+                prim.reset(new memory(desc, eng, DNNL_MEMORY_NONE), [buffer](memory* mem) { delete mem; });
+                prim->set_data_handle(buffer.get());
+                return;
+            }
+        }
         prim.reset(new memory(desc, eng));
 
         size_t real_size = 0;
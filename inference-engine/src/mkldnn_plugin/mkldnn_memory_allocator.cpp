@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_allocator.h"
+#include "utils/general_utils.h"
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+thread_local MKLDNNMemoryAllocator* currentAllocator = nullptr;
+
+#if defined(__linux__)
+// Smaller buffers are served better by the default allocator which does not spend a whole page on them
+constexpr size_t minAllocationSize = 64 * 1024;
+constexpr size_t smallPageSize = 4 * 1024;
+constexpr size_t hugePageSize2MB = 2 * 1024 * 1024;
+constexpr size_t hugePageSize1GB = 1024 * 1024 * 1024;
+
+// Values from linux/mempolicy.h and linux/mman.h which may be missing in old system headers
+constexpr int mpolPreferred = 1;
+constexpr int mapHugeShift = 26;
+constexpr int madvHugePage = 14;
+
+int getCurrentNumaNode() {
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+        return -1;
+    return static_cast<int>(node);
+}
+
+bool bindToNumaNode(void* ptr, size_t size, int node) {
+    constexpr size_t maskBits = 1024;
+    constexpr size_t bitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+    if (node < 0 || static_cast<size_t>(node) >= maskBits)
+        return false;
+    unsigned long mask[maskBits / bitsPerWord] = {};  // NOLINT
+    mask[node / bitsPerWord] = 1ul << (node % bitsPerWord);
+    // the memory is preferred on the node, but can be taken from other nodes if it is exhausted
+    return syscall(SYS_mbind, ptr, size, mpolPreferred, mask, maskBits, 0) == 0;
+}
+#endif
+}  // namespace
+
+MKLDNNMemoryAllocator::Scope::Scope(MKLDNNMemoryAllocator* allocator) : previous(currentAllocator) {
+    currentAllocator = allocator;
+}
+
+MKLDNNMemoryAllocator::Scope::~Scope() {
+    currentAllocator = previous;
+}
+
+MKLDNNMemoryAllocator* MKLDNNMemoryAllocator::current() {
+    return currentAllocator;
+}
+
+MKLDNNMemoryAllocator::MKLDNNMemoryAllocator(bool numaLocal, Config::HugePagesMode hugePages)
+    : numaLocal(numaLocal)
+    , hugePages(hugePages)
+{}
+
+std::shared_ptr<void> MKLDNNMemoryAllocator::allocate(size_t size) {
+#if defined(__linux__)
+    if (size < minAllocationSize)
+        return nullptr;
+
+    void* ptr = MAP_FAILED;
+    size_t mappedSize = 0;
+    uint64_t hugePagesSize = 0, transparentSize = 0, numaLocalSize = 0;
+
+    // Explicit huge pages are taken only for buffers of at least a half of the page
+    const size_t explicitPageSize = hugePages == Config::HugePages1GB ? hugePageSize1GB
+                                  : hugePages == Config::HugePages2MB ? hugePageSize2MB : 0;
+    if (explicitPageSize != 0 && size >= explicitPageSize / 2) {
+        const int pageShift = explicitPageSize == hugePageSize1GB ? 30 : 21;
+        mappedSize = rnd_up(size, explicitPageSize);
+        ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (pageShift << mapHugeShift), -1, 0);
+        if (ptr != MAP_FAILED)
+            hugePagesSize = mappedSize;
+    }
+
+    if (ptr == MAP_FAILED) {
+        mappedSize = rnd_up(size, smallPageSize);
+        ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            return nullptr;
+        if (hugePages != Config::NoHugePages && mappedSize >= hugePageSize2MB &&
+            madvise(ptr, mappedSize, madvHugePage) == 0) {
+            transparentSize = mappedSize;
+        }
+    }
+
+    if (numaLocal && bindToNumaNode(ptr, mappedSize, getCurrentNumaNode())) {
+        numaLocalSize = mappedSize;
+        // the pages are faulted in now, so they are placed before the buffer is used from other threads
+        std::memset(ptr, 0, mappedSize);
+    }
+
+    allocations++;
+    auto allocated = (allocatedBytes += mappedSize);
+    auto peak = peakAllocatedBytes.load();
+    while (allocated > peak && !peakAllocatedBytes.compare_exchange_weak(peak, allocated)) {}
+    hugePagesBytes += hugePagesSize;
+    transparentHugePagesBytes += transparentSize;
+    numaLocalBytes += numaLocalSize;
+
+    // the buffer may outlive the executable network, so it keeps the allocator alive
+    auto self = shared_from_this();
+    return std::shared_ptr<void>(ptr, [self, mappedSize, hugePagesSize, transparentSize, numaLocalSize] (void* p) {
+        self->deallocate(p, mappedSize, hugePagesSize, transparentSize, numaLocalSize);
+    });
+#else
+    return nullptr;
+#endif
+}
+
+void MKLDNNMemoryAllocator::deallocate(void* ptr, size_t size, uint64_t hugePagesSize, uint64_t transparentSize,
+                                       uint64_t numaLocalSize) {
+#if defined(__linux__)
+    munmap(ptr, size);
+#endif
+    allocations--;
+    allocatedBytes -= size;
+    hugePagesBytes -= hugePagesSize;
+    transparentHugePagesBytes -= transparentSize;
+    numaLocalBytes -= numaLocalSize;
+}
+
+MKLDNNMemoryAllocator::Statistics MKLDNNMemoryAllocator::getStatistics() const {
+    Statistics statistics;
+    statistics.allocations = allocations.load();
+    statistics.allocatedBytes = allocatedBytes.load();
+    statistics.peakAllocatedBytes = peakAllocatedBytes.load();
+    statistics.hugePagesBytes = hugePagesBytes.load();
+    statistics.transparentHugePagesBytes = transparentHugePagesBytes.load();
+    statistics.numaLocalBytes = numaLocalBytes.load();
+    return statistics;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Allocates the memory of graphs with NUMA node binding and huge pages backing
+ *
+ * MKLDNNMemory objects created in a thread where an allocator Scope exists take their buffers from that allocator.
+ * Small buffers and the platforms without the support are left to the default allocation.
+ *
+ * Is a thread safe
+ */
+class MKLDNNMemoryAllocator : public std::enable_shared_from_this<MKLDNNMemoryAllocator> {
+public:
+    typedef std::shared_ptr<MKLDNNMemoryAllocator> Ptr;
+
+    struct Statistics {
+        uint64_t allocations = 0;                // buffers in use
+        uint64_t allocatedBytes = 0;
+        uint64_t peakAllocatedBytes = 0;
+        uint64_t hugePagesBytes = 0;             // explicit huge pages in use
+        uint64_t transparentHugePagesBytes = 0;  // memory advised to be backed by transparent huge pages
+        uint64_t numaLocalBytes = 0;             // memory bound to the NUMA node of the allocating thread
+    };
+
+    /**
+     * Makes the allocator used in the current thread until the scope is destroyed
+     */
+    class Scope {
+    public:
+        explicit Scope(MKLDNNMemoryAllocator* allocator);
+        ~Scope();
+
+    private:
+        MKLDNNMemoryAllocator* previous;
+    };
+
+    MKLDNNMemoryAllocator(bool numaLocal, Config::HugePagesMode hugePages);
+
+    /**
+     * Allocates a page aligned buffer which is released when the last copy of the pointer is destroyed
+     * @return the buffer or nullptr if the default allocation should be used instead
+     */
+    std::shared_ptr<void> allocate(size_t size);
+
+    Statistics getStatistics() const;
+
+    /**
+     * @return the allocator of the current thread scope or nullptr
+     */
+    static MKLDNNMemoryAllocator* current();
+
+private:
+    void deallocate(void* ptr, size_t size, uint64_t hugePagesSize, uint64_t transparentSize, uint64_t numaLocalSize);
+
+    const bool numaLocal;
+    const Config::HugePagesMode hugePages;
+
+    std::atomic<uint64_t> allocations {0};
+    std::atomic<uint64_t> allocatedBytes {0};
+    std::atomic<uint64_t> peakAllocatedBytes {0};
+    std::atomic<uint64_t> hugePagesBytes {0};
+    std::atomic<uint64_t> transparentHugePagesBytes {0};
+    std::atomic<uint64_t> numaLocalBytes {0};
+};
+
+}  // namespace MKLDNNPlugin
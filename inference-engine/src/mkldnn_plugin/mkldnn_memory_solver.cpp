@@ -8,6 +8,9 @@
 
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -46,55 +49,140 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+std::vector<size_t> MemorySolver::getOrder(Heuristic heuristic) const {
+    std::vector<size_t> order(_boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    // boxes are sorted by start, so the stable sort keeps the execution order for the equal keys
+    auto bigger = [&](size_t l, size_t r) { return _boxes[l].size > _boxes[r].size; };
+    switch (heuristic) {
+    case Heuristic::BySize:
+        std::stable_sort(order.begin(), order.end(), bigger);
+        break;
+    case Heuristic::ByLifetime:
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            const int l_time = _boxes[l].finish - _boxes[l].start;
+            const int r_time = _boxes[r].finish - _boxes[r].start;
+            return l_time > r_time || (l_time == r_time && bigger(l, r));
+        });
+        break;
+    case Heuristic::ByConflicts: {
+        // number of boxes started before the finish of the box minus number of boxes finished before its start
+        std::vector<int> starts, finishes;
+        for (const Box& box : _boxes) {
+            starts.push_back(box.start);
+            finishes.push_back(box.finish);
+        }
+        std::sort(finishes.begin(), finishes.end());
+        std::vector<int64_t> conflicts(_boxes.size());
+        for (size_t i = 0; i < _boxes.size(); i++) {
+            const auto started = std::upper_bound(starts.begin(), starts.end(), _boxes[i].finish) - starts.begin();
+            const auto finished = std::lower_bound(finishes.begin(), finishes.end(), _boxes[i].start) - finishes.begin();
+            conflicts[i] = started - finished;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            return conflicts[l] > conflicts[r] || (conflicts[l] == conflicts[r] && bigger(l, r));
+        });
+        break;
+    }
+    case Heuristic::ByStart:
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            return _boxes[l].start < _boxes[r].start || (_boxes[l].start == _boxes[r].start && bigger(l, r));
+        });
+        break;
     }
+    return order;
 }
 
-int64_t MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int64_t _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
-                }
+int64_t MemorySolver::place(const std::vector<size_t>& order, bool best_fit, std::vector<int64_t>& offsets) const {
+    offsets.assign(_boxes.size(), 0);
+
+    // Interval index of the placed boxes: they are kept sorted by start, so only the boxes started in
+    // [box.start - max_lifetime, box.finish] are checked for the intersection in time with the new box
+    std::vector<size_t> placed;
+    placed.reserve(_boxes.size());
+    auto start_less = [&](size_t l, int ts) { return _boxes[l].start < ts; };
+    auto ts_less = [&](int ts, size_t r) { return ts < _boxes[r].start; };
+    int max_lifetime = 0;
+
+    std::vector<std::pair<int64_t, int64_t>> busy;
+    int64_t min_required = 0;
+    for (size_t i : order) {
+        const Box& box = _boxes[i];
+
+        busy.clear();
+        auto first = std::lower_bound(placed.begin(), placed.end(), box.start - max_lifetime, start_less);
+        auto last = std::upper_bound(placed.begin(), placed.end(), box.finish, ts_less);
+        for (auto it = first; it != last; ++it) {
+            if (_boxes[*it].finish >= box.start)
+                busy.emplace_back(offsets[*it], offsets[*it] + _boxes[*it].size);
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // the lowest gap between the busy ranges the box fits into, or the tightest one in the best fit mode
+        int64_t offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t top = 0;
+        for (const auto& range : busy) {
+            const int64_t gap = range.first - top;
+            if (gap >= box.size && gap < best_gap) {
+                offset = top;
+                best_gap = gap;
+                if (!best_fit)
+                    break;
             }
-        } while (popped_up);
+            top = std::max(top, range.second);
+        }
+        if (offset < 0)
+            offset = top;
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+        offsets[i] = offset;
+        min_required = std::max(min_required, offset + box.size);
+        placed.insert(std::upper_bound(placed.begin(), placed.end(), box.start, ts_less), i);
+        max_lifetime = std::max(max_lifetime, box.finish - box.start);
+    }
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+    return min_required;
+}
+
+int64_t MemorySolver::solve(Heuristic heuristic, std::vector<int64_t>& offsets) const {
+    const auto order = getOrder(heuristic);
+    std::vector<int64_t> best_fit_offsets;
+    const int64_t first_fit_required = place(order, false, offsets);
+    const int64_t best_fit_required = place(order, true, best_fit_offsets);
+    if (best_fit_required < first_fit_required) {
+        offsets.swap(best_fit_offsets);
+        return best_fit_required;
     }
+    return first_fit_required;
+}
 
-    return _min_required;
+int64_t MemorySolver::solve(Heuristic heuristic) {
+    std::vector<int64_t> offsets;
+    const int64_t min_required = solve(heuristic, offsets);
+
+    _offsets.clear();
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = offsets[i];
+    return min_required;
+}
+
+int64_t MemorySolver::solve() {
+    std::vector<int64_t> best_offsets;
+    int64_t min_required = std::numeric_limits<int64_t>::max();
+    for (auto heuristic : {Heuristic::BySize, Heuristic::ByLifetime, Heuristic::ByConflicts, Heuristic::ByStart}) {
+        std::vector<int64_t> offsets;
+        const int64_t required = solve(heuristic, offsets);
+        if (required < min_required) {
+            min_required = required;
+            best_offsets.swap(offsets);
+        }
+    }
+
+    _offsets.clear();
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = best_offsets[i];
+    return min_required;
 }
 
 int64_t MemorySolver::maxDepth() {
@@ -107,6 +195,13 @@ int64_t MemorySolver::maxTopDepth() {
     return _top_depth;
 }
 
+int64_t MemorySolver::totalSize() const {
+    int64_t total = 0;
+    for (const Box& box : _boxes)
+        total += box.size;
+    return total;
+}
+
 int64_t MemorySolver::getOffset(int id) const {
     auto res = _offsets.find(id);
     if (res == _offsets.end()) IE_THROW() << "There are no box for provided ID";
@@ -14,6 +14,7 @@
 
 #include <vector>
 #include <map>
+#include <cstddef>
 
 namespace MKLDNNPlugin {
 
@@ -65,14 +66,36 @@ public:
         int64_t id;
     };
 
+    /**
+     * @brief Order in which the boxes are placed. Every box is placed to the lowest offset
+     * or to the tightest gap between the already placed boxes, the better of two placements is kept.
+     */
+    enum class Heuristic {
+        /** The biggest boxes first */
+        BySize,
+        /** The longest living boxes first */
+        ByLifetime,
+        /** The boxes intersecting in time with the most of other boxes first */
+        ByConflicts,
+        /** In the execution order, the boxes of the same start are placed by size */
+        ByStart,
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes);
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * Runs all the heuristics and keeps the smallest result, the first heuristic wins the ties.
      * @return Size of common memory blob required for storing all
      */
     int64_t solve();
 
+    /**
+     * @brief Solve memory location with the specified heuristic only.
+     * @return Size of common memory blob required for storing all
+     */
+    int64_t solve(Heuristic heuristic);
+
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
 
@@ -80,6 +103,8 @@ public:
     int64_t maxDepth();
     /** Additional info. Max num of boxes required for any time stamp. */
     int64_t maxTopDepth();
+    /** Additional info. Sum of box sizes, the size required without any reuse. */
+    int64_t totalSize() const;
 
 private:
     std::vector<Box> _boxes;
@@ -89,6 +114,9 @@ private:
     int _time_duration = -1;
 
     void calcDepth();
+    std::vector<size_t> getOrder(Heuristic heuristic) const;
+    int64_t solve(Heuristic heuristic, std::vector<int64_t>& offsets) const;
+    int64_t place(const std::vector<size_t>& order, bool best_fit, std::vector<int64_t>& offsets) const;
 };
 
 }  // namespace MKLDNNPlugin
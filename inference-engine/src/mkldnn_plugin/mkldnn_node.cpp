@@ -111,6 +111,14 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "PRelu", Eltwise },
         { "Erf", Eltwise },
         { "SoftPlus", Eltwise },
+        { "Log", Eltwise },
+        { "Negative", Eltwise },
+        { "Floor", Eltwise },
+        { "Ceiling", Eltwise },
+        { "Sign", Eltwise },
+        { "Sin", Eltwise },
+        { "Cos", Eltwise },
+        { "SoftSignCPU", Eltwise },
         { "Reshape", Reshape },
         { "Squeeze", Reshape },
         { "Unsqueeze", Reshape },
@@ -180,28 +188,17 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ShuffleChannels", ShuffleChannels},
         { "DFT", DFT},
         { "IDFT", DFT},
-        { "Abs", Math},
         { "Acos", Math},
         { "Acosh", Math},
         { "Asin", Math},
         { "Asinh", Math},
         { "Atan", Math},
         { "Atanh", Math},
-        { "Ceil", Math},
-        { "Ceiling", Math},
-        { "Cos", Math},
         { "Cosh", Math},
-        { "Floor", Math},
         { "HardSigmoid", Math},
-        { "Log", Math},
-        { "Neg", Math},
         { "Reciprocal", Math},
         { "Selu", Math},
-        { "Sign", Math},
-        { "Sin", Math},
         { "Sinh", Math},
-        { "SoftPlus", Math},
-        { "Softsign", Math},
         { "Tan", Math},
         { "CTCLoss", CTCLoss},
         { "Bucketize", Bucketize},
@@ -223,7 +220,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ExperimentalDetectronPriorGridGenerator", ExperimentalDetectronPriorGridGenerator},
         { "ExperimentalDetectronGenerateProposalsSingleImage", ExperimentalDetectronGenerateProposalsSingleImage},
         { "ExtractImagePatches", ExtractImagePatches},
-        { "NonMaxSuppressionIEInternal", NonMaxSuppression}
+        { "NonMaxSuppressionIEInternal", NonMaxSuppression},
+        { "MHA", MHA}
 };
 
 Type TypeFromName(const std::string type) {
@@ -1355,7 +1353,7 @@ bool MKLDNNNode::canFuseSimpleOperation(const MKLDNNNodePtr& node) const {
     } else if (node->getType() == Eltwise) {
         return one_of(node->getAlgorithm(), EltwiseRelu, EltwiseGelu, EltwiseElu, EltwiseSigmoid, EltwiseClamp, EltwiseTanh,
                                             EltwiseSwish, EltwiseHswish, EltwiseMish, EltwiseHsigmoid, EltwiseRoundHalfToEven,
-                                            EltwiseRoundHalfAwayFromZero, EltwiseAbs, EltwiseSqrt, EltwiseSoftRelu) ||
+                                            EltwiseRoundHalfAwayFromZero, EltwiseAbs, EltwiseSqrt, EltwiseSoftRelu, EltwiseLog) ||
                       node->canBePerformedAsScaleShift(this);
     }
     return false;
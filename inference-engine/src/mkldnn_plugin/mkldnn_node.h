@@ -192,6 +192,8 @@ static std::string NameFromType(Type type) {
             return "ExtractImagePatches";
         case NonMaxSuppression:
             return "NonMaxSuppression";
+        case MHA:
+            return "MHA";
         default:
             return "Unknown";
     }
@@ -704,6 +706,7 @@ protected:
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
     friend class MKLDNNGraphOptimizer;
+    friend class MKLDNNLayoutSelector;
     friend class NodeDumper;
 
     bool isUninitTensorDesc(const InferenceEngine::TensorDesc& desc) const;
@@ -89,6 +89,8 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/matmul_weights_decompression.hpp"
+#include "ngraph_transformations/fp16_weights_decompression.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -110,6 +112,8 @@ Engine::Engine() {
 Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPU");
     ExecutorManager::getInstance()->clear("CPUStreamsExecutor");
+    ExecutorManager::getInstance()->clear("CPUSharedStreamsExecutor");
+    ExecutorManager::getInstance()->clear("CPUSharedCallbackExecutor");
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
@@ -126,6 +130,10 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
     }
+    manager.register_pass<MKLDNNPlugin::MatMulWeightsDecompression>();
+    if (conf.keepFP16Weights) {
+        manager.register_pass<MKLDNNPlugin::FP16WeightsDecompression>();
+    }
 
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -406,9 +414,27 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
+    MKLDNNExecNetwork::NetworkSpecializer specializer;
+    if (conf.dynamicShapesCacheSize > 0) {
+        if (conf.enableDynamicBatch) {
+            IE_THROW() << "Dynamic batch cannot be used together with " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE;
+        }
+        // The transformations may fold the shapes into constants, so every specialization starts from the original network
+        CNNNetwork originalNetwork = InferenceEngine::details::cloneNetwork(network);
+        for (const auto& op : originalNetwork.getFunction()->get_ops()) {
+            op->get_friendly_name();
+        }
+        specializer = [originalNetwork, conf] (const std::map<std::string, SizeVector>& inputShapes) {
+            CNNNetwork specializedNetwork = InferenceEngine::details::cloneNetwork(originalNetwork);
+            specializedNetwork.reshape(inputShapes);
+            Transformation(specializedNetwork, conf);
+            return specializedNetwork;
+        };
+    }
+
     Transformation(clonedNetwork, conf);
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, specializer);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
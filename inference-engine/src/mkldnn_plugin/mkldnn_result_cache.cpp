@@ -0,0 +1,172 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_result_cache.h"
+#include "nodes/common/cpu_memcpy.h"
+
+#include <blob_factory.hpp>
+
+#include <cstring>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+inline uint64_t combine(uint64_t seed, uint64_t value) {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+uint64_t combine(uint64_t seed, const void* data, size_t size) {
+    const auto bytes = static_cast<const uint8_t*>(data);
+    const size_t wordsSize = size - size % sizeof(uint64_t);
+    for (size_t i = 0; i < wordsSize; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(uint64_t));
+        seed = combine(seed, word);
+    }
+    uint64_t lastBytes = 0;
+    std::memcpy(&lastBytes, bytes + wordsSize, size - wordsSize);
+    return combine(seed, lastBytes);
+}
+
+Blob::Ptr copyBlob(const MemoryBlob::CPtr& blob) {
+    auto copy = make_blob_with_precision(blob->getTensorDesc());
+    copy->allocate();
+    cpu_memcpy(copy->buffer().as<uint8_t*>(), blob->cbuffer().as<const uint8_t*>(), blob->byteSize());
+    return copy;
+}
+}  // namespace
+
+struct MKLDNNResultCache::Entry {
+    uint64_t hash;
+    int batch;
+    std::vector<std::pair<std::string, MemoryBlob::CPtr>> inputs;
+    std::shared_ptr<const BlobMap> outputs;
+    size_t bytes;
+};
+
+MKLDNNResultCache::Key::Key(const BlobMap& inputs, int batch) : batch(batch) {
+    hash = combine(0, static_cast<uint64_t>(batch));
+    for (const auto& input : inputs) {
+        auto blob = as<MemoryBlob>(input.second);
+        if (!blob || blob->cbuffer().as<const void*>() == nullptr) {
+            this->inputs.clear();
+            return;
+        }
+        hash = combine(hash, input.first.data(), input.first.size());
+        hash = combine(hash, static_cast<uint64_t>(blob->getTensorDesc().getPrecision()));
+        for (auto dim : blob->getTensorDesc().getDims()) {
+            hash = combine(hash, static_cast<uint64_t>(dim));
+        }
+        hash = combine(hash, blob->cbuffer().as<const void*>(), blob->byteSize());
+        this->inputs.emplace_back(input.first, blob);
+    }
+}
+
+bool MKLDNNResultCache::Key::valid() const {
+    return !inputs.empty();
+}
+
+MKLDNNResultCache::MKLDNNResultCache(size_t maxBytes) : maxBytes(maxBytes) {}
+
+bool MKLDNNResultCache::equal(const Entry& entry, const Key& key) {
+    if (entry.hash != key.hash || entry.batch != key.batch || entry.inputs.size() != key.inputs.size())
+        return false;
+    for (size_t i = 0; i < entry.inputs.size(); i++) {
+        const auto& cached = entry.inputs[i];
+        const auto& input = key.inputs[i];
+        if (cached.first != input.first || cached.second->getTensorDesc() != input.second->getTensorDesc() ||
+            std::memcmp(cached.second->cbuffer().as<const void*>(), input.second->cbuffer().as<const void*>(),
+                        input.second->byteSize()) != 0)
+            return false;
+    }
+    return true;
+}
+
+std::shared_ptr<const BlobMap> MKLDNNResultCache::find(const Key& key) {
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key.hash);
+        if (it == index.end()) {
+            statistics.misses++;
+            return nullptr;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        entry = *it->second;
+    }
+
+    // the inputs are compared out of the lock, the entry is immutable and is kept alive even if it is evicted
+    if (!equal(*entry, key)) {
+        std::lock_guard<std::mutex> lock(mutex);
+        statistics.misses++;
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    statistics.hits++;
+    return entry->outputs;
+}
+
+void MKLDNNResultCache::insert(const Key& key, const BlobMap& outputs) {
+    if (!key.valid())
+        return;
+
+    size_t bytes = 0;
+    for (const auto& input : key.inputs) {
+        bytes += input.second->byteSize();
+    }
+    for (const auto& output : outputs) {
+        auto blob = as<MemoryBlob>(output.second);
+        if (!blob || blob->cbuffer().as<const void*>() == nullptr)
+            return;
+        bytes += blob->byteSize();
+    }
+    if (bytes > maxBytes)
+        return;
+
+    // the copies are made out of the lock
+    auto entry = std::make_shared<Entry>();
+    entry->hash = key.hash;
+    entry->batch = key.batch;
+    for (const auto& input : key.inputs) {
+        entry->inputs.emplace_back(input.first, as<MemoryBlob>(copyBlob(input.second)));
+    }
+    auto cachedOutputs = std::make_shared<BlobMap>();
+    for (const auto& output : outputs) {
+        (*cachedOutputs)[output.first] = copyBlob(as<MemoryBlob>(output.second));
+    }
+    entry->outputs = cachedOutputs;
+    entry->bytes = bytes;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // an entry with the same hash is either the same inputs inserted by a concurrent request or a collision,
+    // the latest inputs are kept in both cases
+    auto it = index.find(key.hash);
+    if (it != index.end()) {
+        statistics.bytes -= (*it->second)->bytes;
+        statistics.entries--;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+    while (statistics.bytes + bytes > maxBytes) {
+        const auto& last = entries.back();
+        statistics.bytes -= last->bytes;
+        statistics.entries--;
+        statistics.evictions++;
+        index.erase(last->hash);
+        entries.pop_back();
+    }
+    entries.push_front(entry);
+    index[key.hash] = entries.begin();
+    statistics.bytes += bytes;
+    statistics.entries++;
+}
+
+MKLDNNResultCache::Statistics MKLDNNResultCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return statistics;
+}
+
+}  // namespace MKLDNNPlugin
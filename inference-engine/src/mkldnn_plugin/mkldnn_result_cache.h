@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Least recently used cache of the inference results of a network
+ *
+ * The results are looked up by the content of all the input blobs, so a network inferred again with the same inputs
+ * skips the inference. An entry keeps copies of both the inputs and the outputs, the inputs are compared byte by byte
+ * on a lookup, so hash collisions never return the outputs of other inputs. The least recently used entries are
+ * evicted when the cached inputs and outputs take more memory than the limit.
+ * The results of networks with state depend on the previous inferences, such networks must not use the cache.
+ *
+ * Is a thread safe
+ */
+class MKLDNNResultCache {
+    struct Entry;
+
+public:
+    typedef std::shared_ptr<MKLDNNResultCache> Ptr;
+
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t entries = 0;
+        uint64_t bytes = 0;       // memory of the cached inputs and outputs
+        uint64_t evictions = 0;
+    };
+
+    /**
+     * The inputs of one inference. The input blobs are referenced, so they must not change while the key is used
+     */
+    class Key {
+    public:
+        /**
+         * @param batch the batch of the inference, see IInferRequestInternal::SetBatch
+         */
+        Key(const InferenceEngine::BlobMap& inputs, int batch);
+
+        /**
+         * @return false if some of the inputs is not placed in the memory, such inferences are not cached
+         */
+        bool valid() const;
+
+    private:
+        friend class MKLDNNResultCache;
+        uint64_t hash = 0;
+        int batch = -1;
+        std::vector<std::pair<std::string, InferenceEngine::MemoryBlob::CPtr>> inputs;
+    };
+
+    explicit MKLDNNResultCache(size_t maxBytes);
+
+    /**
+     * @return the outputs cached for the inputs or nullptr if they are not cached
+     */
+    std::shared_ptr<const InferenceEngine::BlobMap> find(const Key& key);
+
+    /**
+     * Copies the inputs and the outputs to the cache. The outputs bigger than the whole cache are not cached
+     */
+    void insert(const Key& key, const InferenceEngine::BlobMap& outputs);
+
+    Statistics getStatistics() const;
+
+private:
+    static bool equal(const Entry& entry, const Key& key);
+
+    const size_t maxBytes;
+
+    mutable std::mutex mutex;
+    // the most recently used entries go first
+    std::list<std::shared_ptr<Entry>> entries;
+    std::unordered_map<uint64_t, std::list<std::shared_ptr<Entry>>::iterator> index;
+    Statistics statistics;
+};
+
+}  // namespace MKLDNNPlugin
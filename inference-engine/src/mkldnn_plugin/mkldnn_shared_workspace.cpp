@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_shared_workspace.h"
+#include "utils/general_utils.h"
+
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+#if defined(__linux__)
+constexpr size_t pageSize = 4 * 1024;
+// Only the address space is reserved, the pages are committed when the graphs require them
+constexpr uint64_t reservedSize = uint64_t(64) << 30;
+#endif
+
+std::mutex registryMutex;
+std::map<std::pair<std::string, const void*>, std::weak_ptr<MKLDNNSharedWorkspace>> registry;
+}  // namespace
+
+struct MKLDNNSharedWorkspace::Buffer {
+    // serializes the graphs using the buffer
+    std::mutex mutex;
+    int8_t* data = nullptr;
+    size_t committed = 0;
+};
+
+MKLDNNSharedWorkspace::Allocation::Allocation(const Ptr& workspace, Buffer& buffer, size_t size)
+    : workspace(workspace)
+    , buffer(buffer)
+    , size(size) {
+    workspace->graphs++;
+    workspace->requiredBytes += size;
+}
+
+MKLDNNSharedWorkspace::Allocation::~Allocation() {
+    workspace->graphs--;
+    workspace->requiredBytes -= size;
+}
+
+int8_t* MKLDNNSharedWorkspace::Allocation::data() const {
+    return buffer.data;
+}
+
+std::unique_lock<std::mutex> MKLDNNSharedWorkspace::Allocation::lock() {
+    std::unique_lock<std::mutex> lock(buffer.mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        workspace->waits++;
+        lock.lock();
+    }
+    return lock;
+}
+
+MKLDNNSharedWorkspace::Ptr MKLDNNSharedWorkspace::get(const std::string& name, const void* executor) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& entry = registry[{name, executor}];
+    auto workspace = entry.lock();
+    if (!workspace) {
+        workspace = Ptr(new MKLDNNSharedWorkspace);
+        entry = workspace;
+    }
+    for (auto it = registry.begin(); it != registry.end();) {
+        if (it->second.expired())
+            it = registry.erase(it);
+        else
+            ++it;
+    }
+    return workspace;
+}
+
+std::unique_ptr<MKLDNNSharedWorkspace::Allocation> MKLDNNSharedWorkspace::allocate(int streamId, size_t size) {
+#if defined(__linux__)
+    if (sizeof(void*) < 8 || size == 0 || size > reservedSize)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& buffer = buffers[streamId];
+    if (!buffer)
+        buffer.reset(new Buffer);
+
+    // the committed pages are not touched, so the graph running on the stream is not waited for
+    if (!buffer->data) {
+        void* ptr = mmap(nullptr, reservedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (ptr == MAP_FAILED)
+            return nullptr;
+        buffer->data = static_cast<int8_t*>(ptr);
+    }
+    const size_t committed = rnd_up(size, pageSize);
+    if (committed > buffer->committed) {
+        if (mprotect(buffer->data + buffer->committed, committed - buffer->committed, PROT_READ | PROT_WRITE) != 0)
+            return nullptr;
+        allocatedBytes += committed - buffer->committed;
+        buffer->committed = committed;
+    }
+    return std::unique_ptr<Allocation>(new Allocation(shared_from_this(), *buffer, size));
+#else
+    return nullptr;
+#endif
+}
+
+MKLDNNSharedWorkspace::Statistics MKLDNNSharedWorkspace::getStatistics() const {
+    Statistics statistics;
+    statistics.graphs = graphs.load();
+    statistics.allocatedBytes = allocatedBytes.load();
+    statistics.requiredBytes = requiredBytes.load();
+    statistics.waits = waits.load();
+    return statistics;
+}
+
+MKLDNNSharedWorkspace::~MKLDNNSharedWorkspace() {
+#if defined(__linux__)
+    for (auto& buffer : buffers) {
+        if (buffer.second->data)
+            munmap(buffer.second->data, reservedSize);
+    }
+#endif
+}
+
+}  // namespace MKLDNNPlugin
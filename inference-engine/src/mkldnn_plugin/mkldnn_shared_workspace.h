@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Activation memory shared by the graphs of several executable networks
+ *
+ * The graphs running on one stream place their activations in the same buffer, so the memory of the stream is as big
+ * as the biggest graph instead of the sum of all graphs. The buffer is a reserved range of the address space which is
+ * committed up to the biggest requirement, so it grows in place and the graphs keep the addresses of their tensors.
+ * Graphs using the buffer of a stream must lock it for the whole inference, including the input and output copies.
+ *
+ * Is a thread safe
+ */
+class MKLDNNSharedWorkspace : public std::enable_shared_from_this<MKLDNNSharedWorkspace> {
+    // the memory of one stream
+    struct Buffer;
+
+public:
+    typedef std::shared_ptr<MKLDNNSharedWorkspace> Ptr;
+
+    struct Statistics {
+        uint64_t graphs = 0;          // graphs placed in the buffers
+        uint64_t allocatedBytes = 0;  // committed memory of all the buffers
+        uint64_t requiredBytes = 0;   // memory the graphs would allocate separately
+        uint64_t waits = 0;           // times a graph waited for the buffer used by another graph
+    };
+
+    /**
+     * The part of a stream buffer used by one graph
+     */
+    class Allocation {
+    public:
+        ~Allocation();
+
+        int8_t* data() const;
+
+        /**
+         * Serializes the graphs sharing the buffer of the stream
+         */
+        std::unique_lock<std::mutex> lock();
+
+    private:
+        friend class MKLDNNSharedWorkspace;
+        Allocation(const Ptr& workspace, Buffer& buffer, size_t size);
+
+        Ptr workspace;
+        Buffer& buffer;
+        size_t size;
+    };
+
+    /**
+     * @return the workspace of the networks with the given name running on the given executor
+     */
+    static Ptr get(const std::string& name, const void* executor);
+
+    /**
+     * Grows the buffer of the stream to the given size if needed
+     * @return the allocation or nullptr if the buffer can not be grown in place and the graph should use own memory
+     */
+    std::unique_ptr<Allocation> allocate(int streamId, size_t size);
+
+    Statistics getStatistics() const;
+
+    ~MKLDNNSharedWorkspace();
+
+private:
+    MKLDNNSharedWorkspace() = default;
+
+    mutable std::mutex mutex;
+    std::map<int, std::unique_ptr<Buffer>> buffers;
+
+    std::atomic<uint64_t> graphs {0};
+    std::atomic<uint64_t> allocatedBytes {0};
+    std::atomic<uint64_t> requiredBytes {0};
+    std::atomic<uint64_t> waits {0};
+};
+
+}  // namespace MKLDNNPlugin
@@ -4,6 +4,7 @@
 
 #include "convert_matmul_to_fc_or_gemm.hpp"
 #include "op/fully_connected.hpp"
+#include "matmul_weights_decompression.hpp"
 #include <numeric>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
@@ -102,8 +103,10 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // Check that if second inputs is Constant operation and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
         // Otherwise we replace MatMul with Gemm.
+        // Compressed weights kept by MatMulWeightsDecompression are already in [O, K] layout FullyConnected uses.
         if ((std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-             std::dynamic_pointer_cast<ngraph::opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())) &&
+             std::dynamic_pointer_cast<ngraph::opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr()) ||
+             (MatMulWeightsDecompression::isWeightsDecompression(fc_input_b) && matmul->get_transpose_b() && shape_b.size() == 2)) &&
              std::count_if(shape_b.begin(), shape_b.end(), [](size_t x) { return x != 1; }) <= 2) {
             ngraph::Shape shape_a_aligned, shape_b_aligned;
             std::tie(shape_a_aligned, shape_b_aligned) = get_aligned_shapes();
@@ -13,14 +13,17 @@
 #include "convert_to_power_static.hpp"
 #include "convert_to_leaky_relu.hpp"
 #include "convert_to_swish_cpu.hpp"
+#include "softsign_fusion.hpp"
 #include "reshape_prelu.hpp"
 #include "rnn_sequences_optimization.hpp"
+#include "mha_fusion.hpp"
 
 namespace MKLDNNPlugin {
 
 inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc) {
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<MHAFusion>();
     manager.register_pass<Reshape1DConvolution>();
     manager.register_pass<Reshape1DGroupConvolution>();
     manager.register_pass<Reshape1DAvgPool>();
@@ -31,6 +34,7 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     manager.register_pass<ConvertMatMulToGemm>();
     manager.register_pass<FullyConnectedBiasFusion>();
     manager.register_pass<ReshapeFullyConnected>();
+    manager.register_pass<SoftSignFusion>();
     manager.register_pass<ConvertToPowerStatic>();
     manager.register_pass<ConvertToLeakyRelu>();
     manager.register_pass<ReshapePRelu>();
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fp16_weights_decompression.hpp"
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/binary_elementwise_arithmetic.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FP16WeightsDecompression, "FP16WeightsDecompression", 0);
+
+namespace {
+const char disabledConstantFolding[] = "DISABLED_CONSTANT_FOLDING";
+// keeps ConvertPrecision from converting the FP16 constant
+const char runtimeDecompression[] = "RUNTIME_DECOMPRESSION";
+// Smaller Eltwise constants are converted on loading, as their memory is negligible
+const size_t minEltwiseConstantSize = 4096;
+}  // namespace
+
+MKLDNNPlugin::FP16WeightsDecompression::FP16WeightsDecompression() {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches(ngraph::element::f16));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights}, ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& patternMap = m.get_pattern_value_map();
+        const auto convertNode = patternMap.at(convert).get_node_shared_ptr();
+        if (convertNode->get_output_element_type(0) != ngraph::element::f32 || convertNode->get_rt_info().count(disabledConstantFolding))
+            return false;
+
+        const auto weightsShape = patternMap.at(weights).get_shape();
+        const auto consumer = *convertNode->output(0).get_target_inputs().begin();
+        const auto consumerNode = consumer.get_node()->shared_from_this();
+        auto markDecompression = [](const std::shared_ptr<ngraph::Node>& node) {
+            node->get_rt_info()[disabledConstantFolding] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+            node->get_rt_info()[runtimeDecompression] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        };
+
+        // Eltwise constants are broadcasted by the node, the per channel ones are kept in FP32 to be fused as scale shifts
+        if (std::dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(consumerNode)) {
+            const auto nonUnitDims = std::count_if(weightsShape.begin(), weightsShape.end(), [](size_t dim) { return dim != 1; });
+            if (ngraph::shape_size(weightsShape) >= minEltwiseConstantSize && nonUnitDims > 1)
+                markDecompression(convertNode);
+            return false;
+        }
+
+        auto matmulNode = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(consumerNode);
+        if (!matmulNode || consumer.get_index() != 1 || weightsShape.size() != 2 || matmulNode->get_output_partial_shape(0).is_dynamic())
+            return false;
+
+        if (matmulNode->get_transpose_b()) {
+            markDecompression(convertNode);
+            return false;
+        }
+
+        // FullyConnected uses [O, K] weights, the Transpose of the constant is folded by the next constant folding
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(patternMap.at(weights),
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 0}));
+        const auto newConvert = convertNode->clone_with_new_inputs({transpose});
+        auto newMatmul = std::make_shared<ngraph::opset1::MatMul>(matmulNode->input_value(0), newConvert,
+                                                                  matmulNode->get_transpose_a(), true);
+        newMatmul->set_friendly_name(matmulNode->get_friendly_name());
+        ngraph::copy_runtime_info({matmulNode, convertNode}, {transpose, newConvert, newMatmul});
+        markDecompression(newConvert);
+        ngraph::replace_node(matmulNode, newMatmul);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert, "FP16WeightsDecompression");
+    this->register_matcher(m, callback);
+}
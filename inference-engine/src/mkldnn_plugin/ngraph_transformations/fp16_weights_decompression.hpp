@@ -0,0 +1,27 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     Keeps the decompression of FP16 weights from being constant folded, so the weights stay in FP16 and are
+ *     converted to FP32 by the nodes while they are read:
+ *
+ *     Constant(f16) -> Convert(f32) -> MatMul (weights)
+ *     Constant(f16) -> Convert(f32) -> Add/Subtract/Multiply/... (big constants which are not per channel)
+ *
+ *     Not transposed MatMul weights are transposed to [O, K] FullyConnected uses.
+ */
+class FP16WeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FP16WeightsDecompression();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,132 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "matmul_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MatMulWeightsDecompression, "MatMulWeightsDecompression", 0);
+
+namespace {
+const char disabledConstantFolding[] = "DISABLED_CONSTANT_FOLDING";
+}  // namespace
+
+bool MKLDNNPlugin::MatMulWeightsDecompression::isWeightsDecompression(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    // FP16 weights kept by FP16WeightsDecompression are only converted
+    if (ngraph::is_type<ngraph::opset1::Convert>(node) && node->get_input_element_type(0) == ngraph::element::f16)
+        return node->get_rt_info().count(disabledConstantFolding) && ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+    if (ngraph::is_type<ngraph::opset1::Reshape>(node))
+        node = node->get_input_node_shared_ptr(0);
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node))
+        return false;
+    node = node->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(node))
+        node = node->get_input_node_shared_ptr(0);
+    return ngraph::is_type<ngraph::opset1::Convert>(node) && node->get_rt_info().count(disabledConstantFolding) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+}
+
+MKLDNNPlugin::MatMulWeightsDecompression::MatMulWeightsDecompression() {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(
+            {ngraph::element::u8, ngraph::element::i8, ngraph::element::u4, ngraph::element::i4}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights}, ngraph::pattern::consumers_count(1));
+    auto zeroPoint = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto subtract = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert, zeroPoint}, ngraph::pattern::consumers_count(1));
+    auto subtractOrConvert = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{convert, subtract});
+    auto scale = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({subtractOrConvert, scale}, ngraph::pattern::consumers_count(1));
+    auto reshape = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({multiply, ngraph::pattern::wrap_type<ngraph::opset1::Constant>()},
+                                                                       ngraph::pattern::consumers_count(1));
+    auto multiplyOrReshape = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{multiply, reshape});
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(), multiplyOrReshape},
+                                                                     ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto matmulNode = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmulNode)
+            return false;
+
+        const auto& patternMap = m.get_pattern_value_map();
+        const auto convertNode = patternMap.at(convert).get_node_shared_ptr();
+        if (!convertNode->get_element_type().is_real())
+            return false;
+
+        const auto weightsShape = patternMap.at(weights).get_shape();
+        const bool grouped = patternMap.count(reshape);
+        if (grouped) {
+            if (weightsShape.size() != 3 || !matmulNode->get_transpose_b() ||
+                matmulNode->get_input_shape(1) != ngraph::Shape{weightsShape[0], weightsShape[1] * weightsShape[2]})
+                return false;
+        } else if (weightsShape.size() != 2) {
+            return false;
+        }
+
+        // the output channels are the rows of [O, K] or [O, G, K / G] weights and the columns of [K, O] ones
+        const size_t outputAxis = matmulNode->get_transpose_b() ? 0 : 1;
+        auto isPerChannel = [&](const ngraph::Output<ngraph::Node>& constant) {
+            const auto shape = constant.get_shape();
+            if (ngraph::shape_size(shape) == 1)
+                return true;
+            if (shape.size() != weightsShape.size())
+                return false;
+            for (size_t i = 0; i < shape.size(); i++) {
+                const bool reducedAxis = grouped ? i == 2 : i != outputAxis;
+                if (shape[i] != 1 && (reducedAxis || shape[i] != weightsShape[i]))
+                    return false;
+            }
+            return true;
+        };
+        if (!isPerChannel(patternMap.at(scale)) || (patternMap.count(zeroPoint) && !isPerChannel(patternMap.at(zeroPoint))))
+            return false;
+
+        if (matmulNode->get_transpose_b()) {
+            convertNode->get_rt_info()[disabledConstantFolding] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+            return false;
+        }
+
+        // 4-bit constants can not be transposed by the constant folding, so they are decompressed in advance
+        const auto weightsType = patternMap.at(weights).get_element_type();
+        if (weightsType == ngraph::element::u4 || weightsType == ngraph::element::i4)
+            return false;
+
+        // FullyConnected uses [O, K] weights, the Transposes of the constants are folded by the next constant folding
+        auto transpose = [](const ngraph::Output<ngraph::Node>& constant) -> ngraph::Output<ngraph::Node> {
+            if (constant.get_shape().size() != 2)
+                return constant;
+            return std::make_shared<ngraph::opset1::Transpose>(constant,
+                ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 0}));
+        };
+
+        ngraph::NodeVector newOps;
+        const auto newConvert = convertNode->clone_with_new_inputs({transpose(patternMap.at(weights))});
+        newOps.push_back(newConvert);
+        std::shared_ptr<ngraph::Node> decompression = newConvert;
+        if (patternMap.count(subtract)) {
+            decompression = std::make_shared<ngraph::opset1::Subtract>(decompression, transpose(patternMap.at(zeroPoint)));
+            newOps.push_back(decompression);
+        }
+        decompression = std::make_shared<ngraph::opset1::Multiply>(decompression, transpose(patternMap.at(scale)));
+        newOps.push_back(decompression);
+
+        auto newMatmul = std::make_shared<ngraph::opset1::MatMul>(matmulNode->input_value(0), decompression,
+                                                                  matmulNode->get_transpose_a(), true);
+        newOps.push_back(newMatmul);
+        newMatmul->set_friendly_name(matmulNode->get_friendly_name());
+
+        ngraph::NodeVector originalOps{matmulNode, convertNode, patternMap.at(multiply).get_node_shared_ptr()};
+        if (patternMap.count(subtract))
+            originalOps.push_back(patternMap.at(subtract).get_node_shared_ptr());
+        ngraph::copy_runtime_info(originalOps, newOps);
+        newConvert->get_rt_info()[disabledConstantFolding] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        ngraph::replace_node(matmulNode, newMatmul);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MatMulWeightsDecompression");
+    this->register_matcher(m, callback);
+}
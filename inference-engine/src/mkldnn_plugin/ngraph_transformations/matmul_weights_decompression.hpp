@@ -0,0 +1,30 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     Keeps the decompression of low precision MatMul weights from being constant folded, so FullyConnected
+ *     reads the compressed weights and dequantizes them on the fly:
+ *
+ *     Constant(u8/i8/u4/i4) -> Convert -> [Subtract(zero point)] -> Multiply(scale) -> [Reshape] -> MatMul
+ *
+ *     Scales and zero points must be per output channel, or per group of the input channels when the weights
+ *     of the shape [O, G, K / G] are reshaped to [O, K]. Not transposed weights are transposed to [O, K].
+ */
+class MatMulWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MatMulWeightsDecompression();
+
+    // Returns true for the weights decompressed by FullyConnected, including FP16 ones kept by FP16WeightsDecompression
+    static bool isWeightsDecompression(const ngraph::Output<ngraph::Node>& output);
+};
+
+}  // namespace MKLDNNPlugin
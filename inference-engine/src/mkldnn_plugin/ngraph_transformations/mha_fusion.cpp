@@ -0,0 +1,175 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha_fusion.hpp"
+#include "op/mha.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MHAFusion, "MHAFusion", 0);
+
+namespace {
+
+bool hasOneConsumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+// checks that the output is produced by the first MatMul directly or through the scale
+bool isScores(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node();
+    if (ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node))
+        return ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_ptr(0)) ||
+               ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_ptr(1));
+    return ngraph::is_type<ngraph::opset1::MatMul>(node);
+}
+
+// returns the value of the scalar constant input of the node, the other input is returned in data
+bool getScalarInput(const std::shared_ptr<ngraph::Node>& node, bool commutative, float& value, ngraph::Output<ngraph::Node>& data) {
+    for (size_t i = 0; i < (commutative ? 2 : 1); i++) {
+        const size_t constPort = 1 - i;
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(constPort));
+        if (constant && ngraph::shape_size(constant->get_shape()) == 1) {
+            value = constant->cast_vector<float>()[0];
+            data = node->input_value(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// folds the producing Transpose into the order, which transposes the returned output to the [B, H, S, D] layout
+ngraph::Output<ngraph::Node> foldTranspose(const ngraph::Output<ngraph::Node>& input, std::vector<int64_t>& order,
+                                           ngraph::NodeVector& fusedNodes) {
+    auto transpose = std::dynamic_pointer_cast<ngraph::opset1::Transpose>(input.get_node_shared_ptr());
+    if (!transpose || !hasOneConsumer(input))
+        return input;
+    auto transposeOrder = std::dynamic_pointer_cast<ngraph::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!transposeOrder)
+        return input;
+    const auto transposeOrderValues = transposeOrder->cast_vector<int64_t>();
+    if (transposeOrderValues.size() != 4)
+        return input;
+
+    std::vector<int64_t> newOrder(4);
+    for (size_t i = 0; i < 4; i++)
+        newOrder[i] = transposeOrderValues[order[i]];
+    order = newOrder;
+    fusedNodes.push_back(transpose);
+    return transpose->input_value(0);
+}
+
+}  // namespace
+
+MKLDNNPlugin::MHAFusion::MHAFusion() {
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax>(ngraph::pattern::consumers_count(1));
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax, ngraph::pattern::any_input()},
+                                                                     ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto outMatMul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        auto softmaxNode = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(m.get_pattern_value_map().at(softmax).get_node_shared_ptr());
+        if (!outMatMul || !softmaxNode || outMatMul->get_transpose_a())
+            return false;
+
+        const auto& scoresShape = softmaxNode->get_output_partial_shape(0);
+        if (scoresShape.is_dynamic() || scoresShape.rank().get_length() != 4 || softmaxNode->get_axis() != 3)
+            return false;
+
+        ngraph::NodeVector fusedNodes = {outMatMul, softmaxNode};
+        auto node = softmaxNode->get_input_node_shared_ptr(0);
+
+        // [B, H, Sq, Sk] scores are computed by the first MatMul, the scale and the mask are optional
+        ngraph::Output<ngraph::Node> mask;
+        if (ngraph::is_type<ngraph::opset1::Add>(node) && hasOneConsumer(node->output(0))) {
+            const size_t scoresPort = isScores(node->input_value(0)) ? 0 : 1;
+            mask = node->input_value(1 - scoresPort);
+            if (mask.get_partial_shape().is_dynamic() || mask.get_partial_shape().rank().get_length() > 4 ||
+                node->get_input_partial_shape(scoresPort) != scoresShape)
+                return false;
+            fusedNodes.push_back(node);
+            node = node->get_input_node_shared_ptr(scoresPort);
+        }
+
+        float scale = 1.f;
+        if ((ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node)) &&
+            hasOneConsumer(node->output(0))) {
+            const bool isMultiply = ngraph::is_type<ngraph::opset1::Multiply>(node);
+            float value;
+            ngraph::Output<ngraph::Node> scores;
+            if (!getScalarInput(node, isMultiply, value, scores) || value == 0.f)
+                return false;
+            scale = isMultiply ? value : 1.f / value;
+            fusedNodes.push_back(node);
+            node = scores.get_node_shared_ptr();
+        }
+
+        auto scoresMatMul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+        if (!scoresMatMul || !hasOneConsumer(scoresMatMul->output(0)) || scoresMatMul->get_output_partial_shape(0) != scoresShape)
+            return false;
+        fusedNodes.push_back(scoresMatMul);
+
+        const auto elementType = outMatMul->get_output_element_type(0);
+        for (const auto& input : {scoresMatMul->input_value(0), scoresMatMul->input_value(1), outMatMul->input_value(1)}) {
+            const auto& shape = input.get_partial_shape();
+            if (input.get_element_type() != elementType || shape.is_dynamic() || shape.rank().get_length() != 4)
+                return false;
+        }
+        if (mask.get_node() && mask.get_element_type() != elementType)
+            return false;
+
+        // MatMul transposes are the transposes of the two innermost dimensions
+        const std::vector<int64_t> plainOrder = {0, 1, 2, 3}, swappedOrder = {0, 1, 3, 2};
+        std::vector<int64_t> qOrder = scoresMatMul->get_transpose_a() ? swappedOrder : plainOrder;
+        std::vector<int64_t> kOrder = scoresMatMul->get_transpose_b() ? plainOrder : swappedOrder;
+        std::vector<int64_t> vOrder = outMatMul->get_transpose_b() ? swappedOrder : plainOrder;
+
+        auto q = scoresMatMul->input_value(0);
+        float qScale;
+        ngraph::Output<ngraph::Node> qData;
+        if (ngraph::is_type<ngraph::opset1::Multiply>(q.get_node()) && hasOneConsumer(q) &&
+            getScalarInput(q.get_node_shared_ptr(), true, qScale, qData) && qData.get_partial_shape() == q.get_partial_shape()) {
+            fusedNodes.push_back(q.get_node_shared_ptr());
+            scale *= qScale;
+            q = qData;
+        }
+        q = foldTranspose(q, qOrder, fusedNodes);
+        auto k = foldTranspose(scoresMatMul->input_value(1), kOrder, fusedNodes);
+        auto v = foldTranspose(outMatMul->input_value(1), vOrder, fusedNodes);
+
+        // the batch and head dimensions are not broadcasted by MHA
+        const auto qShape = q.get_shape(), kShape = k.get_shape(), vShape = v.get_shape();
+        for (size_t i = 0; i < 2; i++) {
+            if (qShape[qOrder[i]] != kShape[kOrder[i]] || qShape[qOrder[i]] != vShape[vOrder[i]])
+                return false;
+        }
+
+        std::shared_ptr<ngraph::Node> replaced = outMatMul;
+        std::vector<int64_t> outOrder = plainOrder;
+        if (hasOneConsumer(outMatMul->output(0))) {
+            auto outTranspose = std::dynamic_pointer_cast<ngraph::opset1::Transpose>(
+                    outMatMul->output(0).get_target_inputs().begin()->get_node()->shared_from_this());
+            auto outTransposeOrder = outTranspose ?
+                    std::dynamic_pointer_cast<ngraph::opset1::Constant>(outTranspose->get_input_node_shared_ptr(1)) : nullptr;
+            if (outTransposeOrder && outTransposeOrder->cast_vector<int64_t>().size() == 4) {
+                outOrder = outTransposeOrder->cast_vector<int64_t>();
+                fusedNodes.push_back(outTranspose);
+                replaced = outTranspose;
+            }
+        }
+
+        ngraph::OutputVector inputs = {q, k, v};
+        if (mask.get_node())
+            inputs.push_back(mask);
+        auto mha = std::make_shared<MKLDNNPlugin::MHANode>(inputs, scale, qOrder, kOrder, vOrder, outOrder);
+        mha->set_friendly_name(replaced->get_friendly_name());
+        ngraph::copy_runtime_info(fusedNodes, mha);
+        ngraph::replace_node(replaced, mha);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MHAFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     Fuses scaled dot product attention into the MHA operation:
+ *
+ *     [Transpose] -> [Multiply(scale)] -> MatMul(Q, K) <- [Transpose]
+ *                                           |
+ *                                 [Multiply/Divide(scale)]
+ *                                           |
+ *                                      [Add(mask)]
+ *                                           |
+ *                                        Softmax
+ *                                           |
+ *                                    MatMul(scores, V) <- [Transpose]
+ *                                           |
+ *                                      [Transpose]
+ *
+ *     The transposes of Q, K, V and the result are folded into the orders of MHA, transposed MatMul inputs
+ *     are handled the same way. Scales must be scalar constants, the mask must not broadcast the scores.
+ */
+class MHAFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MHAFusion();
+};
+
+}  // namespace MKLDNNPlugin
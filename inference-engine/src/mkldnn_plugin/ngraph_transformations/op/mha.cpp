@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mha.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::MHANode::type_info;
+
+MKLDNNPlugin::MHANode::MHANode(const ngraph::OutputVector& args,
+                               const float scale,
+                               const std::vector<int64_t>& q_order,
+                               const std::vector<int64_t>& k_order,
+                               const std::vector<int64_t>& v_order,
+                               const std::vector<int64_t>& out_order)
+    : Op(args), m_scale(scale), m_q_order(q_order), m_k_order(k_order), m_v_order(v_order), m_out_order(out_order) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::MHANode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::MHANode>(new_args, m_scale, m_q_order, m_k_order, m_v_order, m_out_order);
+}
+
+void MKLDNNPlugin::MHANode::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_size() == 3 || get_input_size() == 4, "MHA expects 3 or 4 inputs, got ", get_input_size());
+
+    auto is_order = [](const std::vector<int64_t>& order) {
+        if (order.size() != 4)
+            return false;
+        std::vector<bool> used(4, false);
+        for (auto axis : order) {
+            if (axis < 0 || axis > 3 || used[axis])
+                return false;
+            used[axis] = true;
+        }
+        return true;
+    };
+    NODE_VALIDATION_CHECK(this, is_order(m_q_order) && is_order(m_k_order) && is_order(m_v_order) && is_order(m_out_order),
+                          "MHA orders must be permutations of 4 axes");
+
+    const auto& q_shape = get_input_partial_shape(0);
+    const auto& k_shape = get_input_partial_shape(1);
+    const auto& v_shape = get_input_partial_shape(2);
+    if (q_shape.rank().is_dynamic() || k_shape.rank().is_dynamic() || v_shape.rank().is_dynamic()) {
+        set_output_type(0, get_input_element_type(0), ngraph::PartialShape::dynamic(4));
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, q_shape.rank().get_length() == 4 && k_shape.rank().get_length() == 4 && v_shape.rank().get_length() == 4,
+                          "MHA expects 4D query, key and value");
+
+    auto transpose = [](const ngraph::PartialShape& shape, const std::vector<int64_t>& order) {
+        std::vector<ngraph::Dimension> dims(4);
+        for (size_t i = 0; i < 4; i++)
+            dims[i] = shape[order[i]];
+        return dims;
+    };
+    const auto q = transpose(q_shape, m_q_order);
+    const auto k = transpose(k_shape, m_k_order);
+    const auto v = transpose(v_shape, m_v_order);
+    NODE_VALIDATION_CHECK(this, q[0].compatible(k[0]) && q[0].compatible(v[0]) && q[1].compatible(k[1]) && q[1].compatible(v[1]),
+                          "MHA expects equal batch and head dimensions of query, key and value");
+    NODE_VALIDATION_CHECK(this, q[3].compatible(k[3]) && k[2].compatible(v[2]),
+                          "MHA expects matching head size of query and key and sequence length of key and value");
+
+    const std::vector<ngraph::Dimension> out = {q[0], q[1], q[2], v[3]};
+    std::vector<ngraph::Dimension> output_dims(4);
+    for (size_t i = 0; i < 4; i++)
+        output_dims[i] = out[m_out_order[i]];
+    set_output_type(0, get_input_element_type(0), ngraph::PartialShape(output_dims));
+}
+
+bool MKLDNNPlugin::MHANode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("q_order", m_q_order);
+    visitor.on_attribute("k_order", m_k_order);
+    visitor.on_attribute("v_order", m_v_order);
+    visitor.on_attribute("out_order", m_out_order);
+    return true;
+}
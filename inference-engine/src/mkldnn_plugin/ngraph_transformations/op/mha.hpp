@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Scaled dot product attention: Softmax(Q * K^T * scale + mask) * V
+ *
+ * Q, K and V are the 4D tensors transposed by q_order, k_order and v_order to the [B, H, S, D] layout
+ * (K is [B, H, Sk, D], V is [B, H, Sk, Dv]). The optional mask is broadcasted to [B, H, Sq, Sk] by the numpy rules.
+ * The result [B, H, Sq, Dv] is transposed by out_order.
+ */
+class MHANode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"MHA", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    MHANode() = default;
+
+    MHANode(const ngraph::OutputVector& args,
+            float scale,
+            const std::vector<int64_t>& q_order,
+            const std::vector<int64_t>& k_order,
+            const std::vector<int64_t>& v_order,
+            const std::vector<int64_t>& out_order);
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    bool has_mask() const { return get_input_size() == 4; }
+    float get_scale() const { return m_scale; }
+    const std::vector<int64_t>& get_q_order() const { return m_q_order; }
+    const std::vector<int64_t>& get_k_order() const { return m_k_order; }
+    const std::vector<int64_t>& get_v_order() const { return m_v_order; }
+    const std::vector<int64_t>& get_out_order() const { return m_out_order; }
+
+private:
+    float m_scale = 1.f;
+    std::vector<int64_t> m_q_order;
+    std::vector<int64_t> m_k_order;
+    std::vector<int64_t> m_v_order;
+    std::vector<int64_t> m_out_order;
+};
+
+}  // namespace MKLDNNPlugin
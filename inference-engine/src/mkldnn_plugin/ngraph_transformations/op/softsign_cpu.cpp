@@ -0,0 +1,25 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "softsign_cpu.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::SoftSignNode::type_info;
+
+MKLDNNPlugin::SoftSignNode::SoftSignNode(const ngraph::Output<ngraph::Node> & input)
+        : Op({input}) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::SoftSignNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::SoftSignNode>(new_args.at(0));
+}
+
+bool MKLDNNPlugin::SoftSignNode::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    return true;
+}
+
+void MKLDNNPlugin::SoftSignNode::validate_and_infer_types() {
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
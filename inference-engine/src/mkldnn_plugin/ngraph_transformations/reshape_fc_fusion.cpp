@@ -4,6 +4,7 @@
 
 #include "reshape_fc_fusion.hpp"
 #include "op/fully_connected.hpp"
+#include "matmul_weights_decompression.hpp"
 #include <numeric>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
@@ -35,6 +36,10 @@ MKLDNNPlugin::ReshapeFullyConnectedFusion::ReshapeFullyConnectedFusion() {
             return false;
         }
 
+        // Compressed weights are decompressed by FullyConnected only in [O, K] layout
+        if (MatMulWeightsDecompression::isWeightsDecompression(fc->input_value(1)))
+            return false;
+
         // Check that Weights[O, C*H*W] consistent with Input[N, C, H, W]
         auto shape_w = fc->input_value(1).get_shape();
         if (shape_in[0] != shape_out[0] || std::accumulate(shape_in.begin() + 1, shape_in.end(), size_t{1}, std::multiplies<size_t>()) != shape_w[1]) {
@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "softsign_fusion.hpp"
+#include "op/softsign_cpu.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::SoftSignFusion, "SoftSignFusion", 0);
+
+namespace {
+
+// checks that the constant is a scalar of the given value, which does not broadcast the input of the given rank
+bool isScalarEqualTo(const std::shared_ptr<ngraph::Node>& node, float value, size_t inputRank) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node);
+    return constant && ngraph::shape_size(constant->get_shape()) == 1 && constant->get_shape().size() <= inputRank &&
+           constant->cast_vector<float>()[0] == value;
+}
+
+}  // namespace
+
+MKLDNNPlugin::SoftSignFusion::SoftSignFusion() {
+    auto m_input = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto m_abs = ngraph::pattern::wrap_type<ngraph::opset1::Abs>({m_input});
+    auto m_one = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_add = ngraph::pattern::wrap_type<ngraph::opset1::Add>({m_abs, m_one});
+    auto m_exponent = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto m_power = ngraph::pattern::wrap_type<ngraph::opset1::Power>({m_add, m_exponent});
+    auto m_multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({m_input, m_power});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto input = pattern_to_output.at(m_input);
+        auto multiply = pattern_to_output.at(m_multiply).get_node_shared_ptr();
+        if (!input.get_element_type().is_real())
+            return false;
+
+        const size_t inputRank = input.get_partial_shape().rank().get_length();
+        if (!isScalarEqualTo(pattern_to_output.at(m_one).get_node_shared_ptr(), 1.f, inputRank) ||
+                !isScalarEqualTo(pattern_to_output.at(m_exponent).get_node_shared_ptr(), -1.f, inputRank))
+            return false;
+
+        auto softSign = std::make_shared<MKLDNNPlugin::SoftSignNode>(input);
+        softSign->set_friendly_name(multiply->get_friendly_name());
+        ngraph::copy_runtime_info({pattern_to_output.at(m_abs).get_node_shared_ptr(), pattern_to_output.at(m_add).get_node_shared_ptr(),
+                                   pattern_to_output.at(m_power).get_node_shared_ptr(), multiply}, softSign);
+        ngraph::replace_node(multiply, softSign);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_multiply, "SoftSignFusion");
+    this->register_matcher(m, callback);
+}
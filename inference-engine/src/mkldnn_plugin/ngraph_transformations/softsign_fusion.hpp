@@ -0,0 +1,32 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     Fuses the decomposed SoftSign x / (1 + |x|) into the SoftSignCPU operation:
+ *
+ *          x ----> Abs
+ *          |        |
+ *          |    Add(1)
+ *          |        |
+ *          |    Power(-1)
+ *          |        |
+ *          +--> Multiply
+ *
+ *     This is the form both the ONNX importer and the Model Optimizer produce once Divide is converted.
+ *     The constants must be scalars, so that they do not broadcast x.
+ */
+class SoftSignFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    SoftSignFusion();
+};
+
+}  // namespace MKLDNNPlugin
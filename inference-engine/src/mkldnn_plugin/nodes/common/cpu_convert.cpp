@@ -5,27 +5,424 @@
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "emitters/jit_load_store_emitters.hpp"
+#include <cpu/x64/jit_generator.hpp>
+#include <ngraph/type/float16.hpp>
 #include <mkldnn_selective_build.h>
 #include <type_traits>
+#include <limits>
+#include <cmath>
+#include <map>
+#include <mutex>
 #include <tuple>
 #include <ie_parallel.hpp>
 
 using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
 
 namespace {
 
-template<typename srcType, typename dstType>
-void convert(const void *srcPtr, void *dstPtr, const size_t size) {
-    if (std::is_same<srcType, dstType>::value) {
-        cpu_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
-    } else {
-        const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
-        dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
-
-        parallel_for(size, [&](size_t i) {
-            dstData[i] = static_cast<dstType>(srcData[i]);
-        });
+// Number of elements processed by one parallel task. Large enough to amortize the
+// task dispatch, small enough to keep both buffers of a task in L2.
+constexpr size_t blockSize = 4096;
+
+#define GET_OFF(field) offsetof(jit_convert_call_args, field)
+
+struct jit_convert_config_params {
+    Precision src_prc;
+    Precision dst_prc;
+    bool clamp;
+};
+
+struct jit_convert_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;     // number of full vectors to convert
+    float lo_f;             // saturation bounds, used when conversion goes through FP32
+    float hi_f;
+    int32_t lo_i;           // saturation bounds, used for integer to integer conversion
+    int32_t hi_i;
+};
+
+struct jit_uni_convert_kernel {
+    void (*ker_)(const jit_convert_call_args *);
+
+    void operator()(const jit_convert_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_convert_kernel(jit_convert_config_params jcp, size_t step) : ker_(nullptr), jcp_(jcp), step_(step) {}
+    virtual ~jit_uni_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_convert_config_params jcp_;
+    size_t step_;
+};
+
+inline bool isIntegral(Precision prc) {
+    return prc == Precision::I32 || prc == Precision::I16 || prc == Precision::U16 ||
+           prc == Precision::I8 || prc == Precision::U8;
+}
+
+template <cpu_isa_t isa>
+struct jit_uni_convert_kernel_f32 : public jit_uni_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_convert_kernel_f32)
+
+    explicit jit_uni_convert_kernel_f32(jit_convert_config_params jcp)
+        : jit_uni_convert_kernel(jcp, cpu_isa_traits<isa>::vlen / sizeof(float)), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        // Both sides are integers: stay in I32 to keep values above 2^24 exact.
+        exec_prc = isIntegral(jcp_.src_prc) && isIntegral(jcp_.dst_prc) ? Precision::I32 : Precision::FP32;
+
+        if (jcp_.src_prc != Precision::FP16)
+            load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        if (jcp_.dst_prc != Precision::FP16)
+            store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        if (jcp_.clamp) {
+            if (exec_prc == Precision::FP32) {
+                uni_vbroadcastss(vmm_lo, ptr[reg_params + GET_OFF(lo_f)]);
+                uni_vbroadcastss(vmm_hi, ptr[reg_params + GET_OFF(hi_f)]);
+            } else {
+                uni_vbroadcastss(vmm_lo, ptr[reg_params + GET_OFF(lo_i)]);
+                uni_vbroadcastss(vmm_hi, ptr[reg_params + GET_OFF(hi_i)]);
+            }
+        }
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            load();
+            if (jcp_.clamp)
+                saturate();
+            store();
+
+            add(reg_src, step_ * jcp_.src_prc.size());
+            add(reg_dst, step_ * jcp_.dst_prc.size());
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        this->postamble();
+
+        if (load_emitter)
+            load_emitter->emit_data();
+        if (store_emitter)
+            store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    Precision exec_prc;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rbp;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_lo = Vmm(1);
+    Vmm vmm_hi = Vmm(2);
+    Vmm vmm_zero = Vmm(3);
+    Vmm vmm_mask = Vmm(4);
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline void load() {
+        if (jcp_.src_prc == Precision::FP16) {
+            vcvtph2ps(vmm_val, ptr[reg_src]);
+        } else {
+            load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+                std::make_shared<load_emitter_context>(jcp_.src_prc, exec_prc, step_),
+                {}, {load_pool_gpr_idxs});
+        }
+    }
+
+    inline void saturate() {
+        if (exec_prc == Precision::FP32 && isIntegral(jcp_.dst_prc)) {
+            // NaN lanes become zero
+            if (isa == cpu::x64::sse41) {
+                movups(vmm_mask, vmm_val);
+                cmpps(vmm_mask, vmm_val, _cmp_eq_oq);
+                andps(vmm_val, vmm_mask);
+            } else if (isa == cpu::x64::avx2) {
+                vcmpps(vmm_mask, vmm_val, vmm_val, _cmp_eq_oq);
+                vandps(vmm_val, vmm_val, vmm_mask);
+            } else {
+                vcmpps(k_mask, vmm_val, vmm_val, _cmp_eq_oq);
+                vmovups(vmm_val | k_mask | T_z, vmm_val);
+            }
+            // truncate toward zero, so the store conversion below is exact
+            uni_vroundps(vmm_val, vmm_val, 3);
+            uni_vmaxps(vmm_val, vmm_val, vmm_lo);
+            if (jcp_.dst_prc == Precision::I32) {
+                // INT32_MAX has no float representation, so hi is 2^31: the lanes reaching it are converted
+                // to 0x80000000 by cvtps2dq and replaced with 0x7fffffff afterwards
+                if (isa == cpu::x64::sse41) {
+                    movups(vmm_mask, vmm_val);
+                    cmpps(vmm_mask, vmm_hi, _cmp_nlt_us);
+                    cvtps2dq(vmm_val, vmm_val);
+                    pxor(vmm_val, vmm_mask);
+                } else if (isa == cpu::x64::avx2) {
+                    vcmpps(vmm_mask, vmm_val, vmm_hi, _cmp_nlt_us);
+                    vcvtps2dq(vmm_val, vmm_val);
+                    vpxor(vmm_val, vmm_val, vmm_mask);
+                } else {
+                    vcmpps(k_mask, vmm_val, vmm_hi, _cmp_nlt_us);
+                    vcvtps2dq(vmm_val, vmm_val);
+                    mov(reg_load_store_mask.cvt32(), std::numeric_limits<int32_t>::max());
+                    vpbroadcastd(vmm_val | k_mask, reg_load_store_mask.cvt32());
+                }
+            } else {
+                uni_vminps(vmm_val, vmm_val, vmm_hi);
+            }
+        } else if (exec_prc == Precision::FP32) {
+            // FP16 destination (avx2 and newer): the second source is returned for NaN, so NaN is kept
+            vmaxps(vmm_val, vmm_lo, vmm_val);
+            vminps(vmm_val, vmm_hi, vmm_val);
+        } else if (isa == cpu::x64::sse41) {
+            pmaxsd(vmm_val, vmm_lo);
+            pminsd(vmm_val, vmm_hi);
+        } else {
+            vpmaxsd(vmm_val, vmm_val, vmm_lo);
+            vpminsd(vmm_val, vmm_val, vmm_hi);
+        }
+    }
+
+    // precision of vmm_val after saturate()
+    inline Precision store_prc() const {
+        return jcp_.clamp && exec_prc == Precision::FP32 && jcp_.dst_prc == Precision::I32 ? Precision::I32 : exec_prc;
     }
+
+    inline void store() {
+        if (jcp_.dst_prc == Precision::FP16) {
+            vcvtps2ph(ptr[reg_dst], vmm_val, 0x4);
+        } else {
+            store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+                std::make_shared<store_emitter_context>(store_prc(), jcp_.dst_prc, step_),
+                {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+        }
+    }
+};
+
+bool isJitSupported(Precision prc) {
+    return prc == Precision::FP32 || prc == Precision::BF16 || prc == Precision::FP16 || isIntegral(prc);
+}
+
+void getRange(Precision prc, double &lo, double &hi) {
+    switch (prc) {
+        case Precision::U8:   lo = std::numeric_limits<uint8_t>::lowest();  hi = std::numeric_limits<uint8_t>::max();  break;
+        case Precision::I8:   lo = std::numeric_limits<int8_t>::lowest();   hi = std::numeric_limits<int8_t>::max();   break;
+        case Precision::U16:  lo = std::numeric_limits<uint16_t>::lowest(); hi = std::numeric_limits<uint16_t>::max(); break;
+        case Precision::I16:  lo = std::numeric_limits<int16_t>::lowest();  hi = std::numeric_limits<int16_t>::max();  break;
+        case Precision::I32:  lo = std::numeric_limits<int32_t>::lowest();  hi = std::numeric_limits<int32_t>::max();  break;
+        case Precision::FP16: lo = std::numeric_limits<ngraph::float16>::lowest(); hi = std::numeric_limits<ngraph::float16>::max(); break;
+        default:              lo = std::numeric_limits<float>::lowest();    hi = std::numeric_limits<float>::max();    break;
+    }
+}
+
+// Largest float not exceeding the given bound in magnitude: (float)INT32_MAX rounds up to 2^31.
+float toInnerFloat(double bound) {
+    float f = static_cast<float>(bound);
+    if (static_cast<double>(f) != bound)
+        f = std::nextafter(f, 0.f);
+    return f;
+}
+
+class ConvertKernelCache {
+public:
+    static std::shared_ptr<jit_uni_convert_kernel> get(Precision srcPrc, Precision dstPrc) {
+        static ConvertKernelCache cache;
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        const auto key = std::make_pair(static_cast<Precision::ePrecision>(srcPrc), static_cast<Precision::ePrecision>(dstPrc));
+        auto found = cache.kernels.find(key);
+        if (found != cache.kernels.end())
+            return found->second;
+        auto kernel = create(srcPrc, dstPrc);
+        cache.kernels[key] = kernel;
+        return kernel;
+    }
+
+private:
+    static std::shared_ptr<jit_uni_convert_kernel> create(Precision srcPrc, Precision dstPrc) {
+        if (!isJitSupported(srcPrc) || !isJitSupported(dstPrc) || !mayiuse(cpu::x64::sse41))
+            return nullptr;
+        // vcvtph2ps/vcvtps2ph (F16C) are not available on sse41 only machines
+        if ((srcPrc == Precision::FP16 || dstPrc == Precision::FP16) && !mayiuse(cpu::x64::avx2))
+            return nullptr;
+        if (dstPrc == Precision::BF16 && !mayiuse(cpu::x64::avx512_core))
+            return nullptr;
+
+        double srcLo, srcHi, dstLo, dstHi;
+        getRange(srcPrc, srcLo, srcHi);
+        getRange(dstPrc, dstLo, dstHi);
+
+        jit_convert_config_params jcp;
+        jcp.src_prc = srcPrc;
+        jcp.dst_prc = dstPrc;
+        jcp.clamp = dstLo > srcLo || dstHi < srcHi;
+
+        std::shared_ptr<jit_uni_convert_kernel> kernel;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::avx2>(jcp));
+        } else {
+            kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::sse41>(jcp));
+        }
+        kernel->create_ker();
+        return kernel;
+    }
+
+    std::mutex mutex;
+    std::map<std::pair<Precision::ePrecision, Precision::ePrecision>, std::shared_ptr<jit_uni_convert_kernel>> kernels;
+};
+
+/**
+ * Converts the leading full vectors of the buffer with the JIT kernel.
+ * @return number of converted elements; the rest should be converted by the reference path
+ */
+size_t jitConvert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
+    auto kernel = ConvertKernelCache::get(srcPrc, dstPrc);
+    if (!kernel || size < kernel->step_)
+        return 0;
+
+    double dstLo, dstHi;
+    getRange(dstPrc, dstLo, dstHi);
+
+    const size_t step = kernel->step_;
+    const size_t vectors = size / step;
+    const size_t blockVectors = blockSize / step;
+    const auto src = reinterpret_cast<const uint8_t *>(srcPtr);
+    const auto dst = reinterpret_cast<uint8_t *>(dstPtr);
+
+    parallel_for(div_up(vectors, blockVectors), [&](size_t block) {
+        const size_t start = block * blockVectors * step;
+
+        auto arg = jit_convert_call_args();
+        arg.src = src + start * srcPrc.size();
+        arg.dst = dst + start * dstPrc.size();
+        arg.work_amount = std::min(blockVectors, vectors - block * blockVectors);
+        arg.lo_f = toInnerFloat(dstLo);
+        // I32 is saturated by the kernel itself against 2^31, see saturate()
+        arg.hi_f = dstPrc == Precision::I32 ? static_cast<float>(dstHi) : toInnerFloat(dstHi);
+        arg.lo_i = static_cast<int32_t>(std::max<double>(dstLo, std::numeric_limits<int32_t>::lowest()));
+        arg.hi_i = static_cast<int32_t>(std::min<double>(dstHi, std::numeric_limits<int32_t>::max()));
+        (*kernel)(&arg);
+    });
+
+    return vectors * step;
+}
+
+template <typename T>
+struct is_float_like : std::integral_constant<bool, std::is_floating_point<T>::value ||
+                                                     std::is_same<T, bfloat16_t>::value ||
+                                                     std::is_same<T, ngraph::float16>::value> {};
+
+template <typename T>
+inline typename std::enable_if<std::is_signed<T>::value, bool>::type isNegative(T val) { return val < 0; }
+
+template <typename T>
+inline typename std::enable_if<!std::is_signed<T>::value, bool>::type isNegative(T) { return false; }
+
+// integer -> integer
+template <typename dstType, typename srcType>
+inline typename std::enable_if<std::is_integral<srcType>::value && std::is_integral<dstType>::value, dstType>::type
+saturate_cast(srcType val) {
+    if (isNegative(val)) {
+        return static_cast<int64_t>(val) < static_cast<int64_t>(std::numeric_limits<dstType>::lowest()) ?
+               std::numeric_limits<dstType>::lowest() : static_cast<dstType>(val);
+    }
+    return static_cast<uint64_t>(val) > static_cast<uint64_t>(std::numeric_limits<dstType>::max()) ?
+           std::numeric_limits<dstType>::max() : static_cast<dstType>(val);
+}
+
+// floating point -> integer: truncate toward zero, NaN becomes zero
+template <typename dstType, typename srcType>
+inline typename std::enable_if<is_float_like<srcType>::value && std::is_integral<dstType>::value, dstType>::type
+saturate_cast(srcType val) {
+    const float value = static_cast<float>(val);
+    if (std::isnan(value))
+        return 0;
+    if (value <= static_cast<float>(std::numeric_limits<dstType>::lowest()))
+        return std::numeric_limits<dstType>::lowest();
+    if (value >= static_cast<float>(std::numeric_limits<dstType>::max()))
+        return std::numeric_limits<dstType>::max();
+    return static_cast<dstType>(value);
+}
+
+// any -> FP16: clamp to the finite FP16 range
+template <typename dstType, typename srcType>
+inline typename std::enable_if<std::is_same<dstType, ngraph::float16>::value, dstType>::type
+saturate_cast(srcType val) {
+    const float value = static_cast<float>(val);
+    const float fp16Max = std::numeric_limits<ngraph::float16>::max();
+    return dstType(value > fp16Max ? fp16Max : value < -fp16Max ? -fp16Max : value);
+}
+
+// any -> FP32/BF16
+template <typename dstType, typename srcType>
+inline typename std::enable_if<is_float_like<dstType>::value && !std::is_same<dstType, ngraph::float16>::value, dstType>::type
+saturate_cast(srcType val) {
+    return dstType(static_cast<float>(val));
+}
+
+template<typename srcType, typename dstType>
+void convert(const void *srcPtr, void *dstPtr, const size_t size, bool toBool) {
+    const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
+    dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
+
+    parallel_for(div_up(size, blockSize), [&](size_t block) {
+        const size_t start = block * blockSize;
+        const size_t end = std::min(size, start + blockSize);
+        if (toBool) {
+            for (size_t i = start; i < end; i++)
+                dstData[i] = saturate_cast<dstType>(static_cast<uint8_t>(static_cast<float>(srcData[i]) != 0.f));
+        } else {
+            for (size_t i = start; i < end; i++)
+                dstData[i] = saturate_cast<dstType>(srcData[i]);
+        }
+    });
 }
 
 template <Precision::ePrecision p>
@@ -38,10 +435,16 @@ struct PrecisionInfo<Precision::BF16> {
     using value_type = MKLDNNPlugin::bfloat16_t;
 };
 
+template <>
+struct PrecisionInfo<Precision::FP16> {
+    using value_type = ngraph::float16;
+};
+
 struct ConvertContext {
     const void *srcPtr;
     void *dstPtr;
     size_t size;
+    bool toBool;
     bool converted;
 };
 
@@ -51,7 +454,7 @@ struct ConvertPrecision {
     using dst_t = typename std::tuple_element<1, T>::type;
 
     void operator()(ConvertContext & ctx) {
-        convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size);
+        convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size, ctx.toBool);
         ctx.converted = true;
     }
 };
@@ -71,42 +474,63 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
-    ConvertContext ctx = { srcPtr, dstPtr, size, false };
+    const size_t done = jitConvert(srcPtr, dstPtr, srcPrc, dstPrc, size);
+    if (done == size)
+        return;
+
+    ConvertContext ctx = { reinterpret_cast<const uint8_t *>(srcPtr) + done * srcPrc.size(),
+                           reinterpret_cast<uint8_t *>(dstPtr) + done * dstPrc.size(),
+                           size - done, dstPrc == Precision::BOOL, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
     MKLDNN_CVT(U8, I8),    MKLDNN_CVT(U8, U16),    MKLDNN_CVT(U8, I16),
     MKLDNN_CVT(U8, I32),   MKLDNN_CVT(U8, U64),    MKLDNN_CVT(U8, I64),
-    MKLDNN_CVT(U8, FP32),  MKLDNN_CVT(U8, BF16),   MKLDNN_CVT(U8, BOOL),
+    MKLDNN_CVT(U8, FP32),  MKLDNN_CVT(U8, FP16),   MKLDNN_CVT(U8, BF16),
+    MKLDNN_CVT(U8, BOOL),
     MKLDNN_CVT(I8, U8),    MKLDNN_CVT(I8, U16),    MKLDNN_CVT(I8, I16),
     MKLDNN_CVT(I8, I32),   MKLDNN_CVT(I8, U64),    MKLDNN_CVT(I8, I64),
-    MKLDNN_CVT(I8, FP32),  MKLDNN_CVT(I8, BF16),   MKLDNN_CVT(I8, BOOL),
+    MKLDNN_CVT(I8, FP32),  MKLDNN_CVT(I8, FP16),   MKLDNN_CVT(I8, BF16),
+    MKLDNN_CVT(I8, BOOL),
     MKLDNN_CVT(U16, U8),   MKLDNN_CVT(U16, I8),    MKLDNN_CVT(U16, I16),
     MKLDNN_CVT(U16, I32),  MKLDNN_CVT(U16, U64),   MKLDNN_CVT(U16, I64),
-    MKLDNN_CVT(U16, FP32), MKLDNN_CVT(U16, BF16),  MKLDNN_CVT(U16, BOOL),
+    MKLDNN_CVT(U16, FP32), MKLDNN_CVT(U16, FP16),  MKLDNN_CVT(U16, BF16),
+    MKLDNN_CVT(U16, BOOL),
     MKLDNN_CVT(I16, U8),   MKLDNN_CVT(I16, I8),    MKLDNN_CVT(I16, U16),
     MKLDNN_CVT(I16, I32),  MKLDNN_CVT(I16, U64),   MKLDNN_CVT(I16, I64),
-    MKLDNN_CVT(I16, FP32), MKLDNN_CVT(I16, BF16),  MKLDNN_CVT(I16, BOOL),
+    MKLDNN_CVT(I16, FP32), MKLDNN_CVT(I16, FP16),  MKLDNN_CVT(I16, BF16),
+    MKLDNN_CVT(I16, BOOL),
     MKLDNN_CVT(I32, U8),   MKLDNN_CVT(I32, I8),    MKLDNN_CVT(I32, U16),
     MKLDNN_CVT(I32, I16),  MKLDNN_CVT(I32, U64),   MKLDNN_CVT(I32, I64),
-    MKLDNN_CVT(I32, FP32), MKLDNN_CVT(I32, BF16),  MKLDNN_CVT(I32, BOOL),
+    MKLDNN_CVT(I32, FP32), MKLDNN_CVT(I32, FP16),  MKLDNN_CVT(I32, BF16),
+    MKLDNN_CVT(I32, BOOL),
     MKLDNN_CVT(U64, U8),   MKLDNN_CVT(U64, I8),    MKLDNN_CVT(U64, U16),
     MKLDNN_CVT(U64, I16),  MKLDNN_CVT(U64, I32),   MKLDNN_CVT(U64, I64),
-    MKLDNN_CVT(U64, FP32), MKLDNN_CVT(U64, BF16),  MKLDNN_CVT(U64, BOOL),
+    MKLDNN_CVT(U64, FP32), MKLDNN_CVT(U64, FP16),  MKLDNN_CVT(U64, BF16),
+    MKLDNN_CVT(U64, BOOL),
     MKLDNN_CVT(I64, U8),   MKLDNN_CVT(I64, I8),    MKLDNN_CVT(I64, U16),
     MKLDNN_CVT(I64, I16),  MKLDNN_CVT(I64, I32),   MKLDNN_CVT(I64, U64),
-    MKLDNN_CVT(I64, FP32), MKLDNN_CVT(I64, BF16),  MKLDNN_CVT(I64, BOOL),
+    MKLDNN_CVT(I64, FP32), MKLDNN_CVT(I64, FP16),  MKLDNN_CVT(I64, BF16),
+    MKLDNN_CVT(I64, BOOL),
     MKLDNN_CVT(FP32, U8),  MKLDNN_CVT(FP32, I8),   MKLDNN_CVT(FP32, U16),
     MKLDNN_CVT(FP32, I16), MKLDNN_CVT(FP32, I32),  MKLDNN_CVT(FP32, U64),
-    MKLDNN_CVT(FP32, I64), MKLDNN_CVT(FP32, BF16), MKLDNN_CVT(FP32, BOOL),
+    MKLDNN_CVT(FP32, I64), MKLDNN_CVT(FP32, FP16), MKLDNN_CVT(FP32, BF16),
+    MKLDNN_CVT(FP32, BOOL),
+    MKLDNN_CVT(FP16, U8),  MKLDNN_CVT(FP16, I8),   MKLDNN_CVT(FP16, U16),
+    MKLDNN_CVT(FP16, I16), MKLDNN_CVT(FP16, I32),  MKLDNN_CVT(FP16, U64),
+    MKLDNN_CVT(FP16, I64), MKLDNN_CVT(FP16, FP32), MKLDNN_CVT(FP16, BF16),
+    MKLDNN_CVT(FP16, BOOL),
     MKLDNN_CVT(BF16, U8),  MKLDNN_CVT(BF16, I8),   MKLDNN_CVT(BF16, U16),
     MKLDNN_CVT(BF16, I16), MKLDNN_CVT(BF16, I32),  MKLDNN_CVT(BF16, U64),
-    MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, BOOL),
+    MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, FP16),
+    MKLDNN_CVT(BF16, BOOL),
     MKLDNN_CVT(BOOL, U8),  MKLDNN_CVT(BOOL, I8),   MKLDNN_CVT(BOOL, U16),
     MKLDNN_CVT(BOOL, I16), MKLDNN_CVT(BOOL, I32),  MKLDNN_CVT(BOOL, U64),
-    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16));
+    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, FP16),
+    MKLDNN_CVT(BOOL, BF16));
 
     if (!ctx.converted)
         IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
 }
 
 #undef MKLDNN_CVT
+#undef GET_OFF
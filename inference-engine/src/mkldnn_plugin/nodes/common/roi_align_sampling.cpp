@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roi_align_sampling.h"
+
+#include <cmath>
+
+namespace MKLDNNPlugin {
+
+void buildROIAlignSamplingTable(float x1, float y1, float x2, float y2, int H, int W,
+                                int pooledH, int pooledW, int samplingRatio, ROIAlignSamplingTable &table) {
+    // malformed ROIs are forced to be 1x1
+    const float roiHeight = std::max(y2 - y1, 1.0f);
+    const float roiWidth = std::max(x2 - x1, 1.0f);
+    const float binHeight = roiHeight / pooledH;
+    const float binWidth = roiWidth / pooledW;
+
+    const int samplingRatioX = samplingRatio > 0 ? samplingRatio : static_cast<int>(std::ceil(binWidth));
+    const int samplingRatioY = samplingRatio > 0 ? samplingRatio : static_cast<int>(std::ceil(binHeight));
+    const float sampleDistanceX = binWidth / samplingRatioX;
+    const float sampleDistanceY = binHeight / samplingRatioY;
+
+    table.samplesPerBin = samplingRatioX * samplingRatioY;
+    const size_t records = 4 * static_cast<size_t>(table.samplesPerBin) * pooledH * pooledW;
+    table.positions.resize(records);
+    table.weights.resize(records);
+
+    int *pos = table.positions.data();
+    float *weight = table.weights.data();
+    for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
+        for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
+            for (int ySampleInd = 0; ySampleInd < samplingRatioY; ySampleInd++) {
+                float sampleY = y1 + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
+                for (int xSampleInd = 0; xSampleInd < samplingRatioX; xSampleInd++, pos += 4, weight += 4) {
+                    float sampleX = x1 + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
+                    float y = sampleY;
+                    if (sampleX < -1.0f || sampleX > W || y < -1.0f || y > H) {
+                        // the sample is out of the feature map, so it contributes nothing
+                        std::fill(pos, pos + 4, 0);
+                        std::fill(weight, weight + 4, 0.f);
+                        continue;
+                    }
+                    sampleX = std::max(sampleX, 0.f);
+                    y = std::max(y, 0.f);
+
+                    int yLow = static_cast<int>(y);
+                    int xLow = static_cast<int>(sampleX);
+                    int yHigh, xHigh;
+                    if (yLow >= H - 1) {
+                        yHigh = yLow = H - 1;
+                        y = static_cast<float>(yLow);
+                    } else {
+                        yHigh = yLow + 1;
+                    }
+                    if (xLow >= W - 1) {
+                        xHigh = xLow = W - 1;
+                        sampleX = static_cast<float>(xLow);
+                    } else {
+                        xHigh = xLow + 1;
+                    }
+
+                    pos[0] = yLow * W + xLow;
+                    pos[1] = yLow * W + xHigh;
+                    pos[2] = yHigh * W + xLow;
+                    pos[3] = yHigh * W + xHigh;
+
+                    const float ly = y - yLow;
+                    const float lx = sampleX - xLow;
+                    const float hy = 1.0f - ly;
+                    const float hx = 1.0f - lx;
+                    weight[0] = hy * hx;
+                    weight[1] = hy * lx;
+                    weight[2] = ly * hx;
+                    weight[3] = ly * lx;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace MKLDNNPlugin
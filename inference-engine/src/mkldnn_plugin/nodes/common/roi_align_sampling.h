@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Bilinear sampling points of a single ROI, shared by all channels.
+ * For every bin there are samplesPerBin records of 4 neighbour positions (y * W + x) and 4 weights.
+ */
+struct ROIAlignSamplingTable {
+    int samplesPerBin = 0;
+    std::vector<int> positions;
+    std::vector<float> weights;
+};
+
+/**
+ * Precomputes the sampling table of the ROI given by its corners already scaled to the feature map.
+ * non-positive samplingRatio means adaptive number of samples (ceil of the bin size).
+ */
+void buildROIAlignSamplingTable(float x1, float y1, float x2, float y2, int H, int W,
+                                int pooledH, int pooledW, int samplingRatio, ROIAlignSamplingTable &table);
+
+/**
+ * Pools one bin for a run of channels with the precomputed table.
+ * Channel values of the same spatial position must be contiguous (nhwc / blocked layouts) for the inner loops
+ * to vectorize, the planar layout is processed with channels == 1.
+ *
+ * @param src pointer to the first channel of the run at spatial position 0
+ * @param spatialStride distance in elements between neighbouring spatial positions
+ * @param dst pointer to the output value of the first channel, channels are stored contiguously
+ */
+template <typename inputType, typename outputType>
+void roiAlignPoolBin(const ROIAlignSamplingTable &table, int bin, bool maxMode,
+                     const inputType *src, size_t spatialStride, int channels, outputType *dst) {
+    constexpr int chunk = 64;
+    float acc[chunk];
+
+    const int samples = table.samplesPerBin;
+    const int *positions = table.positions.data() + 4 * bin * samples;
+    const float *weights = table.weights.data() + 4 * bin * samples;
+    const float avgScale = samples > 0 ? 1.f / samples : 0.f;
+
+    for (int cStart = 0; cStart < channels; cStart += chunk) {
+        const int cCount = std::min(chunk, channels - cStart);
+        std::fill(acc, acc + cCount, 0.f);
+
+        for (int s = 0; s < samples; s++) {
+            const int *pos = positions + 4 * s;
+            const float *w = weights + 4 * s;
+            const inputType *p0 = src + pos[0] * spatialStride + cStart;
+            const inputType *p1 = src + pos[1] * spatialStride + cStart;
+            const inputType *p2 = src + pos[2] * spatialStride + cStart;
+            const inputType *p3 = src + pos[3] * spatialStride + cStart;
+
+            if (maxMode) {
+                for (int c = 0; c < cCount; c++) {
+                    const float v = std::max(std::max(w[0] * static_cast<float>(p0[c]), w[1] * static_cast<float>(p1[c])),
+                                             std::max(w[2] * static_cast<float>(p2[c]), w[3] * static_cast<float>(p3[c])));
+                    acc[c] = std::max(acc[c], v);
+                }
+            } else {
+                for (int c = 0; c < cCount; c++) {
+                    acc[c] += w[0] * static_cast<float>(p0[c]) + w[1] * static_cast<float>(p1[c]) +
+                              w[2] * static_cast<float>(p2[c]) + w[3] * static_cast<float>(p3[c]);
+                }
+            }
+        }
+
+        if (!maxMode) {
+            for (int c = 0; c < cCount; c++)
+                acc[c] *= avgScale;
+        }
+        for (int c = 0; c < cCount; c++)
+            dst[cStart + c] = static_cast<outputType>(acc[c]);
+    }
+}
+
+}  // namespace MKLDNNPlugin
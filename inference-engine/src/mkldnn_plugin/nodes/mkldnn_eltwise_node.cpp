@@ -29,6 +29,7 @@
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
+#include "ngraph_transformations/op/softsign_cpu.hpp"
 
 #include <string>
 #include <vector>
@@ -411,7 +412,15 @@ private:
         OV_CASE(EltwiseLogicalNot, jit_logical_not_emitter),
         OV_CASE(EltwisePowerStatic, jit_power_static_emitter),
         OV_CASE(EltwisePrelu, jit_prelu_emitter),
-        OV_CASE(EltwiseErf, jit_erf_emitter));
+        OV_CASE(EltwiseErf, jit_erf_emitter),
+        OV_CASE(EltwiseLog, jit_mkldnn_aux_emitter),
+        OV_CASE(EltwiseNegative, jit_negative_emitter),
+        OV_CASE(EltwiseFloor, jit_floor_emitter),
+        OV_CASE(EltwiseCeiling, jit_ceiling_emitter),
+        OV_CASE(EltwiseSign, jit_sign_emitter),
+        OV_CASE(EltwiseSin, jit_sin_emitter),
+        OV_CASE(EltwiseCos, jit_cos_emitter),
+        OV_CASE(EltwiseSoftSign, jit_softsign_emitter));
 
         if (precisions.empty())
             IE_THROW() << "Unsupported operation type for Eltwise emitter";
@@ -470,7 +479,15 @@ private:
         OV_CASE(EltwiseLogicalNot, jit_logical_not_emitter),
         OV_CASE(EltwisePowerStatic, jit_power_static_emitter),
         OV_CASE(EltwisePrelu, jit_prelu_emitter),
-        OV_CASE(EltwiseErf, jit_erf_emitter));
+        OV_CASE(EltwiseErf, jit_erf_emitter),
+        OV_CASE(EltwiseLog, jit_mkldnn_aux_emitter),
+        OV_CASE(EltwiseNegative, jit_negative_emitter),
+        OV_CASE(EltwiseFloor, jit_floor_emitter),
+        OV_CASE(EltwiseCeiling, jit_ceiling_emitter),
+        OV_CASE(EltwiseSign, jit_sign_emitter),
+        OV_CASE(EltwiseSin, jit_sin_emitter),
+        OV_CASE(EltwiseCos, jit_cos_emitter),
+        OV_CASE(EltwiseSoftSign, jit_softsign_emitter));
 
         if (!ctx.emitter)
             IE_THROW() << "Unsupported operation type for Eltwise emitter";
@@ -548,6 +565,9 @@ private:
                     vpmovzxwd(vmm_src, op);
                     uni_vpslld(vmm_src, vmm_src, 16);
                     break;
+                case Precision::FP16:
+                    vcvtph2ps(vmm_src, op);
+                    break;
                 case Precision::U16:
                     uni_vpmovzxwd(vmm_src, op);
                     break;
@@ -566,11 +586,11 @@ private:
 
             switch (dst_prc) {
                 case Precision::FP32:
-                    if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                    if (!one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                         uni_vcvtdq2ps(vmm_src, vmm_src);
                     break;
                 case Precision::I32:
-                    if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                    if (one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                         uni_vcvtps2dq(vmm_src, vmm_src);
                     break;
                 default:
@@ -589,6 +609,10 @@ private:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpslld(xmm_src, xmm_src, 16);
                 break;
+            case Precision::FP16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0);
+                vcvtph2ps(xmm_src, xmm_src);
+                break;
             case Precision::I16:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpmovsxwd(xmm_src, op);
@@ -611,11 +635,11 @@ private:
 
         switch (dst_prc) {
             case Precision::FP32:
-                if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                if (!one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtdq2ps(xmm_src, xmm_src);
                 break;
             case Precision::I32:
-                if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                if (one_of(src_prc, Precision::FP32, Precision::BF16, Precision::FP16))
                     uni_vcvtps2dq(xmm_src, xmm_src);
                 break;
             default:
@@ -935,6 +959,31 @@ std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_pt
         node.algorithm = EltwiseSoftRelu;
         node.mkldnnAlgorithm = mkldnn::algorithm::eltwise_soft_relu;
     }},
+    {ngraph::op::v0::Log::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseLog;
+        node.mkldnnAlgorithm = mkldnn::algorithm::eltwise_log;
+    }},
+    {ngraph::op::v0::Negative::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseNegative;
+    }},
+    {ngraph::op::v0::Floor::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseFloor;
+    }},
+    {ngraph::op::v0::Ceiling::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseCeiling;
+    }},
+    {ngraph::op::v0::Sign::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseSign;
+    }},
+    {ngraph::op::v0::Sin::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseSin;
+    }},
+    {ngraph::op::v0::Cos::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseCos;
+    }},
+    {SoftSignNode::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNEltwiseNode& node) {
+        node.algorithm = EltwiseSoftSign;
+    }},
 };
 
 MKLDNNEltwiseNode::MKLDNNEltwiseNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
@@ -952,6 +1001,8 @@ size_t MKLDNNEltwiseNode::getOpInputsNum() const {
         case EltwiseRelu: case EltwiseGelu: case EltwiseElu: case EltwiseTanh: case EltwiseSigmoid: case EltwiseAbs: case EltwiseSqrt:
         case EltwiseSoftRelu: case EltwiseExp: case EltwiseClamp: case EltwiseErf: case EltwiseLogicalNot: case EltwisePowerStatic:
         case EltwiseSwish: case EltwiseHswish: case EltwiseMish: case EltwiseHsigmoid: case EltwiseRoundHalfToEven: case EltwiseRoundHalfAwayFromZero:
+        case EltwiseLog: case EltwiseNegative: case EltwiseFloor: case EltwiseCeiling: case EltwiseSign: case EltwiseSin: case EltwiseCos:
+        case EltwiseSoftSign:
             return 1;
         case EltwiseAdd: case EltwiseSubtract: case EltwiseMultiply: case EltwiseDivide: case EltwiseFloorMod: case EltwiseMod: case EltwiseMaximum:
         case EltwiseMinimum: case EltwiseSquaredDifference: case EltwisePowerDynamic: case EltwiseEqual: case EltwiseNotEqual: case EltwiseGreater:
@@ -992,6 +1043,9 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
             Precision::BF16,
             Precision::I32
     };
+    // FP16 inputs (kept FP16 weights) are converted by F16C instructions, which are not available on sse41 only machines
+    if (mayiuse(x64::avx2))
+        supportedPrecisions.push_back(Precision::FP16);
 
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -1051,6 +1105,8 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         } else if (std::find(supportedPrecisions.begin(), supportedPrecisions.end(), prc) == supportedPrecisions.end()) {
             if (prc == Precision::U32 || prc == Precision::I64 || prc == Precision::U64) {
                 return Precision(Precision::I32);
+            } else if (prc == Precision::FP16) {
+                return Precision(Precision::FP32);
             } else {
                 IE_THROW() << "Eltwise node with name `" << getName() << "` doesn't support " << prc << " precision.";
             }
@@ -1063,6 +1119,9 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         inputPrecisions[i] = filterPrecision(inputPrecisions[i]);
     }
     outputPrecision = filterPrecision(outputPrecision);
+    // FP16 is supported only for the inputs
+    if (outputPrecision == Precision::FP16)
+        outputPrecision = Precision::FP32;
 
     // TODO: delete after new LPT (ngraph based) is merged
     // WA is needed to handle bug in LPT that produces wrong precision after average pooling (I8/U8 instead of FP32)
@@ -1563,6 +1622,7 @@ void MKLDNNEltwiseNode::executeReference(const std::vector<const uint8_t *>& src
                 case EltwiseRelu: case EltwiseGelu: case EltwiseElu: case EltwiseTanh: case EltwiseSigmoid: case EltwiseAbs:
                 case EltwiseSqrt: case EltwiseSoftRelu: case EltwiseExp: case EltwiseClamp:
                 case EltwiseSwish: case EltwiseHswish: case EltwiseMish: case EltwiseHsigmoid: case EltwiseRoundHalfToEven: case EltwiseRoundHalfAwayFromZero:
+                case EltwiseLog:
                     *dst_ptr_f = ref_eltwise_injector->compute_scalar(src_f[0]); break;
                 case EltwiseAdd:               *dst_ptr_f = src_f[0] + src_f[1]; break;
                 case EltwiseMulAdd:            *dst_ptr_f = src_f[0] * src_f[1] + src_f[2]; break;
@@ -1587,6 +1647,14 @@ void MKLDNNEltwiseNode::executeReference(const std::vector<const uint8_t *>& src
                 case EltwiseLogicalNot:        *dst_ptr_f = !src_f[0]; break;
                 case EltwisePowerStatic:       *dst_ptr_f = powf(beta * src_f[0] + gamma, alpha); break;
                 case EltwisePrelu:             *dst_ptr_f = src_f[0] > 0 ? src_f[0] : src_f[0] * src_f[1]; break;
+                case EltwiseErf:               *dst_ptr_f = std::erf(src_f[0]); break;
+                case EltwiseNegative:          *dst_ptr_f = -src_f[0]; break;
+                case EltwiseFloor:             *dst_ptr_f = floorf(src_f[0]); break;
+                case EltwiseCeiling:           *dst_ptr_f = ceilf(src_f[0]); break;
+                case EltwiseSign:              *dst_ptr_f = (src_f[0] > 0.f) - (src_f[0] < 0.f); break;
+                case EltwiseSin:               *dst_ptr_f = sinf(src_f[0]); break;
+                case EltwiseCos:               *dst_ptr_f = cosf(src_f[0]); break;
+                case EltwiseSoftSign:          *dst_ptr_f = src_f[0] / (1.f + std::fabs(src_f[0])); break;
                 default: IE_THROW() << "Unsupported operation type for Eltwise node with name `" << getName() << "`";
             }
         }
@@ -1678,6 +1746,7 @@ void MKLDNNEltwiseNode::appendPostOps(mkldnn::post_ops& ops) {
             case mkldnn::algorithm::eltwise_hsigmoid:
             case mkldnn::algorithm::eltwise_round_half_to_even:
             case mkldnn::algorithm::eltwise_round_half_away_from_zero:
+            case mkldnn::algorithm::eltwise_log:
                 ops.append_eltwise(1.0, getMKLDNNAlgorithm(), getAlpha(), getBeta());
                 break;
             default: IE_THROW() << errorPrefix << "as post operation is not supported";
@@ -102,6 +102,9 @@ public:
 
     InferenceEngine::Precision getInputPrecision() const { return inputPrecision; }
     InferenceEngine::Precision getOutputPrecision() const { return outputPrecision; }
+    void setOutputPrecision(InferenceEngine::Precision newOutputPrecision) { outputPrecision = newOutputPrecision; }
+
+    size_t getLevels() const { return levels; }
 
     void appendPostOps(mkldnn::post_ops& ops) override;
 
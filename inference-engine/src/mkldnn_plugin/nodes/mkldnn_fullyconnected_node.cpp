@@ -9,13 +9,302 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <ie_parallel.hpp>
 #include "utils/general_utils.h"
+#include "utils/bfloat16.hpp"
+#include <ngraph/type/float16.hpp>
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_call_args, field)
+
+namespace {
+// The lengths of the weights blocks along K which are tried for the sparse weights, from the whole vector register down
+const size_t sparseBlockSizes[] = {16, 8, 4, 1};
+const size_t vectorLength = 16;
+// The cost of reading the column of a block relative to a vector operation
+const float blockAddressingCost = 0.5f;
+// The sparse weights are used if their estimated cost is less than this part of the dense inner product cost
+const float maxSparseCostRatio = 0.5f;
+// The cost of a vector of outputs passed through a separate node instead of a post operation: the node reads and
+// writes the outputs once more and is dispatched on its own
+const float unfusedOperationCost = 4.f;
+
+// The number of the weights values processed by one iteration of the decompression kernel
+const size_t decompressionChunk = 32;
+// The number of the input rows multiplied by the same dequantized weights in registers
+const size_t maxDecompressionRows = 4;
+
+// The 4-bit value k goes to the byte k % 16 of its chunk, into the low half for the first 16 values of the chunk, so
+// the kernel unpacks two vectors of the values from the same bytes by shifts only
+inline size_t int4ByteOffset(size_t k) {
+    return k / decompressionChunk * (decompressionChunk / 2) + k % (decompressionChunk / 2);
+}
+
+inline int int4Shift(size_t k) {
+    return k % decompressionChunk < decompressionChunk / 2 ? 0 : 4;
+}
+
+inline size_t int4RowSize(size_t K) {
+    return K / decompressionChunk * (decompressionChunk / 2) + std::min(K % decompressionChunk, decompressionChunk / 2);
+}
+
+// The reference dot product keeps several independent sums, so the additions are not serialized by their latency
+float dotProduct(const float* a, const float* b, size_t size) {
+    float sums[4] = {0.f, 0.f, 0.f, 0.f};
+    size_t k = 0;
+    for (; k + 4 <= size; k += 4) {
+        for (size_t i = 0; i < 4; i++)
+            sums[i] += a[k + i] * b[k + i];
+    }
+    for (; k < size; k++)
+        sums[0] += a[k] * b[k];
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_f32 : public jit_uni_fc_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_f32)
+
+    explicit jit_uni_fc_decompression_kernel_f32(jit_fc_decompression_config_params jcp)
+        : jit_uni_fc_decompression_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        lea(reg_src_stride3, ptr[reg_src_stride + reg_src_stride * 2]);
+
+        if (jcp_.with_zero_point)
+            uni_vbroadcastss(vmm_zero_point, ptr[reg_params + GET_OFF(zero_point)]);
+
+        // two accumulators per row, so the consecutive FMAs of a row do not wait for each other
+        for (size_t i = 0; i < 2 * jcp_.rows; i++)
+            uni_vpxor(Vmm(i), Vmm(i), Vmm(i));
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            for (size_t k = 0; k < decompressionChunk / 2; k += vlen) {
+                // the values k and k + 16 of the chunk
+                load_weights(k);
+                for (size_t r = 0; r < jcp_.rows; r++) {
+                    multiply_add(acc(r, 0), vmm_weights0, src_ptr(r, k));
+                    multiply_add(acc(r, 1), vmm_weights1, src_ptr(r, k + decompressionChunk / 2));
+                }
+            }
+
+            add(reg_weights, jcp_.fp16_weights ? decompressionChunk * sizeof(uint16_t) :
+                             jcp_.packed_int4 ? decompressionChunk / 2 : decompressionChunk);
+            add(reg_src, decompressionChunk * sizeof(float));
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        for (size_t r = 0; r < jcp_.rows; r++)
+            reduce_store(r);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_src_stride = r11;
+    Xbyak::Reg64 reg_src_stride3 = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // Vmm(0) ... Vmm(7) are the accumulators
+    Vmm vmm_weights0 = Vmm(8);
+    Vmm vmm_weights1 = Vmm(9);
+    Vmm vmm_zero_point = Vmm(10);
+    Vmm vmm_src = Vmm(11);
+    Xbyak::Xmm xmm_aux0 = Xbyak::Xmm(12);
+    Xbyak::Xmm xmm_aux1 = Xbyak::Xmm(13);
+
+    inline Vmm acc(size_t row, size_t idx) {
+        return Vmm(2 * row + idx);
+    }
+
+    inline Xbyak::Address src_ptr(size_t row, size_t k) {
+        const size_t offset = k * sizeof(float);
+        switch (row) {
+            case 0: return ptr[reg_src + offset];
+            case 1: return ptr[reg_src + reg_src_stride + offset];
+            case 2: return ptr[reg_src + reg_src_stride * 2 + offset];
+            default: return ptr[reg_src + reg_src_stride3 + offset];
+        }
+    }
+
+    inline void shift_right(const Vmm& vmm, int bits) {
+        if (isa == cpu::x64::sse41) {
+            if (jcp_.signed_weights)
+                psrad(vmm, bits);
+            else
+                psrld(vmm, bits);
+        } else {
+            if (jcp_.signed_weights)
+                vpsrad(vmm, vmm, bits);
+            else
+                vpsrld(vmm, vmm, bits);
+        }
+    }
+
+    inline void load_weights(size_t k) {
+        if (jcp_.fp16_weights) {
+            vcvtph2ps(vmm_weights0, ptr[reg_weights + k * sizeof(uint16_t)]);
+            vcvtph2ps(vmm_weights1, ptr[reg_weights + (k + decompressionChunk / 2) * sizeof(uint16_t)]);
+            return;
+        }
+
+        if (jcp_.packed_int4) {
+            // the low and the high halves of the same bytes, the sign of a half is restored by the arithmetic shift
+            uni_vpmovzxbd(vmm_weights0, ptr[reg_weights + k]);
+            uni_vmovups(vmm_weights1, vmm_weights0);
+            uni_vpslld(vmm_weights0, vmm_weights0, 28);
+            shift_right(vmm_weights0, 28);
+            uni_vpslld(vmm_weights1, vmm_weights1, 24);
+            shift_right(vmm_weights1, 28);
+        } else if (jcp_.signed_weights) {
+            uni_vpmovsxbd(vmm_weights0, ptr[reg_weights + k]);
+            uni_vpmovsxbd(vmm_weights1, ptr[reg_weights + k + decompressionChunk / 2]);
+        } else {
+            uni_vpmovzxbd(vmm_weights0, ptr[reg_weights + k]);
+            uni_vpmovzxbd(vmm_weights1, ptr[reg_weights + k + decompressionChunk / 2]);
+        }
+        uni_vcvtdq2ps(vmm_weights0, vmm_weights0);
+        uni_vcvtdq2ps(vmm_weights1, vmm_weights1);
+        if (jcp_.with_zero_point) {
+            uni_vsubps(vmm_weights0, vmm_weights0, vmm_zero_point);
+            uni_vsubps(vmm_weights1, vmm_weights1, vmm_zero_point);
+        }
+    }
+
+    inline void multiply_add(const Vmm& vmm_acc, const Vmm& vmm_weights, const Xbyak::Address& src) {
+        if (isa == cpu::x64::sse41) {
+            // the weights are used by the next rows, and the source may be unaligned
+            movups(vmm_src, src);
+            mulps(vmm_src, vmm_weights);
+            addps(vmm_acc, vmm_src);
+        } else {
+            vfmadd231ps(vmm_acc, vmm_weights, src);
+        }
+    }
+
+    // dst[row] += scale * sum of the lanes of the accumulators
+    inline void reduce_store(size_t row) {
+        uni_vaddps(acc(row, 0), acc(row, 0), acc(row, 1));
+        if (isa == cpu::x64::sse41) {
+            movups(xmm_aux0, Xbyak::Xmm(acc(row, 0).getIdx()));
+        } else if (isa == cpu::x64::avx2) {
+            Xbyak::Ymm ymm_acc = Xbyak::Ymm(acc(row, 0).getIdx());
+            vextractf128(xmm_aux0, ymm_acc, 0);
+            vextractf128(xmm_aux1, ymm_acc, 1);
+            addps(xmm_aux0, xmm_aux1);
+        } else {
+            Xbyak::Zmm zmm_acc = Xbyak::Zmm(acc(row, 0).getIdx());
+            vextractf32x4(xmm_aux0, zmm_acc, 0);
+            vextractf32x4(xmm_aux1, zmm_acc, 1);
+            addps(xmm_aux0, xmm_aux1);
+            vextractf32x4(xmm_aux1, zmm_acc, 2);
+            addps(xmm_aux0, xmm_aux1);
+            vextractf32x4(xmm_aux1, zmm_acc, 3);
+            addps(xmm_aux0, xmm_aux1);
+        }
+        movshdup(xmm_aux1, xmm_aux0);
+        addps(xmm_aux0, xmm_aux1);
+        movhlps(xmm_aux1, xmm_aux0);
+        addss(xmm_aux0, xmm_aux1);
+        mulss(xmm_aux0, ptr[reg_params + GET_OFF(scale)]);
+        addss(xmm_aux0, ptr[reg_dst + row * sizeof(float)]);
+        movss(ptr[reg_dst + row * sizeof(float)], xmm_aux0);
+    }
+};
+
+bool isZeroBlock(const float* block, size_t blockSize) {
+    for (size_t i = 0; i < blockSize; i++) {
+        if (block[i] != 0.f)
+            return false;
+    }
+    return true;
+}
+
+size_t countNonZeroBlocks(const float* row, size_t K, size_t blockSize) {
+    size_t count = 0;
+    for (size_t k = 0; k < K; k += blockSize)
+        count += isZeroBlock(row + k, blockSize) ? 0 : 1;
+    return count;
+}
+
+template <size_t blockSize>
+void sparseInnerProduct(const float* src, const uint8_t* weights, const float* bias, void* dst, bool bf16Dst,
+                        size_t M, size_t K, size_t O, std::vector<float>& accumulatorsBuffer) {
+    const auto offsets = reinterpret_cast<const uint32_t*>(weights);
+    const auto columns = offsets + O + 1;
+    const auto values = reinterpret_cast<const float*>(columns + offsets[O]);
+
+    const int threadsNum = parallel_get_max_threads();
+    accumulatorsBuffer.resize(threadsNum * M * blockSize);
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(O, nthr, ithr, start, end);
+        // the accumulators are reduced once per output channel, so the blocks are processed by the vertical operations
+        float* accumulators = accumulatorsBuffer.data() + ithr * M * blockSize;
+        for (size_t o = start; o < end; o++) {
+            std::fill(accumulators, accumulators + M * blockSize, 0.f);
+            for (uint32_t b = offsets[o]; b < offsets[o + 1]; b++) {
+                const float* block = values + b * blockSize;
+                const float* srcBlock = src + columns[b];
+                for (size_t m = 0; m < M; m++) {
+                    for (size_t i = 0; i < blockSize; i++)
+                        accumulators[m * blockSize + i] += block[i] * srcBlock[m * K + i];
+                }
+            }
+            for (size_t m = 0; m < M; m++) {
+                float result = bias ? bias[o] : 0.f;
+                for (size_t i = 0; i < blockSize; i++)
+                    result += accumulators[m * blockSize + i];
+                if (bf16Dst)
+                    static_cast<bfloat16_t*>(dst)[m * O + o] = result;
+                else
+                    static_cast<float*>(dst)[m * O + o] = result;
+            }
+        }
+    });
+}
+}  // namespace
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -120,10 +409,210 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withWeightsDecompression() && !withSparseWeights()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the dequantized or sparse weights are accumulated in FP32, BF16 data is converted on reading and writing
+    const auto srcPrecision = getOriginalInputPrecisionAtPort(DATA_ID) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    const auto dstPrecision = getOriginalOutputPrecisionAtPort(0) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    std::vector<DataConfigurator> inDataConfigurators = {{TensorDescCreatorTypes::ncsp, srcPrecision},
+                                                         {TensorDescCreatorTypes::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+    if (withBiases)
+        inDataConfigurators.push_back({TensorDescCreatorTypes::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inDataConfigurators, {{TensorDescCreatorTypes::ncsp, dstPrecision}}, impl_desc_type::ref_any);
+}
+
+void MKLDNNFullyConnectedNode::setWeightsDecompression(const MKLDNNMemoryCPtr& weights, std::vector<float> scales,
+                                                       std::vector<float> zeroPoints, size_t groups) {
+    weightsDecompression = true;
+    compressedWeights = weights;
+    decompressionScales = std::move(scales);
+    decompressionZeroPoints = std::move(zeroPoints);
+    decompressionGroups = groups;
+}
+
+void MKLDNNFullyConnectedNode::setSparseWeights(const MKLDNNMemoryCPtr& weights, size_t fusableOperations) {
+    const auto dims = weights->GetDims();
+    if (dims.size() != 2 || weights->GetDataType() != memory::data_type::f32)
+        return;
+    const size_t O = dims[0];
+    const size_t K = dims[1];
+    if (O * K >= std::numeric_limits<uint32_t>::max())
+        return;
+    const auto data = static_cast<const float*>(weights->GetPtr());
+
+    // Every non zero block costs the vector operations on its values and the reading of its column.
+    // The sparse computations do not support the post operations, so the operations which the inner product
+    // primitive would fuse are executed by own nodes
+    const float denseCost = static_cast<float>(O * K) / vectorLength;
+    const float unfusedCost = fusableOperations * unfusedOperationCost * div_up(O, vectorLength);
+    float bestCost = maxSparseCostRatio * denseCost - unfusedCost;
+    size_t bestBlockSize = 0;
+    for (const auto blockSize : sparseBlockSizes) {
+        if (K % blockSize != 0)
+            continue;
+        const size_t nonZeroBlocks = parallel_sum(O, size_t{0}, [&](size_t o) {
+            return countNonZeroBlocks(data + o * K, K, blockSize);
+        });
+        const float cost = nonZeroBlocks * (div_up(blockSize, vectorLength) + blockAddressingCost);
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestBlockSize = blockSize;
+        }
+    }
+
+    if (bestBlockSize != 0) {
+        denseWeights = weights;
+        sparseBlockSize = bestBlockSize;
+    }
+}
+
+void MKLDNNFullyConnectedNode::packSparseWeights() {
+    const auto dims = denseWeights->GetDims();
+    const size_t O = dims[0];
+    const size_t K = dims[1];
+    const auto data = static_cast<const float*>(denseWeights->GetPtr());
+    const size_t blockSize = sparseBlockSize;
+
+    auto create = [&] () {
+        std::vector<uint32_t> rowsOffsets(O + 1, 0);
+        parallel_for(O, [&](size_t o) {
+            rowsOffsets[o + 1] = static_cast<uint32_t>(countNonZeroBlocks(data + o * K, K, blockSize));
+        });
+        std::partial_sum(rowsOffsets.begin(), rowsOffsets.end(), rowsOffsets.begin());
+        const size_t blocksNum = rowsOffsets[O];
+
+        const size_t size = (O + 1 + blocksNum) * sizeof(uint32_t) + blocksNum * blockSize * sizeof(float);
+        MKLDNNMemoryPtr ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+        ptr->Create(MKLDNNMemoryDesc(MKLDNNDims({static_cast<ptrdiff_t>(size)}), memory::data_type::u8, memory::format_tag::x));
+        auto offsets = static_cast<uint32_t*>(ptr->GetData());
+        auto columns = offsets + O + 1;
+        auto values = reinterpret_cast<float*>(columns + blocksNum);
+        std::copy(rowsOffsets.begin(), rowsOffsets.end(), offsets);
+        parallel_for(O, [&](size_t o) {
+            const float* row = data + o * K;
+            uint32_t b = offsets[o];
+            for (size_t k = 0; k < K; k += blockSize) {
+                if (isZeroBlock(row + k, blockSize))
+                    continue;
+                columns[b] = static_cast<uint32_t>(k);
+                std::memcpy(values + b * blockSize, row + k, blockSize * sizeof(float));
+                b++;
+            }
+        });
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const uint64_t dataHash = weightCache->GetHashFunc().hash(reinterpret_cast<const uint8_t*>(data), O * K * sizeof(float));
+        const std::string key = getName() + "_sparse_" + std::to_string(blockSize) + "_" + std::to_string(O * K) + "_" +
+                                std::to_string(dataHash);
+        sparseWeights = *weightCache->findOrCreate(key, create);
+    } else {
+        sparseWeights = create();
+    }
+    denseWeights.reset();
+}
+
+void MKLDNNFullyConnectedNode::packCompressedWeights() {
+    const size_t O = getChildEdgeAt(0)->getDims().ToSizeVector().back();
+    const size_t K = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector().back();
+    const auto weightsData = static_cast<const uint8_t*>(compressedWeights->GetPtr());
+    const size_t weightsSize = O * K;
+    signedWeights = compressedWeights->GetDataType() == memory::data_type::s8;
+
+    fp16Weights = compressedWeights->GetDataType() == memory::data_type::f16;
+
+    // 4-bit weights are converted to 8-bit by the transformations, so the range of the values is checked instead
+    packedInt4 = !fp16Weights;
+    for (size_t i = 0; i < weightsSize && packedInt4; i++) {
+        packedInt4 = signedWeights ? static_cast<int8_t>(weightsData[i]) >= -8 && static_cast<int8_t>(weightsData[i]) <= 7
+                                   : weightsData[i] <= 15;
+    }
+
+    // FP16 and 8-bit weights are read as they are, so the memory of the constant node is used without a copy.
+    // The constant node memory is placed in the weights cache and is shared by the streams as well
+    if (!packedInt4) {
+        packedWeights = compressedWeights;
+        compressedWeights.reset();
+        return;
+    }
+
+    // The constant node and its edge keep the 8-bit weights, so the packed copy costs a half of their size on top.
+    // It is paid only once for all the streams, since the packed weights are placed in the weights cache too
+    const size_t rowSize = int4RowSize(K);
+    auto create = [&] () {
+        MKLDNNMemoryPtr ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+        ptr->Create(MKLDNNMemoryDesc(MKLDNNDims({static_cast<ptrdiff_t>(O * rowSize)}), memory::data_type::u8, memory::format_tag::x));
+        auto packed = static_cast<uint8_t*>(ptr->GetData());
+        parallel_for(O, [&](size_t o) {
+            const uint8_t* src = weightsData + o * K;
+            uint8_t* dst = packed + o * rowSize;
+            std::fill(dst, dst + rowSize, 0);
+            for (size_t k = 0; k < K; k++)
+                dst[int4ByteOffset(k)] |= static_cast<uint8_t>((src[k] & 0x0F) << int4Shift(k));
+        });
+        return ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const uint64_t dataHash = weightCache->GetHashFunc().hash(weightsData, weightsSize);
+        const std::string key = getName() + "_compressed_" + std::to_string(weightsSize) + "_" + std::to_string(dataHash);
+        packedWeights = *weightCache->findOrCreate(key, create);
+    } else {
+        packedWeights = create();
+    }
+    compressedWeights.reset();
+}
+
+void MKLDNNFullyConnectedNode::createDecompressionKernels() {
+    // vcvtph2ps (F16C) is not available on sse41 only machines
+    if (fp16Weights && !mayiuse(cpu::x64::avx2))
+        return;
+
+    jit_fc_decompression_config_params jcp;
+    jcp.fp16_weights = fp16Weights;
+    jcp.packed_int4 = packedInt4;
+    jcp.signed_weights = signedWeights;
+    jcp.with_zero_point = !decompressionZeroPoints.empty();
+    for (size_t rows = 1; rows <= maxDecompressionRows; rows++) {
+        jcp.rows = rows;
+        std::shared_ptr<jit_uni_fc_decompression_kernel> kernel;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<cpu::x64::avx2>(jcp));
+        } else if (mayiuse(cpu::x64::sse41)) {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<cpu::x64::sse41>(jcp));
+        } else {
+            return;
+        }
+        kernel->create_ker();
+        decompressionKernels.push_back(kernel);
+    }
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
     if (prim)
         return;
 
+    if (withWeightsDecompression()) {
+        packCompressedWeights();
+        createDecompressionKernels();
+        return;
+    }
+
+    if (withSparseWeights()) {
+        packSparseWeights();
+        return;
+    }
+
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
@@ -140,7 +629,143 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
 }
 
+const float* MKLDNNFullyConnectedNode::getFP32Src(size_t size) {
+    const auto& srcMemory = getParentEdgeAt(DATA_ID)->getMemory();
+    if (srcMemory.GetDataType() != memory::data_type::bf16)
+        return reinterpret_cast<const float*>(srcMemory.GetPtr());
+
+    srcBuffer.resize(size);
+    const auto bf16Src = reinterpret_cast<const bfloat16_t*>(srcMemory.GetPtr());
+    parallel_for(size, [&](size_t i) {
+        srcBuffer[i] = bf16Src[i];
+    });
+    return srcBuffer.data();
+}
+
+void MKLDNNFullyConnectedNode::executeWithWeightsDecompression() {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto srcDims = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector();
+    const size_t K = srcDims.back();
+    // only the rows of the current dynamic batch are computed
+    const size_t M = batchToProcess() * std::accumulate(srcDims.begin() + 1, srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t O = getChildEdgeAt(0)->getDims().ToSizeVector().back();
+    const size_t G = decompressionGroups;
+    const size_t groupSize = K / G;
+    const size_t rowSize = packedInt4 ? int4RowSize(K) : fp16Weights ? K * sizeof(uint16_t) : K;
+    // signed values are restored from their two's complement bits without branches
+    const int32_t signBit = packedInt4 ? (signedWeights ? 0x08 : 0) : (signedWeights ? 0x80 : 0);
+    // the kernel computes the whole chunks of every group if the groups start at the chunks, the rest is computed by the
+    // reference code from the dequantized values
+    const size_t jitSize = !decompressionKernels.empty() && (G == 1 || groupSize % decompressionChunk == 0) ?
+                           groupSize / decompressionChunk * decompressionChunk : 0;
+
+    const float* src = getFP32Src(M * K);
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    const auto weights = static_cast<const uint8_t*>(packedWeights->GetPtr());
+    const bool bf16Dst = dstMemory.GetDataType() == memory::data_type::bf16;
+    auto dst = dstMemory.GetPtr();
+
+    const int threadsNum = parallel_get_max_threads();
+    rowsBuffer.resize(threadsNum * K);
+
+    // Every weights row is dequantized once and multiplied by all the rows of the input, so the compressed weights are
+    // read from memory only once for a small batch. The kernel dequantizes them in registers for up to
+    // maxDecompressionRows rows of the input at once
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(O, nthr, ithr, start, end);
+        float* row = rowsBuffer.data() + ithr * K;
+        for (size_t o = start; o < end; o++) {
+            const uint8_t* packedRow = weights + o * rowSize;
+            if (fp16Weights) {
+                const auto fp16Row = reinterpret_cast<const ngraph::float16*>(packedRow);
+                for (size_t k = jitSize; k < K; k++)
+                    row[k] = static_cast<float>(fp16Row[k]);
+            } else {
+                for (size_t g = 0; g < G; g++) {
+                    const float scale = decompressionScales[o * G + g];
+                    const float zeroPoint = decompressionZeroPoints.empty() ? 0.f : decompressionZeroPoints[o * G + g];
+                    for (size_t k = g * groupSize + jitSize; k < (g + 1) * groupSize; k++) {
+                        const int32_t bits = packedInt4 ? (packedRow[int4ByteOffset(k)] >> int4Shift(k)) & 0x0F : packedRow[k];
+                        row[k] = (static_cast<float>((bits ^ signBit) - signBit) - zeroPoint) * scale;
+                    }
+                }
+            }
+
+            for (size_t m = 0; m < M; m += maxDecompressionRows) {
+                const size_t rows = std::min(maxDecompressionRows, M - m);
+                float results[maxDecompressionRows] = {};
+                if (jitSize != 0) {
+                    auto& kernel = *decompressionKernels[rows - 1];
+                    for (size_t g = 0; g < G; g++) {
+                        auto arg = jit_fc_decompression_call_args();
+                        arg.src = src + m * K + g * groupSize;
+                        arg.weights = packedRow + (fp16Weights ? g * groupSize * sizeof(uint16_t) :
+                                                   packedInt4 ? int4ByteOffset(g * groupSize) : g * groupSize);
+                        arg.dst = results;
+                        arg.src_stride = K * sizeof(float);
+                        arg.work_amount = jitSize / decompressionChunk;
+                        arg.scale = fp16Weights ? 1.f : decompressionScales[o * G + g];
+                        arg.zero_point = decompressionZeroPoints.empty() ? 0.f : decompressionZeroPoints[o * G + g];
+                        kernel(&arg);
+                    }
+                }
+
+                for (size_t r = 0; r < rows; r++) {
+                    const float* srcRow = src + (m + r) * K;
+                    float result = results[r];
+                    if (jitSize != groupSize) {
+                        for (size_t g = 0; g < G; g++) {
+                            const size_t k = g * groupSize + jitSize;
+                            result += dotProduct(srcRow + k, row + k, groupSize - jitSize);
+                        }
+                    }
+                    if (bias)
+                        result += bias[o];
+                    if (bf16Dst)
+                        static_cast<bfloat16_t*>(dst)[(m + r) * O + o] = result;
+                    else
+                        static_cast<float*>(dst)[(m + r) * O + o] = result;
+                }
+            }
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeWithSparseWeights() {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto srcDims = getParentEdgeAt(DATA_ID)->getDims().ToSizeVector();
+    const size_t K = srcDims.back();
+    // only the rows of the current dynamic batch are computed
+    const size_t M = batchToProcess() * std::accumulate(srcDims.begin() + 1, srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t O = getChildEdgeAt(0)->getDims().ToSizeVector().back();
+
+    const float* src = getFP32Src(M * K);
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr()) : nullptr;
+    const auto weights = static_cast<const uint8_t*>(sparseWeights->GetPtr());
+    const bool bf16Dst = dstMemory.GetDataType() == memory::data_type::bf16;
+    auto dst = dstMemory.GetPtr();
+
+    switch (sparseBlockSize) {
+        case 16: sparseInnerProduct<16>(src, weights, bias, dst, bf16Dst, M, K, O, rowsBuffer); break;
+        case 8: sparseInnerProduct<8>(src, weights, bias, dst, bf16Dst, M, K, O, rowsBuffer); break;
+        case 4: sparseInnerProduct<4>(src, weights, bias, dst, bf16Dst, M, K, O, rowsBuffer); break;
+        case 1: sparseInnerProduct<1>(src, weights, bias, dst, bf16Dst, M, K, O, rowsBuffer); break;
+        default: IE_THROW() << errorPrefix << " has unsupported sparse weights block size " << sparseBlockSize;
+    }
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (packedWeights) {
+        executeWithWeightsDecompression();
+        return;
+    }
+
+    if (sparseWeights) {
+        executeWithSparseWeights();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -164,7 +789,7 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
-    return canFuseSimpleOperation(node);
+    return !withWeightsDecompression() && !withSparseWeights() && canFuseSimpleOperation(node);
 }
 
 void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) {
@@ -238,6 +863,10 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    // the compressed and sparse weights are handled by the node itself instead of an inner product primitive
+    if (withWeightsDecompression() || withSparseWeights())
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
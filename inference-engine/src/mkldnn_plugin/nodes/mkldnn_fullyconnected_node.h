@@ -12,12 +12,51 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_fc_decompression_config_params {
+    bool fp16_weights;
+    bool packed_int4;
+    bool signed_weights;
+    bool with_zero_point;
+    size_t rows;
+};
+
+struct jit_fc_decompression_call_args {
+    const float *src;
+    const uint8_t *weights;
+    float *dst;
+    size_t src_stride;
+    size_t work_amount;     // number of the weights chunks
+    float scale;
+    float zero_point;
+};
+
+/**
+ * Adds scale * sum((w - zero_point) * src) to dst for every of the rows of src. The weights are dequantized in registers,
+ * so they are read from memory in the compressed form only
+ */
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_call_args *);
+
+    void operator()(const jit_fc_decompression_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_decompression_kernel(jit_fc_decompression_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_decompression_config_params jcp_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +82,26 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * Makes the node compute from the compressed u8/i8 [O, K] weights dequantized as (w - zeroPoint) * scale,
+     * where scales and zero points are given per output channel and group of K / groups input channels.
+     * FP16 [O, K] weights are only converted to FP32, so no scales are given for them
+     */
+    void setWeightsDecompression(const MKLDNNMemoryCPtr& weights, std::vector<float> scales, std::vector<float> zeroPoints, size_t groups);
+    bool withWeightsDecompression() const {
+        return weightsDecompression;
+    }
+
+    /**
+     * Makes the node skip the zero blocks of the sparse FP32 [O, K] weights. The weights are kept dense if the estimated
+     * cost of the sparse computations does not pay off, including the cost of the given number of the following
+     * operations which can not be fused into the node with the sparse weights
+     */
+    void setSparseWeights(const MKLDNNMemoryCPtr& weights, size_t fusableOperations);
+    bool withSparseWeights() const {
+        return sparseBlockSize != 0;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -55,6 +114,35 @@ private:
 
     bool withBiases = false;
 
+    void packCompressedWeights();
+    void createDecompressionKernels();
+    void executeWithWeightsDecompression();
+    void packSparseWeights();
+    void executeWithSparseWeights();
+    const float* getFP32Src(size_t size);
+
+    bool weightsDecompression = false;
+    MKLDNNMemoryCPtr compressedWeights;
+    // the rows of the weights are packed by two values per byte if they fit in 4 bits, FP16 and 8-bit weights are used as is.
+    // Every chunk of 32 values is packed into 16 bytes holding the first 16 values in the low halves and the rest in the high ones
+    MKLDNNMemoryCPtr packedWeights;
+    bool packedInt4 = false;
+    bool signedWeights = false;
+    bool fp16Weights = false;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    size_t decompressionGroups = 1;
+    // the kernels computing 1, 2, ... rows of the input at once, none if the weights are dequantized by the reference code
+    std::vector<std::shared_ptr<jit_uni_fc_decompression_kernel>> decompressionKernels;
+
+    MKLDNNMemoryCPtr denseWeights;
+    // the non zero blocks of sparseBlockSize values along K: rows offsets [O + 1], blocks columns and blocks values
+    MKLDNNMemoryPtr sparseWeights;
+    size_t sparseBlockSize = 0;
+
+    std::vector<float> rowsBuffer;
+    std::vector<float> srcBuffer;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
@@ -65,11 +65,6 @@ void MKLDNNMathNode::execute(mkldnn::stream strm) {
     float* dst_data = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
     switch (getAlgorithm()) {
-        case MKLDNNPlugin::MathAbs:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = (std::abs)(src_data[i]);
-            });
-            break;
         case MKLDNNPlugin::MathAcos:
             parallel_for(dataSize, [&](size_t i) {
                 dst_data[i] = acosf(src_data[i]);
@@ -100,26 +95,11 @@ void MKLDNNMathNode::execute(mkldnn::stream strm) {
                 dst_data[i] = atanhf(src_data[i]);
             });
             break;
-        case MKLDNNPlugin::MathCeiling:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = ceilf(src_data[i]);
-            });
-            break;
-        case MKLDNNPlugin::MathCos:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = cosf(src_data[i]);
-            });
-            break;
         case MKLDNNPlugin::MathCosh:
             parallel_for(dataSize, [&](size_t i) {
                 dst_data[i] = coshf(src_data[i]);
             });
             break;
-        case MKLDNNPlugin::MathFloor:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = floorf(src_data[i]);
-            });
-            break;
         case MKLDNNPlugin::MathHardSigmoid:
             alpha = (alpha == 0.0f) ? 0.2f : alpha;
             beta = (beta == 0.0f) ? 0.5f : beta;
@@ -127,16 +107,6 @@ void MKLDNNMathNode::execute(mkldnn::stream strm) {
                 dst_data[i] = (std::max)(0.f, (std::min)(1.f, alpha * src_data[i] + beta));
             });
             break;
-        case MKLDNNPlugin::MathLog:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = logf(src_data[i]);
-            });
-            break;
-        case MKLDNNPlugin::MathNegative:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = -src_data[i];
-            });
-            break;
         case MKLDNNPlugin::MathReciprocal:
             parallel_for(dataSize, [&](size_t i) {
                 dst_data[i] = 1.0f / src_data[i];
@@ -150,37 +120,11 @@ void MKLDNNMathNode::execute(mkldnn::stream strm) {
                 dst_data[i] = (x > 0.0f) ? (gamma * x) : (gamma * alpha * (exp(x) - 1.0f));
             });
             break;
-        case MKLDNNPlugin::MathSign:
-            parallel_for(dataSize, [&](size_t i) {
-                if (src_data[i] > 0.0f)
-                    dst_data[i] = 1.0f;
-                else if (src_data[i] < 0.0f)
-                    dst_data[i] = -1.0f;
-                else
-                    dst_data[i] = 0.0f;
-            });
-            break;
-        case MKLDNNPlugin::MathSin:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = sinf(src_data[i]);
-            });
-            break;
         case MKLDNNPlugin::MathSinh:
             parallel_for(dataSize, [&](size_t i) {
                 dst_data[i] = sinhf(src_data[i]);
             });
             break;
-        case MKLDNNPlugin::MathSoftPlus:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = logf(expf(src_data[i]) + 1);
-            });
-            break;
-        case MKLDNNPlugin::MathSoftsign:
-            parallel_for(dataSize, [&](size_t i) {
-                float x = src_data[i];
-                dst_data[i] = x / (1.f + (std::abs)(x));
-            });
-            break;
         case MKLDNNPlugin::MathTan:
             parallel_for(dataSize, [&](size_t i) {
                 dst_data[i] = tanf(src_data[i]);
@@ -196,9 +140,6 @@ bool MKLDNNMathNode::created() const {
 }
 
 std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_ptr<ngraph::Node>&, MKLDNNMathNode& node)>> MKLDNNMathNode::initializers {
-        {ngraph::op::v0::Abs::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathAbs;
-        }},
         {ngraph::op::v0::Acos::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
             node.algorithm = MKLDNNPlugin::MathAcos;
         }},
@@ -214,46 +155,22 @@ std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_pt
         {ngraph::op::v0::Atan::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
             node.algorithm = MKLDNNPlugin::MathAtan;
         }},
-        {ngraph::op::v0::Ceiling::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathCeiling;
-        }},
-        {ngraph::op::v0::Cos::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathCos;
-        }},
         {ngraph::op::v0::Cosh::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
             node.algorithm = MKLDNNPlugin::MathCosh;
         }},
-        {ngraph::op::v0::Floor::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathFloor;
-        }},
         {ngraph::op::v0::HardSigmoid::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
             node.algorithm = MKLDNNPlugin::MathHardSigmoid;
             node.alpha = ngraph::as_type_ptr<ngraph::op::v0::Constant>(op->get_input_node_shared_ptr(1))->cast_vector<float>()[0];
             node.beta = ngraph::as_type_ptr<ngraph::op::v0::Constant>(op->get_input_node_shared_ptr(2))->cast_vector<float>()[0];
         }},
-        {ngraph::op::v0::Log::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathLog;
-        }},
-        {ngraph::op::v0::Negative::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathNegative;
-        }},
         {ngraph::op::v0::Selu::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
             node.algorithm = MKLDNNPlugin::MathSelu;
             node.alpha = ngraph::as_type_ptr<ngraph::op::v0::Constant>(op->get_input_node_shared_ptr(1))->cast_vector<float>()[0];
             node.gamma = ngraph::as_type_ptr<ngraph::op::v0::Constant>(op->get_input_node_shared_ptr(2))->cast_vector<float>()[0];
         }},
-        {ngraph::op::v0::Sign::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathSign;
-        }},
-        {ngraph::op::v0::Sin::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathSin;
-        }},
         {ngraph::op::v0::Sinh::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
             node.algorithm = MKLDNNPlugin::MathSinh;
         }},
-        {ngraph::op::v4::SoftPlus::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
-            node.algorithm = MKLDNNPlugin::MathSoftPlus;
-        }},
         {ngraph::op::v0::Tan::type_info, [](const std::shared_ptr<ngraph::Node>& op, MKLDNNMathNode& node) {
             node.algorithm = MKLDNNPlugin::MathTan;
         }},
@@ -0,0 +1,257 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "mkldnn_mha_node.h"
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include "ngraph_transformations/op/mha.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// the scores of the query block are kept in the L2 cache together with the packed keys and values
+constexpr size_t maxQueryBlock = 32;
+constexpr size_t scoresBlockBytes = 128 * 1024;
+
+std::vector<size_t> getPlainStrides(const SizeVector& dims) {
+    std::vector<size_t> strides(dims.size(), 1);
+    for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--)
+        strides[i] = strides[i + 1] * dims[i + 1];
+    return strides;
+}
+
+}  // namespace
+
+bool MKLDNNMHANode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto mha = std::dynamic_pointer_cast<const MKLDNNPlugin::MHANode>(op);
+        if (!mha) {
+            errorMessage = "Only MHA operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNMHANode::MKLDNNMHANode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "MHA layer with name '" + op->get_friendly_name() + "' ";
+    const auto mha = std::dynamic_pointer_cast<const MKLDNNPlugin::MHANode>(op);
+    withMask = mha->has_mask();
+    if (getOriginalInputsNumber() != (withMask ? 4 : 3) || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << "has incorrect number of input/output edges!";
+
+    scale = mha->get_scale();
+    orders = {mha->get_q_order(), mha->get_k_order(), mha->get_v_order()};
+    outOrder = mha->get_out_order();
+
+    // strides of the inputs transposed to [B, H, S, D]
+    std::vector<Strides> strides(3, Strides(4));
+    std::vector<SizeVector> dims(3, SizeVector(4));
+    for (size_t port = Q; port <= V; port++) {
+        const auto& shape = op->get_input_shape(port);
+        const auto plainStrides = getPlainStrides(shape);
+        for (size_t i = 0; i < 4; i++) {
+            dims[port][i] = shape[orders[port][i]];
+            strides[port][i] = plainStrides[orders[port][i]];
+        }
+    }
+    qStrides = strides[Q];
+    kStrides = strides[K];
+    vStrides = strides[V];
+    batch = dims[Q][0];
+    heads = dims[Q][1];
+    qLength = dims[Q][2];
+    headSize = dims[Q][3];
+    kLength = dims[K][2];
+    vHeadSize = dims[V][3];
+
+    const auto plainOutStrides = getPlainStrides(op->get_output_shape(0));
+    outStrides.resize(4);
+    for (size_t i = 0; i < 4; i++)
+        outStrides[outOrder[i]] = plainOutStrides[i];
+
+    if (withMask) {
+        // the mask is aligned to [B, H, Sq, Sk] by the numpy broadcast rules, broadcasted dimensions have zero strides
+        const auto& maskShape = op->get_input_shape(MASK);
+        const auto maskPlainStrides = getPlainStrides(maskShape);
+        const SizeVector scoresDims = {batch, heads, qLength, kLength};
+        const size_t offset = 4 - maskShape.size();
+        maskStrides.assign(4, 0);
+        for (size_t i = offset; i < 4; i++) {
+            const auto dim = maskShape[i - offset];
+            if (dim != 1 && dim != scoresDims[i])
+                IE_THROW() << errorPrefix << "has the mask which can not be broadcasted to the scores";
+            maskStrides[i] = dim == 1 ? 0 : maskPlainStrides[i - offset];
+        }
+    }
+}
+
+void MKLDNNMHANode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    dataPrecision = getOriginalInputPrecisionAtPort(Q);
+    if (dataPrecision != Precision::BF16)
+        dataPrecision = Precision::FP32;
+
+    std::vector<DataConfigurator> inDataConf(3, {TensorDescCreatorTypes::ncsp, dataPrecision});
+    if (withMask)
+        inDataConf.emplace_back(TensorDescCreatorTypes::ncsp, Precision::FP32);
+
+    addSupportedPrimDesc(inDataConf,
+                         {{TensorDescCreatorTypes::ncsp, dataPrecision}},
+                         impl_desc_type::ref_any);
+}
+
+void MKLDNNMHANode::createPrimitive() {
+    const size_t nthr = parallel_get_max_threads();
+    const size_t headsNum = batch * heads;
+
+    qBlock = std::min(maxQueryBlock, qLength);
+    while (qBlock > 1 && qBlock * kLength * sizeof(float) > scoresBlockBytes)
+        qBlock /= 2;
+    // smaller blocks of queries keep all the threads busy when there are few heads
+    while (qBlock > 4 && headsNum * div_up(qLength, qBlock) < nthr)
+        qBlock /= 2;
+
+    // transposed keys, values, scaled queries, scores, outputs and softmax denominators of the query block
+    threadBufferSize = headSize * kLength + kLength * vHeadSize + qBlock * (headSize + kLength + vHeadSize + 1);
+    buffers.resize(nthr * threadBufferSize);
+}
+
+void MKLDNNMHANode::execute(mkldnn::stream strm) {
+    if (dataPrecision == Precision::BF16)
+        mha<bfloat16_t>();
+    else
+        mha<float>();
+}
+
+template <typename T>
+void MKLDNNMHANode::mha() {
+    const auto *q = reinterpret_cast<const T *>(getParentEdgeAt(Q)->getMemoryPtr()->GetPtr());
+    const auto *k = reinterpret_cast<const T *>(getParentEdgeAt(K)->getMemoryPtr()->GetPtr());
+    const auto *v = reinterpret_cast<const T *>(getParentEdgeAt(V)->getMemoryPtr()->GetPtr());
+    const auto *mask = withMask ? reinterpret_cast<const float *>(getParentEdgeAt(MASK)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto *out = reinterpret_cast<T *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t qBlocks = div_up(qLength, qBlock);
+    const size_t workAmount = batch * heads * qBlocks;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+
+        float *kt = &buffers[ithr * threadBufferSize];
+        float *packedV = kt + headSize * kLength;
+        float *scaledQ = packedV + kLength * vHeadSize;
+        float *scores = scaledQ + qBlock * headSize;
+        float *outBlock = scores + qBlock * kLength;
+        float *invSums = outBlock + qBlock * vHeadSize;
+
+        size_t packedHead = std::numeric_limits<size_t>::max();
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t head = iwork / qBlocks;
+            const size_t b = head / heads, h = head % heads;
+            const size_t qStart = (iwork % qBlocks) * qBlock;
+            const size_t qRows = std::min(qBlock, qLength - qStart);
+
+            // the work of one thread is contiguous, so the keys and values are packed once per head
+            if (head != packedHead) {
+                const T *kHead = k + b * kStrides[0] + h * kStrides[1];
+                for (size_t j = 0; j < kLength; j++)
+                    for (size_t d = 0; d < headSize; d++)
+                        kt[d * kLength + j] = static_cast<float>(kHead[j * kStrides[2] + d * kStrides[3]]);
+                const T *vHead = v + b * vStrides[0] + h * vStrides[1];
+                for (size_t j = 0; j < kLength; j++)
+                    for (size_t d = 0; d < vHeadSize; d++)
+                        packedV[j * vHeadSize + d] = static_cast<float>(vHead[j * vStrides[2] + d * vStrides[3]]);
+                packedHead = head;
+            }
+
+            for (size_t i = 0; i < qRows; i++) {
+                const T *qRow = q + b * qStrides[0] + h * qStrides[1] + (qStart + i) * qStrides[2];
+                for (size_t d = 0; d < headSize; d++)
+                    scaledQ[i * headSize + d] = static_cast<float>(qRow[d * qStrides[3]]) * scale;
+            }
+
+            // Q * K^T of the whole query block reuses every row of the packed keys for all the queries
+            std::fill(scores, scores + qRows * kLength, 0.f);
+            for (size_t d = 0; d < headSize; d++) {
+                const float *ktRow = kt + d * kLength;
+                for (size_t i = 0; i < qRows; i++) {
+                    const float qValue = scaledQ[i * headSize + d];
+                    float *s = scores + i * kLength;
+                    for (size_t j = 0; j < kLength; j++)
+                        s[j] += qValue * ktRow[j];
+                }
+            }
+
+            for (size_t i = 0; i < qRows; i++) {
+                float *s = scores + i * kLength;
+                if (mask) {
+                    const float *maskRow = mask + b * maskStrides[0] + h * maskStrides[1] + (qStart + i) * maskStrides[2];
+                    if (maskStrides[3] == 0) {
+                        for (size_t j = 0; j < kLength; j++)
+                            s[j] += maskRow[0];
+                    } else {
+                        for (size_t j = 0; j < kLength; j++)
+                            s[j] += maskRow[j];
+                    }
+                }
+
+                float max = s[0];
+                for (size_t j = 1; j < kLength; j++)
+                    max = std::max(max, s[j]);
+                float sum = 0.f;
+                for (size_t j = 0; j < kLength; j++) {
+                    s[j] = std::exp(s[j] - max);
+                    sum += s[j];
+                }
+                // the probabilities are normalized after the multiplication by the values
+                invSums[i] = 1.f / sum;
+            }
+
+            std::fill(outBlock, outBlock + qRows * vHeadSize, 0.f);
+            for (size_t j = 0; j < kLength; j++) {
+                const float *vRow = packedV + j * vHeadSize;
+                for (size_t i = 0; i < qRows; i++) {
+                    const float p = scores[i * kLength + j];
+                    float *o = outBlock + i * vHeadSize;
+                    for (size_t d = 0; d < vHeadSize; d++)
+                        o[d] += p * vRow[d];
+                }
+            }
+
+            for (size_t i = 0; i < qRows; i++) {
+                const float *o = outBlock + i * vHeadSize;
+                T *dst = out + b * outStrides[0] + h * outStrides[1] + (qStart + i) * outStrides[2];
+                for (size_t d = 0; d < vHeadSize; d++)
+                    dst[d * outStrides[3]] = static_cast<T>(o[d] * invSums[i]);
+            }
+        }
+    });
+}
+
+bool MKLDNNMHANode::created() const {
+    return getType() == MHA;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNMHANode, MHA)
@@ -0,0 +1,54 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Scaled dot product attention. Every thread computes the attention of a block of queries of one head:
+ * the transposed keys and the values of the head are packed to the contiguous FP32 buffers once per head,
+ * the scores of the query block stay in the cache between the two matrix multiplications and the softmax.
+ */
+class MKLDNNMHANode : public MKLDNNNode {
+public:
+    MKLDNNMHANode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename T>
+    void mha();
+
+    enum { Q, K, V, MASK };
+    // strides of the [B, H, S, D] dimensions
+    using Strides = std::vector<size_t>;
+
+    size_t batch = 0, heads = 0, qLength = 0, kLength = 0, headSize = 0, vHeadSize = 0;
+    float scale = 1.f;
+    std::vector<std::vector<int64_t>> orders;
+    std::vector<int64_t> outOrder;
+    bool withMask = false;
+
+    Strides qStrides, kStrides, vStrides, maskStrides, outStrides;
+    size_t qBlock = 0;
+    size_t threadBufferSize = 0;
+    std::vector<float> buffers;
+
+    InferenceEngine::Precision dataPrecision;
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
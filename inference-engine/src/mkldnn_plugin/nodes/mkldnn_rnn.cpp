@@ -9,9 +9,12 @@
 #include "utils/bfloat16.hpp"
 #include "mkldnn_input_node.h"
 #include <mkldnn_extension_utils.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 #include <ngraph/node.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
 
@@ -102,9 +105,10 @@ const std::map<InferenceEngine::Precision, InferenceEngine::Precision> MKLDNNRNN
     // layer precision,                weights precision
     {InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP32},
     {InferenceEngine::Precision::BF16, InferenceEngine::Precision::BF16},
-    // FP16 and U8 are not supported yet
+    // FP32 weights are quantized by the node
+    {InferenceEngine::Precision::U8,   InferenceEngine::Precision::FP32},
+    // FP16 is not supported yet
     // {InferenceEngine::Precision::FP16, InferenceEngine::Precision::FP16},
-    // {InferenceEngine::Precision::U8,   InferenceEngine::Precision::I8},
 };
 
 bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -278,8 +282,12 @@ void MKLDNNRNN::initCell(const std::shared_ptr<ngraph::Node>& op) {
 }
 
 void MKLDNNRNN::fillCellDesc() {
-    runtimePrecision = getOriginalInputPrecisionAtPort(0);
-    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    runtimePrecision = quantized ? Precision::U8 : getOriginalInputPrecisionAtPort(0);
+    // the int8 primitive takes the quantized layer input only, the states and the output are kept in FP32
+    auto dataType = quantized ? memory::data_type::f32 : MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    auto layerDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    auto weightsDataType = quantized ? memory::data_type::s8 : dataType;
+    auto weightsFormat = quantized ? memory::format_tag::any : memory::format_tag::ldigo;
 
     MKLDNNDims S_4D_shape {L, D, N, SC};
 
@@ -288,7 +296,7 @@ void MKLDNNRNN::fillCellDesc() {
     out_data_d.resize(S + 1);
 
     // Shapes and Attributes are correct. Can start internal stuff initialization.
-    in_data_d[RNNInOutKind::Layer]  = {MKLDNNDims{T, N, DC}, dataType, memory::format_tag::tnc};
+    in_data_d[RNNInOutKind::Layer]  = {MKLDNNDims{T, N, DC}, layerDataType, memory::format_tag::tnc};
     out_data_d[RNNInOutKind::Layer] = {MKLDNNDims{T, N, SC}, dataType, memory::format_tag::tnc};
 
     in_data_d[RNNInOutKind::HiddenState]  = {S_4D_shape, dataType, memory::format_tag::ldnc};
@@ -299,8 +307,8 @@ void MKLDNNRNN::fillCellDesc() {
         out_data_d[RNNInOutKind::CellState] = {S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc};
     }
 
-    w_data_d   = {{L, D, DC, G, SC}, dataType, memory::format_tag::ldigo};
-    w_state_d  = {{L, D, SC, G, SC}, dataType, memory::format_tag::ldigo};
+    w_data_d   = {{L, D, DC, G, SC}, weightsDataType, weightsFormat};
+    w_state_d  = {{L, D, SC, G, SC}, weightsDataType, weightsFormat};
 
     // Add 5th input
     w_bias_d = {{L, D, Gb, SC}, memory::data_type::f32, memory::format_tag::ldgo};
@@ -312,7 +320,7 @@ void MKLDNNRNN::fillCellDesc() {
     std::vector<TensorDesc> in_candidate, out_candidate;
     in_candidate.reserve(6);
 
-    in_candidate.emplace_back(MKLDNNMemoryDesc {D_shape, dataType, memory::format_tag::nc});
+    in_candidate.emplace_back(MKLDNNMemoryDesc {D_shape, layerDataType, memory::format_tag::nc});
     in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, dataType, memory::format_tag::nc});
     out_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, dataType, memory::format_tag::nc});
 
@@ -378,13 +386,17 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
 }
 
 void MKLDNNRNN::fillSeqDesc() {
-    runtimePrecision = getOriginalInputPrecisionAtPort(0);
-    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    runtimePrecision = quantized ? Precision::U8 : getOriginalInputPrecisionAtPort(0);
+    // the int8 primitive takes the quantized layer input only, the states and the output are kept in FP32
+    auto dataType = quantized ? memory::data_type::f32 : MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    auto layerDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    auto weightsDataType = quantized ? memory::data_type::s8 : dataType;
+    auto weightsFormat = quantized ? memory::format_tag::any : memory::format_tag::ldigo;
 
     MKLDNNDims S_4D_shape {L, D, N, SC};
 
     // Try to create descriptor and corresponding configuration
-    in_data_d[RNNInOutKind::Layer]  = {MKLDNNDims{in_data_dims},  dataType, memory::format_tag::tnc};
+    in_data_d[RNNInOutKind::Layer]  = {MKLDNNDims{in_data_dims},  layerDataType, memory::format_tag::tnc};
     out_data_d[RNNInOutKind::Layer] = {MKLDNNDims{out_data_dims}, dataType, memory::format_tag::tnc};
 
     in_data_d[RNNInOutKind::HiddenState]  = {MKLDNNDims{S_4D_shape}, dataType, memory::format_tag::ldnc};
@@ -395,8 +407,8 @@ void MKLDNNRNN::fillSeqDesc() {
         out_data_d[RNNInOutKind::CellState] = {MKLDNNDims{S_4D_shape}, memory::data_type::f32, memory::format_tag::ldnc};
     }
 
-    w_data_d  = {{L, D, DC, G, SC}, dataType, memory::format_tag::ldigo};
-    w_state_d = {{L, D, SC, G, SC}, dataType, memory::format_tag::ldigo};
+    w_data_d  = {{L, D, DC, G, SC}, weightsDataType, weightsFormat};
+    w_state_d = {{L, D, SC, G, SC}, weightsDataType, weightsFormat};
 
     w_bias_d = {{L, D, Gb, SC}, memory::data_type::f32, memory::format_tag::ldgo};
 
@@ -405,9 +417,9 @@ void MKLDNNRNN::fillSeqDesc() {
     std::vector<TensorDesc> in_candidate;
 
     if (nativeOrder)
-        in_candidate.push_back(MKLDNNMemoryDesc{inDims[RNNInOutKind::Layer], dataType, memory::format_tag::tnc});
+        in_candidate.push_back(MKLDNNMemoryDesc{inDims[RNNInOutKind::Layer], layerDataType, memory::format_tag::tnc});
     else
-        in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, dataType, memory::format_tag::ntc});
+        in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, layerDataType, memory::format_tag::ntc});
 
     in_candidate.push_back(MKLDNNMemoryDesc{{N, D, SC}, dataType, memory::format_tag::ntc}); // initial hidden state
     if (haveCellState(cell_type))
@@ -445,12 +457,15 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
     if (!verifyWeightsPrecision(runtimePrecision, weightPrec) && runtimePrecision != Precision::BF16 && weightPrec != Precision::FP32) {
         IE_THROW() << "Doesn't support combination of weights precision: " << weightPrec << " and runtime precision: " << runtimePrecision;
     }
+    // the quantized weights are filled in FP32 and reordered to the layout of the primitive with the quantization
+    const auto fillPrec = runtimePrecision == Precision::U8 ? Precision::FP32 : runtimePrecision;
+
     // create weight blobs (data and state part)
     auto w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_data_mem->Create(w_data_d);
+    w_data_mem->Create(quantized ? MKLDNNMemoryDesc{w_data_d.getDims(), memory::data_type::f32, memory::format_tag::ldigo} : w_data_d);
     internalBlobMemory.push_back(w_data_mem);
     auto w_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_state_mem->Create(w_state_d);
+    w_state_mem->Create(quantized ? MKLDNNMemoryDesc{w_state_d.getDims(), memory::data_type::f32, memory::format_tag::ldigo} : w_state_d);
     internalBlobMemory.push_back(w_state_mem);
 
     const size_t ie_w_vec_size = getParentEdgesAtPort(wIdx)[0]->getDims().size();
@@ -466,8 +481,8 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
 
     auto ie_w_ptr = ie_w_vec.data();
     auto ie_r_ptr = ie_r_vec.data();
-    cpu_convert(wConstBlob->GetPtr(), ie_w_ptr, weightPrec, runtimePrecision, ie_w_vec_size);
-    cpu_convert(rConstBlob->GetPtr(), ie_r_ptr, weightPrec, runtimePrecision, ie_r_vec_size);
+    cpu_convert(wConstBlob->GetPtr(), ie_w_ptr, weightPrec, fillPrec, ie_w_vec_size);
+    cpu_convert(rConstBlob->GetPtr(), ie_r_ptr, weightPrec, fillPrec, ie_r_vec_size);
 
     auto w_ptr = static_cast<Prec*>(w_data_mem->GetData());
     auto r_ptr = static_cast<Prec*>(w_state_mem->GetData());
@@ -490,6 +505,18 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
             }
         }
     }
+
+    if (quantized) {
+        // symmetric scales which map the maximal absolute value of the data and state weights to 127
+        weightsScales.assign(step, 0.f);
+        for (int i = 0; i < step; i++) {
+            for (int in_i = 0; in_i < DC; in_i++)
+                weightsScales[i] = std::max(weightsScales[i], std::abs(static_cast<float>(w_ptr[in_i * step + i])));
+            for (int in_i = 0; in_i < SC; in_i++)
+                weightsScales[i] = std::max(weightsScales[i], std::abs(static_cast<float>(r_ptr[in_i * step + i])));
+            weightsScales[i] = weightsScales[i] == 0.f ? 1.f : 127.f / weightsScales[i];
+        }
+    }
 }
 
 template <InferenceEngine::Precision::ePrecision Prec>
@@ -582,12 +609,12 @@ void MKLDNNRNN::copyWeightsData() {
 
     if (runtimePrecision == Precision::BF16)
         fillWeights<bfloat16_t>(gate_map, wIdx, rIdx);
-    else if (runtimePrecision == Precision::FP32)
+    else if (runtimePrecision == Precision::FP32 || runtimePrecision == Precision::U8)
         fillWeights<float>(gate_map, wIdx, rIdx);
-    else // TODO FP16 and INT8 support
+    else // TODO FP16 support
         IE_THROW() << "Unsupported data type";
 
-    if (runtimePrecision == Precision::BF16 || runtimePrecision == Precision::FP32)
+    if (runtimePrecision == Precision::BF16 || runtimePrecision == Precision::FP32 || runtimePrecision == Precision::U8)
         fillBiases<Precision::FP32>(gate_map);
 }
 
@@ -670,9 +697,43 @@ void MKLDNNRNN::createDescriptor(const std::vector<TensorDesc> &inputDesc,
     supportedPrimitiveDescriptors.emplace_back(config, ref_any);
 }
 
+bool MKLDNNRNN::canBeQuantized() const {
+    return one_of(cell_type, mkldnn::algorithm::vanilla_lstm, mkldnn::algorithm::vanilla_gru) &&
+           impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core);
+}
+
+void MKLDNNRNN::setDataQuantization(float scale, float shift) {
+    quantized = true;
+    dataScale = scale;
+    dataShift = shift;
+}
+
+void MKLDNNRNN::quantizeWeights(const mkldnn::primitive_desc_iterator& primitiveDesc, const mkldnn::primitive_attr& attr) {
+    mkldnn::stream strm(getEngine());
+    // the data and state weights are the first two internal blobs, the reorder also computes the compensation
+    for (size_t i = 0; i < 2; i++) {
+        auto quantizedMem = std::make_shared<MKLDNNMemory>(getEngine());
+        quantizedMem->Create(MKLDNNMemoryDesc(primitiveDesc.weights_desc(i)));
+        auto src = internalBlobMemory[i]->GetPrimitive();
+        auto dst = quantizedMem->GetPrimitive();
+        mkldnn::reorder(src, dst, attr).execute(strm, src, dst);
+        internalBlobMemory[i] = quantizedMem;
+    }
+}
+
 void MKLDNNRNN::createPrimitive() {
-    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
+    mkldnn::primitive_attr attr;
+    if (quantized) {
+        attr.set_rnn_data_qparams(dataScale, dataShift);
+        // the scales are given per gate and output channel, the dimensions 3 and 4 of ldigo
+        attr.set_rnn_weights_qparams((1 << 3) | (1 << 4), weightsScales);
+    }
+
+    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine(), attr);
     prim.reset(new mkldnn::primitive(pd));
+
+    if (quantized)
+        quantizeWeights(pd, attr);
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
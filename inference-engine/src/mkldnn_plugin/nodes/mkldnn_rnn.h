@@ -24,6 +24,16 @@ public:
 
     void execute(mkldnn::stream strm) override;
 
+    /**
+     * Whether the cell can be computed by the int8 primitive with the u8 layer input and the s8 weights
+     */
+    bool canBeQuantized() const;
+    /**
+     * Makes the node take the layer input quantized to u8 as round(scale * x + shift). The weights are quantized
+     * by the node per gate and output channel
+     */
+    void setDataQuantization(float scale, float shift);
+
 private:
     void initCell(const std::shared_ptr<ngraph::Node>& op);
     void initSeq(const std::shared_ptr<ngraph::Node>& op);
@@ -38,6 +48,7 @@ private:
     void fillBiases(const int* gate_map);
 
     void copyWeightsData();
+    void quantizeWeights(const mkldnn::primitive_desc_iterator& primitiveDesc, const mkldnn::primitive_attr& attr);
 
 private:
     InferenceEngine::Precision runtimePrecision;
@@ -83,6 +94,12 @@ private:
     std::vector<size_t > in_data_dims;
     std::vector<size_t > out_data_dims;
 
+    bool quantized = false;
+    float dataScale = 1.f;
+    float dataShift = 0.f;
+    /** Scales of the weights per gate and output channel, the same for the data and state weights */
+    std::vector<float> weightsScales;
+
     size_t wIdx = 0;
     size_t rIdx = 0;
     size_t bIdx = 0;
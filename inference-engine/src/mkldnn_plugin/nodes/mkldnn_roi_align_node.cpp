@@ -14,6 +14,7 @@
 #include "ie_parallel.hpp"
 #include <mkldnn_selective_build.h>
 #include <ngraph/opsets/opset3.hpp>
+#include "common/roi_align_sampling.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -195,171 +196,61 @@ void MKLDNNROIAlignNode::executeSpecified() {
 
     const int binCount = pooledH * pooledW;
 
-    const int hInputStride = srcBlockDesc.strides[2];
-    const int wInputStride = srcBlockDesc.strides[3];
-    const int hOutputStride = dstBlockDesc.strides[2];
-    const int wOutputStride = dstBlockDesc.strides[3];
+    const size_t wInputStride = srcBlockDesc.strides[3];
+    const size_t hOutputStride = dstBlockDesc.strides[2];
+    const size_t wOutputStride = dstBlockDesc.strides[3];
     const int chPadding = srcMemory0.GetDescriptor().data.padded_dims[1];
     const int blockCount = chPadding / blockSize;
+    const bool maxMode = getAlgorithm() == Algorithm::ROIAlignMax;
 
     for (; realRois < nominalRoiCount; realRois++) {
         auto roiBatchInd = srcRoiIdx[realRois];
         if (roiBatchInd == -1) {
             break;
         }
-    }
-
-    for (int n = 0; n < realRois; ++n) {
-        int roiOff = n * 4;
-        const float* srcRoiPtr = &srcRoi[roiOff];
-        int roiBatchInd = srcRoiIdx[n];
         if (roiBatchInd < -1) {  // -1 means switched off region
             IE_THROW() << "Batch index cannot be less, than -1";
         } else if (roiBatchInd >= inputDimVector[0]) {
             IE_THROW() << "Demanded batch (id = " << roiBatchInd << ") doesn't exist";
         }
+    }
 
-        float x1 = srcRoiPtr[0] * spatialScale;
-        float y1 = srcRoiPtr[1] * spatialScale;
-        float x2 = srcRoiPtr[2] * spatialScale;
-        float y2 = srcRoiPtr[3] * spatialScale;
-
-        float roiHeight = std::max(y2 - y1, 1.0f);
-        float roiWidth = std::max(x2 - x1, 1.0f);
-        float binHeight = roiHeight / pooledH;
-        float binWidth = roiWidth / pooledW;
-
-        auto samplingRatioX = samplingRatio == 0 ? static_cast<int>(ceil(binWidth)) : samplingRatio;
-        auto samplingRatioY = samplingRatio == 0 ? static_cast<int>(ceil(binHeight)) : samplingRatio;
-
-        uint64_t numSamplesInBin = samplingRatioX * samplingRatioY;
-
-        float sampleDistanceX = binWidth / samplingRatioX;
-        float sampleDistanceY = binHeight / samplingRatioY;
-        // prepare arrays for sampling points and weights
-        std::vector<std::pair<int, int>> pointVector;
-        std::vector<float> weightVector;
-        pointVector.reserve(4 * numSamplesInBin * binCount);
-        weightVector.reserve(4 * numSamplesInBin * binCount);
-
-        for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
-            for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
-                // run into bin
-                for (int ySampleInd = 0; ySampleInd < samplingRatioY; ySampleInd++) {
-                    float sampleY = y1 + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
-                    for (int xSampleInd = 0; xSampleInd < samplingRatioX; xSampleInd++) {
-                        float sampleX = x1 + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
-                        if (sampleX < -1.0 || sampleX > W ||
-                            sampleY < -1.0 || sampleY > H) {
-                            // For this sample we save 4x point (0,0) with weight 0
-                            pointVector.insert(pointVector.end(), 4, {0, 0});
-                            weightVector.insert(weightVector.end(), 4, float{0});
-                            continue;
-                        }
-                        sampleX = std::max(sampleX, float{0});
-                        sampleY = std::max(sampleY, float{0});
-
-                        auto sampleYLow = static_cast<unsigned int>(sampleY);
-                        auto sampleXLow = static_cast<unsigned int>(sampleX);
-                        unsigned int sampleYHigh;
-                        unsigned int sampleXHigh;
-                        if (sampleYLow >= H - 1) {
-                            sampleYHigh = sampleYLow = H - 1;
-                            sampleY = static_cast<float>(sampleYLow);
-                        } else {
-                            sampleYHigh = sampleYLow + 1;
-                        }
-                        if (sampleXLow >= W - 1) {
-                            sampleXHigh = sampleXLow = W - 1;
-                            sampleX = static_cast<float>(sampleXLow);
-                        } else {
-                            sampleXHigh = sampleXLow + 1;
-                        }
-                        pointVector.push_back({sampleYLow, sampleXLow});
-                        pointVector.push_back({sampleYLow, sampleXHigh});
-                        pointVector.push_back({sampleYHigh, sampleXLow});
-                        pointVector.push_back({sampleYHigh, sampleXHigh});
-
-                        // weight calculation for bilinear interpolation
-                        auto ly = sampleY - sampleYLow;
-                        auto lx = sampleX - sampleXLow;
-                        auto hy = 1.0f - ly;
-                        auto hx = 1.0f - lx;
-
-                        weightVector.push_back(hy * hx);
-                        weightVector.push_back(hy * lx);
-                        weightVector.push_back(ly * hx);
-                        weightVector.push_back(ly * lx);
-                    }
+    // sampling points and bilinear weights depend only on the ROI, so they are computed once per ROI
+    // and reused by all channels
+    std::vector<ROIAlignSamplingTable> tables(realRois);
+    parallel_for(realRois, [&](int n) {
+        const float* srcRoiPtr = &srcRoi[n * 4];
+        buildROIAlignSamplingTable(srcRoiPtr[0] * spatialScale, srcRoiPtr[1] * spatialScale,
+                                   srcRoiPtr[2] * spatialScale, srcRoiPtr[3] * spatialScale,
+                                   H, W, pooledH, pooledW, samplingRatio, tables[n]);
+    });
+
+    if (isNhwcFmt) {
+        parallel_for3d(realRois, pooledH, pooledW, [&](int n, int yBinInd, int xBinInd) {
+            const inputType *src = srcData + static_cast<size_t>(srcRoiIdx[n]) * C * H * W;
+            outputType *out = dst + static_cast<size_t>(n) * C * binCount + yBinInd * hOutputStride + xBinInd * wOutputStride;
+            roiAlignPoolBin(tables[n], yBinInd * pooledW + xBinInd, maxMode, src, wInputStride, C, out);
+        });
+    } else if (!isPlainFmt) {  // nChw16c, nChw8c
+        parallel_for4d(realRois, blockCount, pooledH, pooledW, [&](int n, int blkIdx, int yBinInd, int xBinInd) {
+            const int cStart = blkIdx * blockSize;
+            const int channels = std::min(blockSize, C - cStart);
+            const inputType *src = srcData + (static_cast<size_t>(srcRoiIdx[n]) * chPadding + cStart) * H * W;
+            outputType *out = dst + (static_cast<size_t>(n) * chPadding + cStart) * binCount +
+                              yBinInd * hOutputStride + xBinInd * wOutputStride;
+            roiAlignPoolBin(tables[n], yBinInd * pooledW + xBinInd, maxMode, src, wInputStride, channels, out);
+        });
+    } else {  // nchw
+        parallel_for2d(realRois, C, [&](int n, int c) {
+            const inputType *src = srcData + (static_cast<size_t>(srcRoiIdx[n]) * C + c) * H * W;
+            outputType *out = dst + (static_cast<size_t>(n) * C + c) * binCount;
+            for (int yBinInd = 0; yBinInd < pooledH; yBinInd++) {
+                for (int xBinInd = 0; xBinInd < pooledW; xBinInd++) {
+                    roiAlignPoolBin(tables[n], yBinInd * pooledW + xBinInd, maxMode, src, wInputStride, 1,
+                                    out + yBinInd * hOutputStride + xBinInd * wOutputStride);
                 }
             }
-        }
-        auto pool = [&] (int xBinInd_, int yBinInd_, int binOffsetInput_, int binOffsetOutput_, int blockResidual_) {
-            float pooledValue = 0;
-            unsigned int sampleIndex = 4 * (yBinInd_ * pooledW + xBinInd_) * numSamplesInBin;
-            for (unsigned int binSampleInd = 0; binSampleInd < numSamplesInBin; binSampleInd++) {
-                size_t part1Index = binOffsetInput_ + pointVector[sampleIndex].first * hInputStride +
-                                    pointVector[sampleIndex].second * wInputStride + blockResidual_;
-                float part1 = srcData[part1Index];
-                size_t part2Index = binOffsetInput_ + pointVector[sampleIndex + 1].first * hInputStride +
-                                    pointVector[sampleIndex + 1].second * wInputStride + blockResidual_;
-                float part2 = srcData[part2Index];
-                size_t part3Index = binOffsetInput_ + pointVector[sampleIndex + 2].first * hInputStride +
-                                    pointVector[sampleIndex + 2].second * wInputStride + blockResidual_;
-                float part3 = srcData[part3Index];
-                size_t part4Index = binOffsetInput_ + pointVector[sampleIndex + 3].first * hInputStride +
-                                    pointVector[sampleIndex + 3].second * wInputStride + blockResidual_;
-                float part4 = srcData[part4Index];
-
-                switch (getAlgorithm()) {
-                    case Algorithm::ROIAlignMax:
-                    {
-                        float sampleValue = std::max(
-                                {weightVector[sampleIndex] * part1,
-                                 weightVector[sampleIndex + 1] * part2,
-                                 weightVector[sampleIndex + 2] * part3,
-                                 weightVector[sampleIndex + 3] * part4});
-                        pooledValue = sampleValue > pooledValue ? sampleValue : pooledValue;
-                        break;
-                    }
-                    case Algorithm::ROIAlignAvg:
-                    default:
-                    {
-                        float sampleValue =
-                                weightVector[sampleIndex] * part1 +
-                                weightVector[sampleIndex + 1] * part2 +
-                                weightVector[sampleIndex + 2] * part3 +
-                                weightVector[sampleIndex + 3] * part4;
-                        pooledValue += sampleValue / numSamplesInBin;
-                    }
-                }
-                sampleIndex += 4;
-            }
-            size_t dstIndex = binOffsetOutput_ + yBinInd_ * hOutputStride +
-                              xBinInd_ * wOutputStride + blockResidual_;
-            dst[dstIndex] = pooledValue;
-        };
-        if (isNhwcFmt) {
-            parallel_for2d(pooledH, pooledW, [&](int yBinInd, int xBinInd) {
-                for (int c = 0; c < C; c++) {
-                    size_t binOffsetInput = roiBatchInd * C * H * W + c;
-                    size_t binOffsetOutput = n * C * binCount + c;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, 0);
-                }
-            });
-        } else {  // nchw, nChw16c, nChw8c
-            parallel_for3d(blockCount, pooledH, pooledW, [&](int blkIdx, int yBinInd, int xBinInd) {
-                int cStart = blkIdx * blockSize;
-                int cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
-                for (int c = cStart; c < cEnd; c++) {
-                    const int blockResidual = (isPlainFmt ? 0 : c % blockSize);
-                    const int blockIdx = (c / blockSize) * blockSize;
-                    size_t binOffsetInput = (roiBatchInd * chPadding + blockIdx) * H * W;
-                    size_t binOffsetOutput = (n * chPadding + blockIdx) * binCount;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, blockResidual);
-                }
-            });
-        }
+        });
     }
 }
 
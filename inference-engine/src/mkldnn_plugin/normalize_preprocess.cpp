@@ -78,7 +78,27 @@ void NormalizePreprocess::Load(const MKLDNNDims& inputDims, InputInfo::Ptr input
 
 void NormalizePreprocess::NormalizeImage(const MKLDNNDims &inputDims, float *input, InferenceEngine::Layout layout) {
     IE_ASSERT(input != nullptr);
+    normalize(inputDims, input, input, layout);
+}
+
+void NormalizePreprocess::NormalizeImage(const MKLDNNDims &inputDims, const void *src, Precision srcPrec,
+                                         float *dst, InferenceEngine::Layout layout) {
+    IE_ASSERT(src != nullptr && dst != nullptr);
+
+    switch (srcPrec) {
+        case Precision::FP32:
+            normalize(inputDims, reinterpret_cast<const float *>(src), dst, layout);
+            break;
+        case Precision::U8:
+            normalize(inputDims, reinterpret_cast<const uint8_t *>(src), dst, layout);
+            break;
+        default:
+            IE_THROW() << "Preprocessing error: unsupported source precision " << srcPrec.name() << " for fused normalization";
+    }
+}
 
+template <typename T>
+void NormalizePreprocess::normalize(const MKLDNNDims &inputDims, const T *src, float *dst, InferenceEngine::Layout layout) const {
     if (inputDims.ndims() != 4) {
         IE_THROW() << "Expecting input as 4 dimension blob with format NxCxHxW.";
     }
@@ -87,29 +107,41 @@ void NormalizePreprocess::NormalizeImage(const MKLDNNDims &inputDims, float *inp
         IE_THROW() << "Expecting input layout NCHW or NHWC.";
     }
 
-    int MB = inputDims[0];
-    int srcSize = inputDims.size() / MB;
+    const size_t MB = inputDims[0];
+    const size_t srcSize = inputDims.size() / MB;
 
     if (meanBuffer && meanBuffer->size()) {
         const float * meanBufferValues = meanBuffer->readOnly();
-
-        parallel_for2d(MB, srcSize, [&](int mb, int i) {
-            input[srcSize * mb + i] -= meanBufferValues[i];
+        const size_t C = inputDims[1];
+        const size_t chSize = srcSize / C;
+
+        parallel_for2d(MB, C, [&](size_t mb, size_t c) {
+            const size_t off = mb * srcSize + c * chSize;
+            const float *mean = meanBufferValues + c * chSize;
+            for (size_t i = 0; i < chSize; i++) {
+                dst[off + i] = static_cast<float>(src[off + i]) - mean[i];
+            }
         });
     } else if (!meanValues.empty() && !stdScales.empty()) {
-        int C = inputDims[1];
-        srcSize /= inputDims[1];
+        const size_t C = inputDims[1];
+        const size_t spatial = srcSize / C;
 
         if (layout == NCHW) {
-            parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
-                input[mb * C * srcSize + c * srcSize + i] -= meanValues[c];
-                input[mb * C * srcSize + c * srcSize + i] /= stdScales[c];
+            parallel_for2d(MB, C, [&](size_t mb, size_t c) {
+                const size_t off = mb * srcSize + c * spatial;
+                const float mean = meanValues[c];
+                const float scale = stdScales[c];
+                for (size_t i = 0; i < spatial; i++) {
+                    dst[off + i] = (static_cast<float>(src[off + i]) - mean) / scale;
+                }
             });
         } else if (layout == NHWC) {
-            parallel_for2d(MB, srcSize, [&](int mb, int i) {
-                for (int c = 0; c < C; c++) {
-                    input[mb * srcSize * C + i * C + c] -= meanValues[c];
-                    input[mb * srcSize * C + i * C + c] /= stdScales[c];
+            const float *mean = meanValues.data();
+            const float *scale = stdScales.data();
+            parallel_for2d(MB, spatial, [&](size_t mb, size_t i) {
+                const size_t off = mb * srcSize + i * C;
+                for (size_t c = 0; c < C; c++) {
+                    dst[off + c] = (static_cast<float>(src[off + c]) - mean[c]) / scale[c];
                 }
             });
         }
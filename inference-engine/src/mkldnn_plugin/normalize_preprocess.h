@@ -21,6 +21,17 @@ public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
     void NormalizeImage(const MKLDNNDims &inputDims, float *input, InferenceEngine::Layout layout);
 
+    /**
+     * Fused variant: converts the user data (U8 or FP32) to FP32, applies mean/scale and stores the result
+     * to the graph input memory within a single pass. The source and destination must have the same layout.
+     */
+    void NormalizeImage(const MKLDNNDims &inputDims, const void *src, InferenceEngine::Precision srcPrec,
+                        float *dst, InferenceEngine::Layout layout);
+
+    static bool isFusedPrecisionSupported(InferenceEngine::Precision prec) {
+        return prec == InferenceEngine::Precision::FP32 || prec == InferenceEngine::Precision::U8;
+    }
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void NormalizeImage(const MKLDNNDims &inputDims, T *input, InferenceEngine::Layout layout) {
         IE_ASSERT(input != nullptr);
@@ -80,6 +91,9 @@ public:
     }
 
 private:
+    template <typename T>
+    void normalize(const MKLDNNDims &inputDims, const T *src, float *dst, InferenceEngine::Layout layout) const;
+
     std::vector<float> meanValues;
 
     std::vector<float> stdScales;
@@ -24,6 +24,7 @@ public:
         readParam(blobDumpNodeType, "OV_CPU_BLOB_DUMP_NODE_TYPE");
         readParam(blobDumpNodeName, "OV_CPU_BLOB_DUMP_NODE_NAME");
         readParam(execGraphPath, "OV_CPU_EXEC_GRAPH_PATH");
+        readParam(layoutSelectionStatistics, "OV_CPU_LAYOUT_SELECTION_STATISTICS");
     }
 
     std::string blobDumpDir;
@@ -33,6 +34,7 @@ public:
     std::string blobDumpNodeType;
     std::string blobDumpNodeName;
     std::string execGraphPath;
+    std::string layoutSelectionStatistics;
 
 private:
     void readParam(std::string& param, const char* envVar) {
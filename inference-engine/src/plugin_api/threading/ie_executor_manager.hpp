@@ -17,6 +17,7 @@
 
 #include "threading/ie_itask_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
+#include "threading/ie_shared_streams_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -29,18 +30,33 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    SharedStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
+    void retireCPUStreamsExecutor(IStreamsExecutor::Ptr executor);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
     // for tests purposes
     size_t getIdleCPUStreamsExecutorsNumber();
 
+    // for tests purposes
+    size_t getSharedCPUStreamsExecutorsNumber();
+
+    // for tests purposes
+    size_t getRetiredCPUStreamsExecutorsNumber();
+
     void clear(const std::string& id = {});
 
 private:
+    void destroyRetiredExecutors();
+
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
+    std::vector<SharedStreamsExecutor::Ptr> sharedCpuStreamsExecutors;
+    std::vector<IStreamsExecutor::Ptr> retiredCpuStreamsExecutors;
     std::mutex streamExecutorMutex;
+    std::mutex retiredExecutorMutex;
     std::mutex taskExecutorMutex;
 };
 
@@ -83,6 +99,23 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns a process-wide streams executor with the given configuration.
+     * Unlike getIdleCPUStreamsExecutor() the same executor is returned to all callers,
+     * so they run on one set of stream threads instead of creating their own.
+     * @param config Streams configuration
+     * @return A shared pointer to existing or newly created SharedStreamsExecutor
+     */
+    SharedStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
+    /**
+     * @brief Takes the last reference to an executor released in one of its own threads, which can not join itself.
+     * The executor is destroyed by the next call of getIdleCPUStreamsExecutor(), getSharedCPUStreamsExecutor()
+     * or clear() in another thread.
+     * @param executor An executor to destroy
+     */
+    void retireCPUStreamsExecutor(IStreamsExecutor::Ptr executor);
+
     /**
      * @cond
      */
@@ -90,6 +123,10 @@ public:
 
     size_t getIdleCPUStreamsExecutorsNumber();
 
+    size_t getSharedCPUStreamsExecutorsNumber();
+
+    size_t getRetiredCPUStreamsExecutorsNumber();
+
     void clear(const std::string& id = {});
     /**
      * @endcond
@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_shared_streams_executor.hpp
+ * @brief A header file for Inference Engine CPU-Streams-based Executor shared between several clients
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class SharedStreamsExecutor
+ * @ingroup ie_dev_api_threading
+ * @brief Runs tasks of several clients (e.g. executable networks) on one set of CPU streams.
+ *        Every client submits tasks through its own IStreamsExecutor facade. Waiting tasks are passed to a free stream
+ *        in the order of client priority and, within the same priority, proportionally to client weights.
+ */
+class INFERENCE_ENGINE_API_CLASS(SharedStreamsExecutor) {
+    struct Impl;
+    struct ClientState;
+
+public:
+    /**
+     * @brief A shared pointer to a SharedStreamsExecutor object
+     */
+    using Ptr = std::shared_ptr<SharedStreamsExecutor>;
+
+    /**
+     * @brief Scheduling parameters of a client
+     */
+    struct ClientConfig {
+        std::string   _name;          //!< Client name used in error messages
+        unsigned int  _weight;        //!< Share of streams relative to other clients of the same priority
+        int           _priority;      //!< Tasks of clients with higher priority are always started first
+        std::size_t   _maxQueueSize;  //!< Tasks above this number of waiting ones are rejected. 0 means no limit
+
+        /**
+         * @brief      A constructor with arguments
+         *
+         * @param[in]  name          @copybrief ClientConfig::_name
+         * @param[in]  weight        @copybrief ClientConfig::_weight
+         * @param[in]  priority      @copybrief ClientConfig::_priority
+         * @param[in]  maxQueueSize  @copybrief ClientConfig::_maxQueueSize
+         */
+        ClientConfig(
+            std::string   name          = {},
+            unsigned int  weight        = 1,
+            int           priority      = 0,
+            std::size_t   maxQueueSize  = 0) :
+        _name{name},
+        _weight{weight},
+        _priority{priority},
+        _maxQueueSize{maxQueueSize} {
+        }
+    };
+
+    /**
+     * @brief Scheduling statistics of a client
+     */
+    struct ClientStatistics {
+        std::size_t    _waiting      = 0;    //!< Tasks waiting for a free stream
+        std::size_t    _executing    = 0;    //!< Tasks being executed
+        std::uint64_t  _executed     = 0;    //!< Tasks completed so far
+        std::uint64_t  _rejected     = 0;    //!< Tasks rejected because the queue limit was reached
+        double         _averageWaitMs = 0;   //!< Average time a started task waited for a stream
+        double         _maxWaitMs    = 0;    //!< Maximal time a started task waited for a stream
+    };
+
+    /**
+     * @brief A per-client view of the shared executor
+     */
+    class INFERENCE_ENGINE_API_CLASS(Client) : public IStreamsExecutor {
+    public:
+        /**
+         * @brief A shared pointer to a Client object
+         */
+        using Ptr = std::shared_ptr<Client>;
+
+        /**
+         * @brief A class destructor. Waits for the tasks that are already submitted. If it is called from a task
+         *        on the shared streams, the tasks are executed after the client is destroyed.
+         */
+        ~Client() override;
+
+        /**
+         * @brief Puts the task to the client queue
+         * @param task A task to start
+         * @throw RequestBusy if the client queue limit is reached
+         */
+        void run(Task task) override;
+
+        /**
+         * @brief Executes the tasks and waits for them. The caller is blocked, so the tasks are not limited by
+         *        the client queue size, e.g. the graph creation tasks of a network with fewer allowed waiting
+         *        requests than streams.
+         * @param tasks Tasks to execute
+         */
+        void runAndWait(const std::vector<Task>& tasks) override;
+
+        void Execute(Task task) override;
+
+        int GetStreamId() override;
+
+        int GetNumaNodeId() override;
+
+        /**
+         * @brief Returns current scheduling statistics of the client
+         * @return The statistics
+         */
+        ClientStatistics GetStatistics() const;
+
+    private:
+        friend class SharedStreamsExecutor;
+        Client(const std::shared_ptr<Impl>& impl, const ClientConfig& config);
+
+        std::shared_ptr<Impl>         _impl;
+        std::shared_ptr<ClientState>  _state;
+    };
+
+    /**
+     * @brief Constructor
+     * @param config Parameters of the shared streams
+     */
+    explicit SharedStreamsExecutor(const IStreamsExecutor::Config& config);
+
+    /**
+     * @brief Registers a new client of the shared streams
+     * @param config Scheduling parameters of the client
+     * @return A client executor
+     */
+    Client::Ptr CreateClient(const ClientConfig& config);
+
+    /**
+     * @brief Returns configuration of the shared streams
+     * @return The streams configuration
+     */
+    const IStreamsExecutor::Config& GetConfig() const;
+
+private:
+    std::shared_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
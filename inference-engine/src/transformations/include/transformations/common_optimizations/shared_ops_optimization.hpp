@@ -0,0 +1,39 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API SharedOpOptimization;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief SharedOpOptimization transformation replaces each group of equal operations
+ * with the first operation in this group. Operations are equal when they have the same type,
+ * attributes and input sources; Constants are equal when they have the same type, shape and data.
+ * Operations with attributes which cannot be compared (e.g. sub-graphs and variables) and
+ * operations with Result consumers are kept as is.
+ */
+class ngraph::pass::SharedOpOptimization: public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// @brief Returns the number of operations removed by the last run
+    size_t get_removed_ops_count() const { return m_removed_ops_count; }
+
+private:
+    size_t m_removed_ops_count = 0;
+};
@@ -69,6 +69,9 @@ class NGRAPH_API ConvertPrecision;
  *     GreaterEqual
  *     Less
  *     LessEqual
+ *
+ * Constants which feed only Convert operations to the "TO" type marked with the "RUNTIME_DECOMPRESSION"
+ * runtime attribute keep the "FROM" type: the plugin decompresses them during the inference.
  */
 
 using type_to_fuse_map = std::unordered_map<ngraph::NodeTypeInfo, std::function<bool(const std::shared_ptr<ngraph::Node>&, ngraph::element::Type, size_t idx)>>;
@@ -0,0 +1,280 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "itt.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/op/util/variable_extension.hpp>
+#include <ngraph/op/sink.hpp>
+#include <ngraph/log.hpp>
+#include <ngraph/util.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations/common_optimizations/shared_ops_optimization.hpp>
+#include <transformations/rt_info/dequantization_attribute.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+#include <transformations/rt_info/strides_property.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::SharedOpOptimization, "SharedOpOptimization", 0);
+
+namespace {
+
+/**
+ * @brief Collects the attributes of an operation into a binary key. The key is not valid when
+ * the operation has an attribute which cannot be compared by value: a Function, a Node reference
+ * or any attribute visited through the generic void adapter (e.g. Variable).
+ */
+class AttributesKeyBuilder : public ngraph::AttributeVisitor {
+public:
+    explicit AttributesKeyBuilder(std::string& key) : m_key(key) {}
+
+    bool is_valid() const { return m_valid; }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_valid = false;
+    }
+    void on_adapter(const std::string& name, ngraph::VisitorAdapter& adapter) override {
+        if (ngraph::is_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Node>>>(&adapter) ||
+            ngraph::is_type<ngraph::AttributeAdapter<ngraph::NodeVector>>(&adapter)) {
+            m_valid = false;
+            return;
+        }
+        ngraph::AttributeVisitor::on_adapter(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_valid = false;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        append(name);
+        append(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { append_value(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { append_vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        append(name);
+        const auto& values = adapter.get();
+        append_bytes(values.size());
+        for (const auto& value : values)
+            append(value);
+    }
+
+private:
+    template <typename T>
+    void append_bytes(const T& value) {
+        m_key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void append(const std::string& value) {
+        append_bytes(value.size());
+        m_key.append(value);
+    }
+    template <typename T>
+    void append_value(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        append(name);
+        append_bytes(adapter.get());
+    }
+    template <typename T>
+    void append_vector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        append(name);
+        const auto& values = adapter.get();
+        append_bytes(values.size());
+        if (!values.empty())
+            m_key.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    std::string& m_key;
+    bool m_valid = true;
+};
+
+size_t get_constant_byte_size(const ngraph::opset1::Constant& constant) {
+    return (ngraph::shape_size(constant.get_shape()) * constant.get_element_type().bitwidth() + 7) / 8;
+}
+
+uint64_t hash_bytes(const void* data, size_t size) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool is_shareable(const std::shared_ptr<ngraph::Node>& node) {
+    if (node->get_output_size() == 0 ||
+        ngraph::is_type<ngraph::opset1::Parameter>(node) ||
+        ngraph::is_type<ngraph::opset1::Result>(node) ||
+        std::dynamic_pointer_cast<ngraph::op::Sink>(node) ||
+        std::dynamic_pointer_cast<ngraph::VariableExtension>(node) ||
+        std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node))
+        return false;
+    // the friendly name of the node with a Result consumer is the name of the network output
+    for (const auto& output : node->outputs())
+        for (const auto& input : output.get_target_inputs())
+            if (ngraph::is_type<ngraph::opset1::Result>(input.get_node()))
+                return false;
+    return true;
+}
+
+void append_string(const std::string& value, std::string& key) {
+    const auto size = value.size();
+    key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key.append(value);
+}
+
+/**
+ * @brief Appends the runtime attribute to the key. The value is compared only for the known attribute
+ * types and those printable by Variant::to_string; other attributes are opaque, so their nodes are not shared.
+ * The fused names are not compared: they only list the original operations for the debug information.
+ */
+bool append_rt_info_value(const std::string& name, const std::shared_ptr<ngraph::Variant>& value, std::string& key) {
+    append_string(name, key);
+    if (!value || std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(value))
+        return true;
+    if (auto string_value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(value)) {
+        append_string(string_value->get(), key);
+    } else if (auto int_value = std::dynamic_pointer_cast<ngraph::VariantImpl<int64_t>>(value)) {
+        const auto number = int_value->get();
+        key.append(reinterpret_cast<const char*>(&number), sizeof(number));
+    } else if (auto dequantization = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(value)) {
+        append_string(dequantization->get().getDequantizationAttr(), key);
+    } else if (auto priority = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(value)) {
+        append_string(priority->get().getPrimitivesPriority(), key);
+    } else if (auto strides = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::Strides>>(value)) {
+        append_string(ngraph::join(strides->get()), key);
+    } else {
+        const auto printed = value->to_string();
+        if (printed.empty())
+            return false;
+        append_string(value->get_type_info().name, key);
+        append_string(printed, key);
+    }
+    return true;
+}
+
+/**
+ * @brief Builds the key of the operation. Equal operations have equal keys; the key of a Constant
+ * contains only the hash of its data, so the data of Constants with equal keys must be compared.
+ */
+bool get_op_key(const std::shared_ptr<ngraph::Node>& node, std::string& key) {
+    const auto& type_info = node->get_type_info();
+    key.append(type_info.name);
+    key.append(reinterpret_cast<const char*>(&type_info.version), sizeof(type_info.version));
+
+    for (const auto& input : node->input_values()) {
+        const auto id = input.get_node()->get_instance_id();
+        const auto index = input.get_index();
+        key.append(reinterpret_cast<const char*>(&id), sizeof(id));
+        key.append(reinterpret_cast<const char*>(&index), sizeof(index));
+    }
+    std::ostringstream outputs;
+    for (const auto& output : node->outputs())
+        outputs << output.get_element_type() << output.get_partial_shape();
+    key.append(outputs.str());
+
+    // nodes with different runtime attributes (e.g. dequantization or disabled constant folding marks)
+    // are processed differently by the plugins
+    for (const auto& rt_item : node->get_rt_info())
+        if (!append_rt_info_value(rt_item.first, rt_item.second, key))
+            return false;
+
+    if (auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node)) {
+        const auto hash = hash_bytes(constant->get_data_ptr(), get_constant_byte_size(*constant));
+        key.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+        return true;
+    }
+
+    AttributesKeyBuilder builder(key);
+    return node->visit_attributes(builder) && builder.is_valid();
+}
+
+bool are_equal_constants(const std::shared_ptr<ngraph::Node>& lhs, const std::shared_ptr<ngraph::Node>& rhs) {
+    auto lhs_constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(lhs);
+    auto rhs_constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(rhs);
+    if (!lhs_constant || !rhs_constant)
+        return true;
+    const auto size = get_constant_byte_size(*lhs_constant);
+    return size == get_constant_byte_size(*rhs_constant) &&
+           (lhs_constant->get_data_ptr() == rhs_constant->get_data_ptr() ||
+            std::memcmp(lhs_constant->get_data_ptr(), rhs_constant->get_data_ptr(), size) == 0);
+}
+
+bool share_ops(const std::shared_ptr<ngraph::Function>& f, size_t& removed_ops_count) {
+    bool graph_rewritten = false;
+
+    std::unordered_map<std::string, std::vector<std::shared_ptr<ngraph::Node>>> key_to_ops;
+    for (const auto& node : f->get_ordered_ops()) {
+        // Recursively apply transformation for sub-graph based operations
+        if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node))
+            if (auto sub_graph = sub_graph_node->get_function())
+                graph_rewritten |= share_ops(sub_graph, removed_ops_count);
+
+        if (!is_shareable(node))
+            continue;
+
+        // the inputs of the node are already replaced with the shared ones since the ops are visited
+        // in topological order, so the whole equal sub-graphs are merged in one pass
+        std::string key;
+        if (!get_op_key(node, key))
+            continue;
+
+        auto& candidates = key_to_ops[key];
+        std::shared_ptr<ngraph::Node> root;
+        for (const auto& candidate : candidates) {
+            if (are_equal_constants(candidate, node)) {
+                root = candidate;
+                break;
+            }
+        }
+        if (!root) {
+            candidates.push_back(node);
+            continue;
+        }
+
+        bool replaced = true;
+        for (size_t i = 0; i < node->get_output_size(); i++)
+            replaced &= ngraph::replace_output_update_name(node->output(i), root->output(i));
+        if (replaced)
+            removed_ops_count++;
+        graph_rewritten = true;
+    }
+    return graph_rewritten;
+}
+
+}  // namespace
+
+bool ngraph::pass::SharedOpOptimization::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    RUN_ON_FUNCTION_SCOPE(SharedOpOptimization);
+    m_removed_ops_count = 0;
+    const bool graph_rewritten = share_ops(f, m_removed_ops_count);
+    NGRAPH_DEBUG << "SharedOpOptimization removed " << m_removed_ops_count << " operations from " << f->get_friendly_name();
+    return graph_rewritten;
+}
@@ -6,6 +6,8 @@
 
 #include <random>
 #include <chrono>
+#include <functional>
+#include <numeric>
 
 #include <ie_blob.h>
 #include <blob_transform.hpp>
@@ -472,3 +474,64 @@ INSTANTIATE_TEST_SUITE_P(accuracy, BlobCopySetLayoutTest,
     ::testing::Combine(::testing::ValuesIn(BlobCopySetLayout_Dims),
                        ::testing::ValuesIn(BlobCopySetLayout_Precisions)));
 
+
+namespace {
+
+// Offset of a logical index in a blob with arbitrary blocking descriptor
+size_t elementOffset(const TensorDesc& desc, const SizeVector& idx) {
+    const auto& blk = desc.getBlockingDesc();
+    size_t offset = blk.getOffsetPadding();
+    for (size_t i = 0; i < blk.getOrder().size(); i++)
+        offset += idx[blk.getOrder()[i]] * blk.getStrides()[i];
+    return offset;
+}
+
+// Plain descriptor with the given dimension order and `pad` extra elements in every blocked dimension
+TensorDesc makePermutedDesc(const SizeVector& dims, const SizeVector& order, size_t pad, size_t offset) {
+    SizeVector blockDims(dims.size()), strides(dims.size());
+    size_t stride = 1;
+    for (size_t i = dims.size(); i-- > 0;) {
+        blockDims[i] = dims[order[i]];
+        strides[i] = stride;
+        stride *= blockDims[i] + pad;
+    }
+    return TensorDesc(Precision::FP32, dims, BlockingDesc(blockDims, order, offset, SizeVector(dims.size(), 0), strides));
+}
+
+}  // namespace
+
+using BlobCopyPermuteTest = ::testing::TestWithParam<std::tuple<Dims, SizeVector, SizeVector>>;
+
+TEST_P(BlobCopyPermuteTest, BlobCopyWithStridedROI) {
+    const auto dims = get<0>(GetParam());
+    const auto srcDesc = makePermutedDesc(dims, get<1>(GetParam()), 2, 3);
+    const auto dstDesc = makePermutedDesc(dims, get<2>(GetParam()), 1, 5);
+
+    std::vector<float> srcData(elementOffset(srcDesc, dims) + 1);
+    std::vector<float> dstData(elementOffset(dstDesc, dims) + 1, -1.f);
+    for (size_t i = 0; i < srcData.size(); i++)
+        srcData[i] = static_cast<float>(i);
+
+    auto src = make_shared_blob<float>(srcDesc, srcData.data(), srcData.size());
+    auto dst = make_shared_blob<float>(dstDesc, dstData.data(), dstData.size());
+    blob_copy(src, dst);
+
+    SizeVector idx(dims.size(), 0);
+    const size_t total = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+    for (size_t n = 0; n < total; n++) {
+        ASSERT_EQ(srcData[elementOffset(srcDesc, idx)], dstData[elementOffset(dstDesc, idx)]) << "at element " << n;
+        for (size_t i = idx.size(); i-- > 0;) {
+            if (++idx[i] < dims[i])
+                break;
+            idx[i] = 0;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(accuracy, BlobCopyPermuteTest,
+    ::testing::Values(
+        std::make_tuple(Dims{7, 33}, SizeVector{0, 1}, SizeVector{1, 0}),
+        std::make_tuple(Dims{5, 17, 40}, SizeVector{0, 1, 2}, SizeVector{2, 0, 1}),
+        std::make_tuple(Dims{2, 3, 19, 21}, SizeVector{0, 2, 3, 1}, SizeVector{0, 1, 2, 3}),
+        std::make_tuple(Dims{2, 4, 1, 5, 6, 3}, SizeVector{5, 4, 3, 2, 1, 0}, SizeVector{0, 3, 1, 5, 2, 4}),
+        std::make_tuple(Dims{64, 64, 32}, SizeVector{2, 1, 0}, SizeVector{0, 1, 2})));
@@ -5,6 +5,8 @@
 #include <ie_core.hpp>
 #include <ie_plugin_config.hpp>
 #include <ie_extension.h>
+#include <details/ie_so_loader.h>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 
 #include <file_utils.h>
 #include <ngraph_functions/subgraph_builders.hpp>
@@ -13,6 +15,7 @@
 #include <common_test_utils/test_assertions.hpp>
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <thread>
 #include <atomic>
 #include <mutex>
@@ -143,6 +146,106 @@ TEST_F(CoreThreadingTests, DISABLED_GetAvailableDevices) {
     }, 30);
 }
 
+// the plugin which counts how many times its devices are probed
+class AvailableDevicesPlugin : public InferenceEngine::IInferencePlugin {
+public:
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override {
+        if (name != METRIC_KEY(AVAILABLE_DEVICES)) {
+            IE_THROW(NotImplemented);
+        }
+        ++probesCount;
+        return std::vector<std::string>{"0"};
+    }
+
+    mutable std::atomic<int> probesCount{0};
+};
+
+class CoreAvailableDevicesCacheTests : public CoreThreadingTests {
+protected:
+    const std::string deviceName = "MOCK_DEVICES";
+
+    void SetUp() override {
+        CoreThreadingTests::SetUp();
+        mockEngine = InferenceEngine::details::SharedObjectLoader(
+            FileUtils::makePluginLibraryName<char>({}, std::string("mock_engine") + IE_BUILD_POSTFIX).c_str());
+    }
+
+    // the next plugin created from the mock engine library forwards the calls to the given one
+    void injectPlugin(InferenceEngine::IInferencePlugin& plugin) {
+        auto injectProxyEngine = reinterpret_cast<void (*)(InferenceEngine::IInferencePlugin*)>(
+            mockEngine.get_symbol("InjectProxyEngine"));
+        injectProxyEngine(&plugin);
+    }
+
+    void registerPlugin(InferenceEngine::Core& ie, InferenceEngine::IInferencePlugin& plugin) {
+        injectPlugin(plugin);
+        ie.RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, deviceName);
+    }
+
+    InferenceEngine::details::SharedObjectLoader mockEngine;
+};
+
+// tested function: GetAvailableDevices with the cached results of the devices probing
+TEST_F(CoreAvailableDevicesCacheTests, GetAvailableDevicesCached) {
+    // the plugins keep a pointer to the mock, so it outlives the core
+    AvailableDevicesPlugin plugin;
+    InferenceEngine::Core ie;
+    ie.SetConfig({{ CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL), "3600" }});
+    registerPlugin(ie, plugin);
+    const auto devices = ie.GetAvailableDevices();
+    ASSERT_NE(devices.end(), std::find(devices.begin(), devices.end(), deviceName));
+    ASSERT_EQ(1, plugin.probesCount);
+
+    runParallel([&] () {
+        ASSERT_EQ(devices, ie.GetAvailableDevices());
+    }, 100);
+
+    // the plugin is not probed again within the TTL
+    ASSERT_EQ(1, plugin.probesCount);
+}
+
+// tested function: GetAvailableDevices, SetConfig and UnregisterPlugin dropping the cached devices
+TEST_F(CoreAvailableDevicesCacheTests, GetAvailableDevicesCacheIsDropped) {
+    AvailableDevicesPlugin plugin, otherPlugin;
+    InferenceEngine::Core ie;
+    ie.SetConfig({{ CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL), "3600" }});
+    registerPlugin(ie, plugin);
+    ie.GetAvailableDevices();
+    ie.GetAvailableDevices();
+    ASSERT_EQ(1, plugin.probesCount);
+
+    // the devices may be reported differently with the new config
+    ie.SetConfig({{ CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL), "3600" }});
+    ie.GetAvailableDevices();
+    ASSERT_EQ(2, plugin.probesCount);
+
+    ie.SetConfig({{ CONFIG_KEY(PERF_COUNT), InferenceEngine::PluginConfigParams::YES }}, deviceName);
+    ie.GetAvailableDevices();
+    ie.GetAvailableDevices();
+    ASSERT_EQ(3, plugin.probesCount);
+
+    // the device stays in the registry, so the next plugin created for it is probed instead of
+    // returning the devices cached for the unloaded one
+    ie.UnregisterPlugin(deviceName);
+    injectPlugin(otherPlugin);
+    ie.GetAvailableDevices();
+    ASSERT_EQ(3, plugin.probesCount);
+    ASSERT_EQ(1, otherPlugin.probesCount);
+}
+
+// tested function: GetAvailableDevices, SetConfig with the lazy devices discovery
+TEST_F(CoreThreadingTests, GetAvailableDevicesLazyDiscovery) {
+    InferenceEngine::Core ie;
+    ASSERT_THROW(ie.SetConfig({{ CONFIG_KEY(LAZY_DEVICE_DISCOVERY), "ON" }}), InferenceEngine::Exception);
+    ie.SetConfig({{ CONFIG_KEY(LAZY_DEVICE_DISCOVERY), InferenceEngine::PluginConfigParams::YES }});
+
+    runParallel([&] () {
+        // no device is referenced by name, so no plugin is loaded
+        ASSERT_TRUE(ie.GetAvailableDevices().empty());
+    }, 100);
+}
+
 // tested function: ReadNetwork, AddExtension
 TEST_F(CoreThreadingTests, ReadNetwork) {
     InferenceEngine::Core ie;
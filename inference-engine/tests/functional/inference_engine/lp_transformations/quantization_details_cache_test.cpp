@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include "low_precision/quantization_details.hpp"
+
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass::low_precision;
+
+namespace {
+
+std::shared_ptr<opset1::FakeQuantize> makeFakeQuantize(const float outputHigh) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 3, 16, 16 });
+    return std::make_shared<opset1::FakeQuantize>(
+        input,
+        opset1::Constant::create(element::f32, Shape{}, { 0.f }),
+        opset1::Constant::create(element::f32, Shape{}, { 2.55f }),
+        opset1::Constant::create(element::f32, Shape{}, { 0.f }),
+        opset1::Constant::create(element::f32, Shape{}, { outputHigh }),
+        256ul);
+}
+
+}  // namespace
+
+TEST(LPT, QuantizationDetailsCacheIsReused) {
+    const auto fakeQuantize = makeFakeQuantize(2.55f);
+
+    // the details are computed without a cache scope
+    QuantizationDetails::getDetails(fakeQuantize);
+
+    QuantizationDetails::CacheScope cache;
+    const QuantizationDetails details = QuantizationDetails::getDetails(fakeQuantize);
+    ASSERT_EQ(0ul, cache.getHitsCount());
+    const QuantizationDetails cachedDetails = QuantizationDetails::getDetails(fakeQuantize);
+    ASSERT_EQ(1ul, cache.getHitsCount());
+
+    ASSERT_EQ(details.levels, cachedDetails.levels);
+    ASSERT_EQ(details.outputHighValues, cachedDetails.outputHighValues);
+    ASSERT_EQ(details.outputChannelsCount, cachedDetails.outputChannelsCount);
+}
+
+TEST(LPT, QuantizationDetailsCacheIsInvalidatedOnInputReplacement) {
+    const auto fakeQuantize = makeFakeQuantize(2.55f);
+
+    QuantizationDetails::CacheScope cache;
+    ASSERT_EQ(2.55f, QuantizationDetails::getDetails(fakeQuantize).getOutputHighValue(0));
+
+    fakeQuantize->input(4).replace_source_output(opset1::Constant::create(element::f32, Shape{}, { 1.27f }));
+    ASSERT_EQ(1.27f, QuantizationDetails::getDetails(fakeQuantize).getOutputHighValue(0));
+
+    fakeQuantize->set_levels(255ul);
+    ASSERT_EQ(255ul, QuantizationDetails::getDetails(fakeQuantize).levels);
+    ASSERT_EQ(0ul, cache.getHitsCount());
+}
+
+TEST(LPT, QuantizationDetailsCacheScopesAreNested) {
+    const auto fakeQuantize = makeFakeQuantize(2.55f);
+
+    QuantizationDetails::CacheScope outerCache;
+    QuantizationDetails::getDetails(fakeQuantize);
+    {
+        // the inner scope has own cache, so the details are computed again
+        QuantizationDetails::CacheScope innerCache;
+        QuantizationDetails::getDetails(fakeQuantize);
+        QuantizationDetails::getDetails(fakeQuantize);
+        ASSERT_EQ(1ul, innerCache.getHitsCount());
+    }
+    QuantizationDetails::getDetails(fakeQuantize);
+    ASSERT_EQ(1ul, outerCache.getHitsCount());
+}
@@ -2,12 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <future>
+#include <thread>
+#include <thread>
 
 #include <gtest/gtest.h>
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_executor_manager.hpp>
+#include <threading/ie_shared_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
 
@@ -195,6 +200,13 @@ static auto Executors = ::testing::Values(
     },
     [] {
         return std::make_shared<ImmediateExecutor>();
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        SharedStreamsExecutor executor{IStreamsExecutor::Config{"TestSharedStreamsExecutor",
+                                       streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE}};
+        return executor.CreateClient({"TestClient"});
     }
 );
 
@@ -206,8 +218,102 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        SharedStreamsExecutor executor{IStreamsExecutor::Config{"TestSharedStreamsExecutor",
+                                       streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE}};
+        return executor.CreateClient({"TestClient"});
     }
 );
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+TEST(SharedStreamsExecutorTests, startsTasksByPriorityAndRejectsAboveQueueLimit) {
+    SharedStreamsExecutor executor{IStreamsExecutor::Config{"TestSharedStreamsExecutor", 1}};
+    auto low = executor.CreateClient({"Low", 1, 0, 2});
+    auto high = executor.CreateClient({"High", 1, 1});
+
+    std::promise<void> unblock;
+    auto unblocked = unblock.get_future().share();
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::vector<Future> futures;
+    auto submit = [&](const SharedStreamsExecutor::Client::Ptr& client, const std::string& tag) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&, tag] {
+            unblocked.wait();
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(tag);
+        });
+        futures.emplace_back(p->get_future());
+        client->run([p] {(*p)();});
+    };
+
+    // the first task occupies the only stream, the rest are waiting
+    submit(low, "low");
+    for (int i = 0; i < 10 && low->GetStatistics()._executing == 0; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    submit(low, "low");
+    submit(low, "low");
+    EXPECT_THROW(submit(low, "low"), RequestBusy);
+    submit(high, "high");
+
+    unblock.set_value();
+    for (auto&& f : futures) if (f.valid()) f.wait();
+
+    ASSERT_EQ((std::vector<std::string>{"low", "high", "low", "low"}), order);
+    auto statistics = low->GetStatistics();
+    EXPECT_EQ(1, statistics._rejected);
+    EXPECT_EQ(0, statistics._waiting);
+}
+
+TEST(SharedStreamsExecutorTests, runAndWaitIsNotLimitedByQueueSize) {
+    SharedStreamsExecutor executor{IStreamsExecutor::Config{"TestSharedStreamsExecutor", 1}};
+    auto client = executor.CreateClient({"Client", 1, 0, 1});
+
+    // e.g. the graphs of a network are created in all the streams, however few requests are allowed to wait
+    std::atomic<int> executed{0};
+    std::vector<Task> tasks(4, [&] { executed++; });
+    ASSERT_NO_THROW(client->runAndWait(tasks));
+    ASSERT_EQ(4, executed);
+    ASSERT_EQ(0, client->GetStatistics()._rejected);
+}
+
+TEST(SharedStreamsExecutorTests, canReleaseLastClientFromItsTask) {
+    auto client = SharedStreamsExecutor{IStreamsExecutor::Config{"TestSharedStreamsExecutor", 1}}.CreateClient({"Client"});
+
+    // the task holds the last reference to the shared streams, they are stopped after it is completed
+    auto manager = ExecutorManager::getInstance();
+    const auto retired = manager->getRetiredCPUStreamsExecutorsNumber();
+    std::promise<void> released;
+    auto future = released.get_future();
+    client->run([&] {
+        released.set_value();
+        client.reset();
+    });
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+
+    // the stream thread can not join itself, so the manager keeps the streams until they are joined from here
+    for (int i = 0; i < 1000 && manager->getRetiredCPUStreamsExecutorsNumber() == retired; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_LT(retired, manager->getRetiredCPUStreamsExecutorsNumber());
+    manager->clear("TestSharedStreamsExecutor");
+    ASSERT_EQ(0, manager->getRetiredCPUStreamsExecutorsNumber());
+}
+
+TEST(SharedStreamsExecutorTests, completesWaitingTasksOfReleasedClients) {
+    std::atomic<int> executed{0};
+    {
+        SharedStreamsExecutor executor{IStreamsExecutor::Config{"TestSharedStreamsExecutor", 2}};
+        auto first = executor.CreateClient({"First"});
+        auto second = executor.CreateClient({"Second"});
+        for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+            first->run([&] { executed++; });
+            second->run([&] { executed++; });
+        }
+    }
+    // the clients wait for their tasks, the same as a streams executor does
+    ASSERT_EQ(2 * MAX_NUMBER_OF_TASKS_IN_QUEUE, executed);
+}
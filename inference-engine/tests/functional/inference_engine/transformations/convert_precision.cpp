@@ -217,6 +217,40 @@ TEST(TransformationTests, ConvertPrecision_ConvertElimination) {
     ASSERT_TRUE(res.first) << res.second;
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepRuntimeDecompression) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    auto createFunction = [](bool runtimeDecompression) {
+        auto input = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 16});
+        auto weights = opset4::Constant::create(element::f16, Shape{8, 16}, {1});
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        // the constant folding is disabled for other reasons as well, so only the dedicated mark keeps FP16
+        convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<VariantWrapper<std::string>>("");
+        if (runtimeDecompression)
+            convert->get_rt_info()["RUNTIME_DECOMPRESSION"] = std::make_shared<VariantWrapper<std::string>>("");
+        auto matmul = std::make_shared<opset4::MatMul>(input, convert, false, true);
+        return std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+    };
+    {
+        f = createFunction(true);
+
+        pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::f16, ngraph::element::f32 }});
+        manager.run_passes(f);
+    }
+
+    // the FP16 weights are converted by the Convert during the inference
+    f_ref = createFunction(true);
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+
+    f = createFunction(false);
+    pass::Manager manager;
+    manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::f16, ngraph::element::f32 }});
+    manager.run_passes(f);
+    ASSERT_FALSE(has_type<ngraph::element::Type_t::f16>(f));
+}
+
 TEST(TransformationTests, ConvertPrecision_TopK) {
     std::shared_ptr<Function> f(nullptr);
     {
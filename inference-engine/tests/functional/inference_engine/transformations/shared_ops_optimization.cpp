@@ -0,0 +1,185 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset7.hpp>
+#include <transformations/common_optimizations/shared_ops_optimization.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+
+using namespace testing;
+using namespace ngraph;
+
+TEST(TransformationTests, SharedOpOptimizationShapeSubGraph) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    std::shared_ptr<pass::SharedOpOptimization> shared_ops;
+
+    Shape data_shape{1, 2, 3, 4};
+    {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, data_shape);
+
+        auto shape_of_1 = std::make_shared<opset7::ShapeOf>(data);
+        auto gather_1 = std::make_shared<opset7::Gather>(shape_of_1,
+                opset7::Constant::create(element::i64, {2}, {0, 1}), opset7::Constant::create(element::i64, {}, {0}));
+
+        auto shape_of_2 = std::make_shared<opset7::ShapeOf>(data);
+        auto gather_2 = std::make_shared<opset7::Gather>(shape_of_2,
+                opset7::Constant::create(element::i64, {2}, {0, 1}), opset7::Constant::create(element::i64, {}, {0}));
+
+        auto concat = std::make_shared<opset7::Concat>(OutputVector{gather_1, gather_2}, 0);
+        auto reshape = std::make_shared<opset7::Reshape>(data, concat, false);
+        f = std::make_shared<Function>(NodeVector{reshape}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        shared_ops = m.register_pass<pass::SharedOpOptimization>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, data_shape);
+
+        auto shape_of = std::make_shared<opset7::ShapeOf>(data);
+        auto gather = std::make_shared<opset7::Gather>(shape_of,
+                opset7::Constant::create(element::i64, {2}, {0, 1}), opset7::Constant::create(element::i64, {}, {0}));
+
+        auto concat = std::make_shared<opset7::Concat>(OutputVector{gather, gather}, 0);
+        auto reshape = std::make_shared<opset7::Reshape>(data, concat, false);
+        f_ref = std::make_shared<Function>(NodeVector{reshape}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+    // ShapeOf, Gather and two Constants
+    ASSERT_EQ(shared_ops->get_removed_ops_count(), 4);
+}
+
+TEST(TransformationTests, SharedOpOptimizationDifferentAttributes) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    std::shared_ptr<pass::SharedOpOptimization> shared_ops;
+
+    auto create_function = [](bool shared_order) {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 2, 3});
+
+        auto order_1 = opset7::Constant::create(element::i64, {3}, {0, 2, 1});
+        auto order_2 = shared_order ? order_1 : opset7::Constant::create(element::i64, {3}, {0, 2, 1});
+        auto transpose_1 = std::make_shared<opset7::Transpose>(data, order_1);
+        auto transpose_2 = std::make_shared<opset7::Transpose>(data, order_2);
+        auto transpose_3 = std::make_shared<opset7::Transpose>(data, opset7::Constant::create(element::i64, {3}, {1, 0, 2}));
+
+        auto convert_1 = std::make_shared<opset7::Convert>(transpose_1, element::f16);
+        auto convert_2 = std::make_shared<opset7::Convert>(transpose_2, element::i32);
+
+        auto relu_1 = std::make_shared<opset7::Relu>(convert_1);
+        auto relu_2 = std::make_shared<opset7::Relu>(convert_2);
+        auto relu_3 = std::make_shared<opset7::Relu>(transpose_3);
+        return std::make_shared<Function>(NodeVector{relu_1, relu_2, relu_3}, ParameterVector{data});
+    };
+
+    {
+        f = create_function(false);
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        shared_ops = m.register_pass<pass::SharedOpOptimization>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        // only the equal orders and Transposes are merged, Converts have different destination types
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 2, 3});
+
+        auto order = opset7::Constant::create(element::i64, {3}, {0, 2, 1});
+        auto transpose = std::make_shared<opset7::Transpose>(data, order);
+        auto transpose_3 = std::make_shared<opset7::Transpose>(data, opset7::Constant::create(element::i64, {3}, {1, 0, 2}));
+
+        auto convert_1 = std::make_shared<opset7::Convert>(transpose, element::f16);
+        auto convert_2 = std::make_shared<opset7::Convert>(transpose, element::i32);
+
+        auto relu_1 = std::make_shared<opset7::Relu>(convert_1);
+        auto relu_2 = std::make_shared<opset7::Relu>(convert_2);
+        auto relu_3 = std::make_shared<opset7::Relu>(transpose_3);
+        f_ref = std::make_shared<Function>(NodeVector{relu_1, relu_2, relu_3}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(shared_ops->get_removed_ops_count(), 2);
+}
+
+TEST(TransformationTests, SharedOpOptimizationKeepsOutputs) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    std::shared_ptr<pass::SharedOpOptimization> shared_ops;
+
+    auto create_function = []() {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 2, 3});
+        auto relu_1 = std::make_shared<opset7::Relu>(data);
+        auto relu_2 = std::make_shared<opset7::Relu>(data);
+        return std::make_shared<Function>(NodeVector{relu_1, relu_2}, ParameterVector{data});
+    };
+
+    {
+        f = create_function();
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        shared_ops = m.register_pass<pass::SharedOpOptimization>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(shared_ops->get_removed_ops_count(), 0);
+}
+
+TEST(TransformationTests, SharedOpOptimizationDifferentRuntimeAttributes) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    std::shared_ptr<pass::SharedOpOptimization> shared_ops;
+
+    auto create_relu = [](const Output<Node>& data, const std::string& priority) {
+        auto relu = std::make_shared<opset7::Relu>(data);
+        relu->get_rt_info()[VariantWrapper<PrimitivesPriority>::type_info.name] =
+            std::make_shared<VariantWrapper<PrimitivesPriority>>(PrimitivesPriority(priority));
+        return relu;
+    };
+
+    {
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 2, 3});
+        auto relu_1 = create_relu(data, "cpu:ref_any");
+        auto relu_2 = create_relu(data, "cpu:jit_avx2");
+        auto relu_3 = create_relu(data, "cpu:jit_avx2");
+        auto concat = std::make_shared<opset7::Concat>(OutputVector{relu_1, relu_2, relu_3}, 0);
+        f = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        shared_ops = m.register_pass<pass::SharedOpOptimization>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        // only the Relus with the same primitives priority are merged
+        auto data = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 2, 3});
+        auto relu_1 = create_relu(data, "cpu:ref_any");
+        auto relu_2 = create_relu(data, "cpu:jit_avx2");
+        auto concat = std::make_shared<opset7::Concat>(OutputVector{relu_1, relu_2, relu_2}, 0);
+        f_ref = std::make_shared<Function>(NodeVector{concat}, ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(shared_ops->get_removed_ops_count(), 1);
+    auto concat = f->get_results()[0]->get_input_node_shared_ptr(0);
+    ASSERT_EQ(getPrimitivesPriority(concat->get_input_node_shared_ptr(0)), "cpu:ref_any");
+    ASSERT_EQ(getPrimitivesPriority(concat->get_input_node_shared_ptr(1)), "cpu:jit_avx2");
+}
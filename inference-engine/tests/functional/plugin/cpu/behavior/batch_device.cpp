@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+const std::string batchDevice = std::string{CommonTestUtils::DEVICE_BATCH} + ":" + CommonTestUtils::DEVICE_CPU + "(2)";
+
+class BatchDeviceTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        network = CNNNetwork{ngraph::builder::subgraph::makeSplitConvConcat()};
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        reference = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    }
+
+    void CheckResult(InferRequest& request, const Blob::Ptr& input) {
+        reference.SetBlob(inputName, input);
+        reference.Infer();
+        FuncTestUtils::compareBlobs(request.GetBlob(outputName), reference.GetBlob(outputName), 1e-4f);
+    }
+
+    // runs the request synchronously and returns the time it took in milliseconds
+    static double MeasureInfer(InferRequest& request) {
+        const auto start = std::chrono::steady_clock::now();
+        request.Infer();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    Core ie;
+    CNNNetwork network;
+    std::string inputName;
+    std::string outputName;
+    InferRequest reference;
+};
+
+TEST_F(BatchDeviceTests, executesFullBatchOnce) {
+    auto execNet = ie.LoadNetwork(network, batchDevice, {{BATCH_CONFIG_KEY(TIMEOUT), "10000"}});
+    auto request0 = execNet.CreateInferRequest();
+    auto request1 = execNet.CreateInferRequest();
+
+    // the first request gets own blob, so it is copied to the batch, the second one writes to the batch directly
+    auto input0 = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc());
+    auto input1 = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc(), 20, -10, 3);
+    request0.SetBlob(inputName, input0);
+    blob_copy(input1, request1.GetBlob(inputName));
+
+    request0.StartAsync();
+    request1.StartAsync();
+    ASSERT_EQ(StatusCode::OK, request0.Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(StatusCode::OK, request1.Wait(InferRequest::WaitMode::RESULT_READY));
+
+    CheckResult(request0, input0);
+    CheckResult(request1, input1);
+    ASSERT_EQ(1u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_BATCHES)).as<unsigned int>());
+    ASSERT_EQ(0u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_TIMED_OUT_BATCHES)).as<unsigned int>());
+    ASSERT_EQ(1u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_COPIED_INFER_REQUESTS)).as<unsigned int>());
+    ASSERT_FLOAT_EQ(2.f, execNet.GetMetric(METRIC_KEY(BATCH_AVERAGE_SIZE)).as<float>());
+}
+
+TEST_F(BatchDeviceTests, executesRequestWithoutBatchAfterTimeout) {
+    auto execNet = ie.LoadNetwork(network, batchDevice, {{BATCH_CONFIG_KEY(TIMEOUT), "10"}});
+    auto request0 = execNet.CreateInferRequest();
+    auto request1 = execNet.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc());
+    blob_copy(input, request1.GetBlob(inputName));
+
+    request1.Infer();
+
+    CheckResult(request1, input);
+    ASSERT_EQ(0u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_BATCHES)).as<unsigned int>());
+    ASSERT_EQ(1u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_TIMED_OUT_BATCHES)).as<unsigned int>());
+    ASSERT_FLOAT_EQ(1.f, execNet.GetMetric(METRIC_KEY(BATCH_AVERAGE_SIZE)).as<float>());
+}
+
+TEST_F(BatchDeviceTests, executesLoneRequestWithoutWaitingForTimeout) {
+    auto execNet = ie.LoadNetwork(network, batchDevice, {{BATCH_CONFIG_KEY(TIMEOUT), "10000"}});
+    auto request = execNet.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc());
+    blob_copy(input, request.GetBlob(inputName));
+
+    // the only request can not fill the batch of two, so it is executed at once rather than after the timeout
+    const double latency = MeasureInfer(request);
+    std::cout << "Lone request latency: " << latency << " ms" << std::endl;
+
+    CheckResult(request, input);
+    ASSERT_LT(latency, 1000.);
+    ASSERT_EQ(0u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_BATCHES)).as<unsigned int>());
+    ASSERT_EQ(0u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_TIMED_OUT_BATCHES)).as<unsigned int>());
+    ASSERT_FLOAT_EQ(1.f, execNet.GetMetric(METRIC_KEY(BATCH_AVERAGE_SIZE)).as<float>());
+}
+
+TEST_F(BatchDeviceTests, executesCollectedRequestWhenAnotherOneIsReleased) {
+    auto execNet = ie.LoadNetwork(network, batchDevice, {{BATCH_CONFIG_KEY(TIMEOUT), "10000"}});
+    auto request0 = execNet.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc());
+    blob_copy(input, request0.GetBlob(inputName));
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        auto request1 = execNet.CreateInferRequest();
+        request0.StartAsync();
+    }
+    ASSERT_EQ(StatusCode::OK, request0.Wait(InferRequest::WaitMode::RESULT_READY));
+    const double latency = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    CheckResult(request0, input);
+    ASSERT_LT(latency, 1000.);
+    ASSERT_EQ(0u, execNet.GetMetric(METRIC_KEY(NUMBER_OF_TIMED_OUT_BATCHES)).as<unsigned int>());
+}
+
+TEST_F(BatchDeviceTests, loneRequestLatencyWithDefaultConfigIsCloseToDevice) {
+    auto execNet = ie.LoadNetwork(network, batchDevice);
+    auto request = execNet.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().at(inputName)->getTensorDesc());
+    blob_copy(input, request.GetBlob(inputName));
+    reference.SetBlob(inputName, input);
+    MeasureInfer(request);
+    MeasureInfer(reference);
+
+    double latency = 0., referenceLatency = 0.;
+    const int iterations = 10;
+    for (int i = 0; i < iterations; i++) {
+        latency += MeasureInfer(request) / iterations;
+        referenceLatency += MeasureInfer(reference) / iterations;
+    }
+    std::cout << "Lone request latency: " << latency << " ms, device latency: " << referenceLatency << " ms" << std::endl;
+
+    // the default timeout is not added to every inference of the lone request
+    ASSERT_LT(latency, 2 * referenceLatency + 5.);
+}
+
+TEST_F(BatchDeviceTests, throwsWithoutBatchSize) {
+    ASSERT_THROW(ie.LoadNetwork(network, std::string{CommonTestUtils::DEVICE_BATCH} + ":" + CommonTestUtils::DEVICE_CPU),
+                 Exception);
+}
+}  // namespace
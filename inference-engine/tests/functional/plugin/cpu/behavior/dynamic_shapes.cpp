@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+class DynamicShapesTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        network = CNNNetwork{ngraph::builder::subgraph::makeSplitConvConcat()};
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+    }
+
+    // infers the network reshaped to the input dimensions and loaded from scratch
+    Blob::Ptr InferReshaped(const Blob::Ptr& input) {
+        CNNNetwork reshaped{ngraph::clone_function(*network.getFunction())};
+        reshaped.reshape({{inputName, input->getTensorDesc().getDims()}});
+        auto request = ie.LoadNetwork(reshaped, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+        request.SetBlob(inputName, input);
+        request.Infer();
+        return request.GetBlob(outputName);
+    }
+
+    Core ie;
+    CNNNetwork network;
+    std::string inputName;
+    std::string outputName;
+};
+
+TEST_F(DynamicShapesTests, infersInputsOfOtherShapes) {
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "2"}});
+    auto request = execNet.CreateInferRequest();
+
+    // the third size evicts the first one from the cache, so it is compiled again
+    for (size_t size : {16, 24, 12, 16, 20}) {
+        auto input = FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {1, 4, size, size}, Layout::NCHW});
+        request.SetBlob(inputName, input);
+        ASSERT_NO_THROW(request.Infer());
+
+        auto reference = InferReshaped(input);
+        auto output = request.GetBlob(outputName);
+        ASSERT_EQ(reference->getTensorDesc().getDims(), output->getTensorDesc().getDims());
+        FuncTestUtils::compareBlobs(output, reference, 1e-4f);
+    }
+}
+
+TEST_F(DynamicShapesTests, keepsEvictedGraphOfRequest) {
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "1"},
+                                   {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+    auto otherRequest = execNet.CreateInferRequest();
+
+    auto input = FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {1, 4, 16, 16}, Layout::NCHW});
+    auto otherInput = FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {1, 4, 24, 24}, Layout::NCHW});
+    request.SetBlob(inputName, input);
+    otherRequest.SetBlob(inputName, otherInput);
+
+    // each inference evicts the graph the other request inferred with
+    for (size_t i = 0; i < 2; i++) {
+        ASSERT_NO_THROW(request.Infer());
+        ASSERT_NO_THROW(otherRequest.Infer());
+
+        ASSERT_NO_THROW(request.GetPerformanceCounts());
+        ASSERT_NO_THROW(otherRequest.GetPerformanceCounts());
+        Blob::Ptr output;
+        ASSERT_NO_THROW(output = request.GetBlob(outputName));
+        FuncTestUtils::compareBlobs(output, InferReshaped(input), 1e-4f);
+        ASSERT_NO_THROW(output = otherRequest.GetBlob(outputName));
+        FuncTestUtils::compareBlobs(output, InferReshaped(otherInput), 1e-4f);
+        ASSERT_NO_THROW(request.GetBlob(inputName));
+    }
+}
+
+TEST_F(DynamicShapesTests, transformsShapesOnceForAllStreams) {
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "4"},
+                                   {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}});
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 4; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+    }
+
+    auto input = FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {1, 4, 16, 16}, Layout::NCHW});
+    for (size_t i = 0; i < 2; i++) {
+        for (auto& request : requests) {
+            request.SetBlob(inputName, input);
+            request.StartAsync();
+        }
+        for (auto& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+        }
+    }
+
+    const auto reference = InferReshaped(input);
+    for (auto& request : requests) {
+        FuncTestUtils::compareBlobs(request.GetBlob(outputName), reference, 1e-4f);
+    }
+    // every stream creates own graph from the only transformed network
+    const auto statistics = execNet.GetMetric(METRIC_KEY(CPU_DYNAMIC_SHAPES_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(1u, statistics.at("NETWORKS"));
+    ASSERT_GE(2u, statistics.at("GRAPHS"));
+    ASSERT_EQ(2 * requests.size(), statistics.at("GRAPHS") + statistics.at("HITS"));
+}
+
+// Prints the latencies of the first and the repeated inferences of every sequence length compared with reshaping
+// and loading the network for the length
+TEST_F(DynamicShapesTests, sequenceLengthSweep) {
+    const size_t hidden = 256;
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 8, hidden}});
+    auto weights0 = ngraph::builder::makeConstant<float>(ngraph::element::f32, {hidden, hidden}, {}, true, 0.1f, -0.1f);
+    auto weights1 = ngraph::builder::makeConstant<float>(ngraph::element::f32, {hidden, hidden}, {}, true, 0.1f, -0.1f);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(ngraph::builder::makeMatMul(params[0], weights0));
+    auto matMul = ngraph::builder::makeMatMul(relu, weights1);
+    CNNNetwork sequenceNetwork{std::make_shared<ngraph::Function>(matMul, params, "SequenceLengthSweep")};
+    const auto sequenceInput = sequenceNetwork.getInputsInfo().begin()->first;
+
+    const std::vector<size_t> lengths = {16, 32, 64, 96, 128, 192, 256, 384, 512};
+    auto execNet = ie.LoadNetwork(sequenceNetwork, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, std::to_string(lengths.size())}});
+    auto request = execNet.CreateInferRequest();
+
+    auto measure = [] (const std::function<void()>& action) {
+        const auto start = std::chrono::steady_clock::now();
+        action();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double totalFirst = 0, totalRepeated = 0;
+    std::cout << "length\treload, ms\tfirst, ms\trepeated, ms" << std::endl;
+    for (size_t length : lengths) {
+        auto input = FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {1, length, hidden}, Layout::CHW});
+        const double reload = measure([&] {
+            CNNNetwork reshaped{ngraph::clone_function(*sequenceNetwork.getFunction())};
+            reshaped.reshape({{sequenceInput, input->getTensorDesc().getDims()}});
+            auto reshapedRequest = ie.LoadNetwork(reshaped, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+            reshapedRequest.SetBlob(sequenceInput, input);
+            reshapedRequest.Infer();
+        });
+        request.SetBlob(sequenceInput, input);
+        const double first = measure([&] { request.Infer(); });
+        const double repeated = measure([&] { request.Infer(); });
+        std::cout << length << "\t" << reload << "\t" << first << "\t" << repeated << std::endl;
+        totalFirst += first;
+        totalRepeated += repeated;
+    }
+
+    // the second sweep reuses the cached graphs
+    for (size_t length : lengths) {
+        request.SetBlob(sequenceInput, FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {1, length, hidden}, Layout::CHW}));
+        request.Infer();
+    }
+    const auto statistics = execNet.GetMetric(METRIC_KEY(CPU_DYNAMIC_SHAPES_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(lengths.size(), statistics.at("NETWORKS"));
+    ASSERT_EQ(lengths.size(), statistics.at("GRAPHS"));
+    ASSERT_EQ(2 * lengths.size(), statistics.at("HITS"));
+    ASSERT_LT(totalRepeated, totalFirst);
+}
+
+TEST_F(DynamicShapesTests, throwsOnRankMismatch) {
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, "1"}});
+    auto request = execNet.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {4, 20, 20}, Layout::CHW});
+    ASSERT_THROW(request.SetBlob(inputName, input), Exception);
+}
+
+TEST_F(DynamicShapesTests, throwsOnOtherShapesByDefault) {
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(TensorDesc{Precision::FP32, {1, 4, 16, 16}, Layout::NCHW});
+    ASSERT_THROW(request.SetBlob(inputName, input), Exception);
+}
+}  // namespace
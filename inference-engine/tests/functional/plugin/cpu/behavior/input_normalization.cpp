@@ -0,0 +1,144 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+const size_t C = 3;
+const size_t H = 7;
+const size_t W = 9;
+
+// mean values and non power of two scales, so the normalized values are not exact
+const std::vector<float> meanValues = {103.94f, 116.78f, 123.68f};
+const std::vector<float> stdScales = {58.395f, 57.12f, 3.f};
+
+using InputNormalizationParams = std::tuple<MeanVariant, Layout>;
+
+/* The U8 input is converted to FP32 and normalized by the plugin, in one pass when the graph input has
+   the layout of the user blob. The reference network gets the FP32 input normalized by the test.
+ */
+class InputNormalizationTests : public ::testing::TestWithParam<InputNormalizationParams> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<InputNormalizationParams>& obj) {
+        MeanVariant meanVariant;
+        Layout layout;
+        std::tie(meanVariant, layout) = obj.param;
+        std::ostringstream result;
+        result << (meanVariant == MEAN_VALUE ? "MEAN_VALUE" : "MEAN_IMAGE") << "_" << layout;
+        return result.str();
+    }
+
+protected:
+    // the per channel multiplier keeps the negative normalized values in the output
+    static CNNNetwork MakeNetwork() {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, C, H, W});
+        auto multiplier = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, C, 1, 1}, {2.f, -1.f, 0.5f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(param, multiplier);
+        return CNNNetwork{std::make_shared<ngraph::Function>(std::make_shared<ngraph::opset1::Result>(multiply),
+                                                             ngraph::ParameterVector{param}, "InputNormalization")};
+    }
+
+    static float MeanImage(size_t c, size_t h, size_t w) {
+        return static_cast<float>((c * H * W + h * W + w) % 50) + 0.25f;
+    }
+
+    static uint8_t Input(size_t c, size_t h, size_t w) {
+        return static_cast<uint8_t>((c * H * W + h * W + w) * 37 % 256);
+    }
+
+    // the offset of the element in the blob of the given layout
+    static size_t Offset(Layout layout, size_t c, size_t h, size_t w) {
+        return layout == NHWC ? (h * W + w) * C + c : (c * H + h) * W + w;
+    }
+
+    void SetPreProcess(InputInfo& inputInfo, MeanVariant meanVariant) {
+        auto& preProcess = inputInfo.getPreProcess();
+        preProcess.init(C);
+        for (size_t c = 0; c < C; c++) {
+            if (meanVariant == MEAN_VALUE) {
+                preProcess[c]->meanValue = meanValues[c];
+                preProcess[c]->stdScale = stdScales[c];
+            } else {
+                auto meanData = make_shared_blob<float>(TensorDesc(Precision::FP32, {H, W}, Layout::HW));
+                meanData->allocate();
+                auto data = meanData->buffer().as<float*>();
+                for (size_t h = 0; h < H; h++)
+                    for (size_t w = 0; w < W; w++)
+                        data[h * W + w] = MeanImage(c, h, w);
+                preProcess.setMeanImageForChannel(meanData, c);
+            }
+        }
+        preProcess.setVariant(meanVariant);
+    }
+
+    Core ie;
+};
+
+TEST_P(InputNormalizationTests, U8InputMatchesUnfusedReference) {
+    MeanVariant meanVariant;
+    Layout layout;
+    std::tie(meanVariant, layout) = GetParam();
+
+    auto network = MakeNetwork();
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(layout);
+    SetPreProcess(*inputInfo, meanVariant);
+
+    auto reference = MakeNetwork();
+    auto referenceInfo = reference.getInputsInfo().begin()->second;
+    referenceInfo->setPrecision(Precision::FP32);
+    referenceInfo->setLayout(layout);
+
+    auto input = make_shared_blob<uint8_t>(inputInfo->getTensorDesc());
+    auto referenceInput = make_shared_blob<float>(referenceInfo->getTensorDesc());
+    input->allocate();
+    referenceInput->allocate();
+    auto inputData = input->buffer().as<uint8_t*>();
+    auto referenceData = referenceInput->buffer().as<float*>();
+    for (size_t c = 0; c < C; c++) {
+        for (size_t h = 0; h < H; h++) {
+            for (size_t w = 0; w < W; w++) {
+                // the mean image is subtracted in the memory order of the blob, the same as in the unfused path
+                const auto offset = Offset(layout, c, h, w);
+                const auto value = Input(c, h, w);
+                inputData[offset] = value;
+                referenceData[offset] = meanVariant == MEAN_VALUE
+                    ? (static_cast<float>(value) - meanValues[c]) / stdScales[c]
+                    : static_cast<float>(value) - MeanImage(offset / (H * W), offset / W % H, offset % W);
+            }
+        }
+    }
+
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    request.SetBlob(network.getInputsInfo().begin()->first, input);
+    request.Infer();
+
+    auto referenceRequest = ie.LoadNetwork(reference, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    referenceRequest.SetBlob(reference.getInputsInfo().begin()->first, referenceInput);
+    referenceRequest.Infer();
+
+    const auto& output = network.getOutputsInfo().begin()->first;
+    FuncTestUtils::compareBlobs(request.GetBlob(output), referenceRequest.GetBlob(output), 1e-6f);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_InputNormalization, InputNormalizationTests,
+                        ::testing::Combine(
+                            ::testing::Values(MEAN_VALUE, MEAN_IMAGE),
+                            ::testing::Values(Layout::NCHW, Layout::NHWC)),
+                        InputNormalizationTests::getTestCaseName);
+}  // namespace
@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+class MemoryPlanTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        network = CNNNetwork{ngraph::builder::subgraph::makeSplitConvConcat()};
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+    }
+
+    Blob::Ptr Infer(ExecutableNetwork& execNet) {
+        auto request = execNet.CreateInferRequest();
+        request.SetBlob(inputName, input);
+        request.Infer();
+        return request.GetBlob(outputName);
+    }
+
+    static std::map<std::string, uint64_t> GetMemoryPlan(const ExecutableNetwork& execNet) {
+        return execNet.GetMetric(METRIC_KEY(CPU_MEMORY_PLAN)).as<std::map<std::string, uint64_t>>();
+    }
+
+    Core ie;
+    CNNNetwork network;
+    std::string inputName;
+    std::string outputName;
+    Blob::Ptr input;
+};
+
+TEST_F(MemoryPlanTests, planIsBetweenLowerBoundAndNaiveSize) {
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto plan = GetMemoryPlan(execNet);
+    ASSERT_GT(plan["LOWER_BOUND_BYTES"], 0u);
+    ASSERT_LE(plan["LOWER_BOUND_BYTES"], plan["PLANNED_BYTES"]);
+    ASSERT_LE(plan["PLANNED_BYTES"], plan["NAIVE_BYTES"]);
+}
+
+TEST_F(MemoryPlanTests, infersWithPageAlignment) {
+    auto referenceExecNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_MEMORY_ALIGNMENT, "4096"}});
+    ASSERT_EQ("4096", execNet.GetConfig(PluginConfigParams::KEY_CPU_MEMORY_ALIGNMENT).as<std::string>());
+    FuncTestUtils::compareBlobs(Infer(execNet), Infer(referenceExecNet), 1e-4f);
+
+    // every activation occupies whole pages
+    auto plan = GetMemoryPlan(execNet);
+    ASSERT_EQ(0u, plan["PLANNED_BYTES"] % 4096);
+    ASSERT_LE(plan["LOWER_BOUND_BYTES"], plan["PLANNED_BYTES"]);
+    ASSERT_LE(plan["PLANNED_BYTES"], plan["NAIVE_BYTES"]);
+    ASSERT_GE(plan["PLANNED_BYTES"], GetMemoryPlan(referenceExecNet)["PLANNED_BYTES"]);
+}
+}  // namespace
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+class ResultCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        network = CNNNetwork{ngraph::builder::subgraph::makeSplitConvConcat()};
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        inputDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+    }
+
+    std::map<std::string, uint64_t> GetStatistics(const ExecutableNetwork& execNet) {
+        return execNet.GetMetric(METRIC_KEY(CPU_RESULT_CACHE_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    }
+
+    Core ie;
+    CNNNetwork network;
+    std::string inputName;
+    std::string outputName;
+    TensorDesc inputDesc;
+};
+
+TEST_F(ResultCacheTests, reusesOutputsOfSameInputs) {
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_RESULT_CACHE_SIZE, "16"}});
+    auto referenceRequest = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto request = execNet.CreateInferRequest();
+    auto otherRequest = execNet.CreateInferRequest();
+
+    auto input = FuncTestUtils::createAndFillBlob(inputDesc, 10, 0);
+    auto otherInput = FuncTestUtils::createAndFillBlob(inputDesc, 10, 1);
+    referenceRequest.SetBlob(inputName, input);
+    referenceRequest.Infer();
+
+    request.SetBlob(inputName, input);
+    request.Infer();
+    // the outputs cached by one request are reused by the others
+    otherRequest.SetBlob(inputName, input);
+    otherRequest.Infer();
+    FuncTestUtils::compareBlobs(otherRequest.GetBlob(outputName), referenceRequest.GetBlob(outputName));
+
+    request.SetBlob(inputName, otherInput);
+    request.Infer();
+    referenceRequest.SetBlob(inputName, otherInput);
+    referenceRequest.Infer();
+    FuncTestUtils::compareBlobs(request.GetBlob(outputName), referenceRequest.GetBlob(outputName));
+
+    auto statistics = GetStatistics(execNet);
+    ASSERT_EQ(1u, statistics["HITS"]);
+    ASSERT_EQ(2u, statistics["MISSES"]);
+    ASSERT_EQ(2u, statistics["ENTRIES"]);
+    ASSERT_EQ(0u, statistics["EVICTIONS"]);
+}
+
+TEST_F(ResultCacheTests, isDisabledByDefault) {
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_THROW(GetStatistics(execNet), Exception);
+}
+}  // namespace
@@ -0,0 +1,198 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset6.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+class SharedWorkspaceTests : public ::testing::Test {
+protected:
+    // the activations of both networks are much bigger than the page the shared memory is committed by
+    void SetUp() override {
+        networks.emplace_back(ngraph::builder::subgraph::makeSplitConvConcat({1, 4, 64, 64}));
+        networks.emplace_back(ngraph::builder::subgraph::makeConvPoolRelu({1, 1, 128, 128}));
+    }
+
+    std::map<std::string, std::string> WorkspaceConfig(const std::string& streams) {
+        return {{PluginConfigParams::KEY_CPU_SHARED_STREAMS, PluginConfigParams::YES},
+                {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams},
+                {PluginConfigParams::KEY_CPU_SHARED_WORKSPACE, ::testing::UnitTest::GetInstance()->current_test_info()->name()}};
+    }
+
+    std::map<std::string, uint64_t> GetStatistics(const ExecutableNetwork& execNet) {
+        return execNet.GetMetric(METRIC_KEY(CPU_SHARED_WORKSPACE_STATISTICS)).as<std::map<std::string, uint64_t>>();
+    }
+
+    static Blob::Ptr MakeInput(const CNNNetwork& network, int32_t seed) {
+        return FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc(), 10, seed);
+    }
+
+    // infers the network loaded with own memory
+    Blob::Ptr InferReference(const CNNNetwork& network, const Blob::Ptr& input) {
+        auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+        request.SetBlob(network.getInputsInfo().begin()->first, input);
+        request.Infer();
+        return request.GetBlob(network.getOutputsInfo().begin()->first);
+    }
+
+    // infers the request and compares the outputs with the reference ones
+    static void InferAndCompare(InferRequest& request, const CNNNetwork& network, const Blob::Ptr& input,
+                                const Blob::Ptr& reference) {
+        request.SetBlob(network.getInputsInfo().begin()->first, input);
+        request.Infer();
+        FuncTestUtils::compareBlobs(request.GetBlob(network.getOutputsInfo().begin()->first), reference, 1e-4f);
+    }
+
+    Core ie;
+    std::vector<CNNNetwork> networks;
+};
+
+TEST_F(SharedWorkspaceTests, infersNetworksInterleaved) {
+    std::vector<ExecutableNetwork> execNets;
+    std::vector<InferRequest> requests;
+    std::vector<std::vector<Blob::Ptr>> inputs(networks.size()), references(networks.size());
+    for (size_t n = 0; n < networks.size(); n++) {
+        execNets.push_back(ie.LoadNetwork(networks[n], CommonTestUtils::DEVICE_CPU, WorkspaceConfig("1")));
+        requests.push_back(execNets.back().CreateInferRequest());
+        for (int32_t seed = 0; seed < 2; seed++) {
+            inputs[n].push_back(MakeInput(networks[n], seed));
+            references[n].push_back(InferReference(networks[n], inputs[n].back()));
+        }
+    }
+
+    // every inference overwrites the activations of the other network
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t n = 0; n < networks.size(); n++) {
+            InferAndCompare(requests[n], networks[n], inputs[n][i % 2], references[n][i % 2]);
+        }
+    }
+
+    // both networks report the same workspace, it is as big as the biggest graph
+    auto statistics = GetStatistics(execNets[0]);
+    ASSERT_EQ(statistics, GetStatistics(execNets[1]));
+    ASSERT_EQ(networks.size(), statistics["GRAPHS"]);
+    ASSERT_GT(statistics["ALLOCATED_BYTES"], 0u);
+    ASSERT_LT(statistics["ALLOCATED_BYTES"], statistics["REQUIRED_BYTES"]);
+}
+
+TEST_F(SharedWorkspaceTests, infersNetworksConcurrently) {
+    std::vector<ExecutableNetwork> execNets;
+    std::vector<Blob::Ptr> inputs, references;
+    for (size_t n = 0; n < networks.size(); n++) {
+        execNets.push_back(ie.LoadNetwork(networks[n], CommonTestUtils::DEVICE_CPU, WorkspaceConfig("2")));
+        inputs.push_back(MakeInput(networks[n], static_cast<int32_t>(n)));
+        references.push_back(InferReference(networks[n], inputs.back()));
+    }
+
+    // the threads infer both networks through own requests, so the inferences on one stream are serialized
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(4);
+    for (size_t t = 0; t < exceptions.size(); t++) {
+        threads.emplace_back([&, t] {
+            try {
+                std::vector<InferRequest> requests;
+                for (auto& execNet : execNets) {
+                    requests.push_back(execNet.CreateInferRequest());
+                }
+                for (size_t i = 0; i < 8; i++) {
+                    const auto n = (t + i) % networks.size();
+                    InferAndCompare(requests[n], networks[n], inputs[n], references[n]);
+                }
+            } catch (...) {
+                exceptions[t] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+    auto statistics = GetStatistics(execNets[0]);
+    ASSERT_LE(statistics["ALLOCATED_BYTES"], statistics["REQUIRED_BYTES"]);
+}
+
+TEST_F(SharedWorkspaceTests, keepsStateOfNetworkInOwnMemory) {
+    // the output is the sum of all the inputs inferred so far
+    auto param = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4, 64, 64});
+    auto init = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4, 64, 64}, {0});
+    auto variable = std::make_shared<ngraph::Variable>(
+        ngraph::VariableInfo{ngraph::PartialShape{1, 4, 64, 64}, ngraph::element::f32, "state"});
+    auto readValue = std::make_shared<ngraph::opset6::ReadValue>(init, variable);
+    auto add = std::make_shared<ngraph::opset6::Add>(readValue, param);
+    auto assign = std::make_shared<ngraph::opset6::Assign>(add, variable);
+    auto result = std::make_shared<ngraph::opset6::Result>(add);
+    CNNNetwork stateful{std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::SinkVector{assign},
+                                                           ngraph::ParameterVector{param}, "Stateful")};
+
+    auto execNet = ie.LoadNetwork(stateful, CommonTestUtils::DEVICE_CPU, WorkspaceConfig("1"));
+    auto otherExecNet = ie.LoadNetwork(networks[0], CommonTestUtils::DEVICE_CPU, WorkspaceConfig("1"));
+    auto request = execNet.CreateInferRequest();
+    auto otherRequest = otherExecNet.CreateInferRequest();
+    auto referenceRequest = ie.LoadNetwork(stateful, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+
+    auto input = MakeInput(stateful, 1);
+    auto otherInput = MakeInput(networks[0], 0);
+    auto otherReference = InferReference(networks[0], otherInput);
+    for (size_t i = 0; i < 3; i++) {
+        referenceRequest.SetBlob(stateful.getInputsInfo().begin()->first, input);
+        referenceRequest.Infer();
+        InferAndCompare(request, stateful, input, referenceRequest.GetBlob(stateful.getOutputsInfo().begin()->first));
+        InferAndCompare(otherRequest, networks[0], otherInput, otherReference);
+    }
+
+    // only the network without state is placed in the shared memory
+    ASSERT_EQ(1u, GetStatistics(execNet)["GRAPHS"]);
+}
+
+TEST_F(SharedWorkspaceTests, keepsConstantOutputsInOwnMemory) {
+    // the second output is computed once on load, it is smaller than the first one
+    auto param = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4, 64, 64});
+    auto relu = std::make_shared<ngraph::opset6::Relu>(param);
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4, 8, 8},
+                                                     std::vector<float>(4 * 8 * 8, 2.f));
+    auto constRelu = std::make_shared<ngraph::opset6::Relu>(constant);
+    CNNNetwork network{std::make_shared<ngraph::Function>(
+        ngraph::ResultVector{std::make_shared<ngraph::opset6::Result>(relu), std::make_shared<ngraph::opset6::Result>(constRelu)},
+        ngraph::ParameterVector{param}, "ConstantOutput")};
+
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, WorkspaceConfig("1"));
+    auto otherExecNet = ie.LoadNetwork(networks[0], CommonTestUtils::DEVICE_CPU, WorkspaceConfig("1"));
+    auto request = execNet.CreateInferRequest();
+    auto otherRequest = otherExecNet.CreateInferRequest();
+    auto otherInput = MakeInput(networks[0], 0);
+    auto otherReference = InferReference(networks[0], otherInput);
+
+    auto input = MakeInput(network, 0);
+    request.SetBlob(network.getInputsInfo().begin()->first, input);
+    for (size_t i = 0; i < 2; i++) {
+        InferAndCompare(otherRequest, networks[0], otherInput, otherReference);
+        request.Infer();
+        for (const auto& output : network.getOutputsInfo()) {
+            auto blob = as<MemoryBlob>(request.GetBlob(output.first));
+            auto data = blob->rmap().as<const float*>();
+            auto inputData = as<MemoryBlob>(input)->rmap().as<const float*>();
+            const bool isConstant = blob->size() != input->size();
+            for (size_t j = 0; j < blob->size(); j++) {
+                ASSERT_EQ(isConstant ? 2.f : std::max(0.f, inputData[j]), data[j]) << output.first << "[" << j << "]";
+            }
+        }
+    }
+}
+}  // namespace
@@ -0,0 +1,119 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+// The weights of a single token step of a language model: the inner product is bound by the weights memory traffic,
+// and the weights do not fit in the caches
+const size_t K = 4096;
+const size_t O = 8192;
+
+class WeightsDecompressionPerfTests : public ::testing::Test {
+protected:
+    static CNNNetwork MakeNetwork(const ngraph::element::Type& weightsPrecision) {
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, K}});
+        std::shared_ptr<ngraph::Node> weights;
+        if (weightsPrecision == ngraph::element::f32) {
+            weights = ngraph::builder::makeConstant<float>(weightsPrecision, {O, K}, {}, true, 0.1f, -0.1f);
+        } else if (weightsPrecision == ngraph::element::f16) {
+            weights = ngraph::builder::makeConstant<float>(weightsPrecision, {O, K}, {}, true, 0.1f, -0.1f);
+            weights = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        } else {
+            weights = ngraph::builder::makeConstant<float>(weightsPrecision, {O, K}, {}, true, 100.f, 0.f);
+            weights = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+            auto zeroPoints = ngraph::builder::makeConstant<float>(ngraph::element::f32, {O, 1}, {}, true, 60.f, 40.f);
+            weights = std::make_shared<ngraph::opset1::Subtract>(weights, zeroPoints);
+            auto scales = ngraph::builder::makeConstant<float>(ngraph::element::f32, {O, 1}, {}, true, 0.002f, 0.001f);
+            weights = std::make_shared<ngraph::opset1::Multiply>(weights, scales);
+        }
+        auto matMul = ngraph::builder::makeMatMul(params[0], weights, false, true);
+        return CNNNetwork{std::make_shared<ngraph::Function>(matMul, params, "WeightsDecompressionPerf")};
+    }
+
+    struct Measurement {
+        double latency;     // median latency of the synchronous inferences, ms
+        int64_t memory;     // growth of the resident memory by the loading of the network, bytes
+    };
+
+    static int64_t ResidentMemory() {
+#ifdef __linux__
+        size_t size = 0, resident = 0;
+        std::ifstream("/proc/self/statm") >> size >> resident;
+        return static_cast<int64_t>(resident) * sysconf(_SC_PAGESIZE);
+#else
+        return 0;
+#endif
+    }
+
+    Measurement Measure(const CNNNetwork& network, const std::map<std::string, std::string>& config = {}) {
+        Measurement result;
+        const int64_t memoryBefore = ResidentMemory();
+        auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+        result.memory = ResidentMemory() - memoryBefore;
+
+        auto request = execNet.CreateInferRequest();
+        request.SetBlob(network.getInputsInfo().begin()->first,
+                        FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc()));
+        for (size_t i = 0; i < warmUpIterations; i++)
+            request.Infer();
+
+        std::vector<double> latencies;
+        for (size_t i = 0; i < iterations; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            request.Infer();
+            latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::nth_element(latencies.begin(), latencies.begin() + latencies.size() / 2, latencies.end());
+        result.latency = latencies[latencies.size() / 2];
+        return result;
+    }
+
+    static const size_t warmUpIterations = 5;
+    static const size_t iterations = 31;
+    Core ie;
+};
+
+TEST_F(WeightsDecompressionPerfTests, compressedWeightsAreFasterThanFP32Weights) {
+    const double fp32Latency = Measure(MakeNetwork(ngraph::element::f32)).latency;
+    const double u8Latency = Measure(MakeNetwork(ngraph::element::u8)).latency;
+    std::cout << "FP32 weights: " << fp32Latency << " ms, U8 weights: " << u8Latency << " ms" << std::endl;
+
+    // a quarter of the memory traffic of the FP32 weights
+    ASSERT_LT(u8Latency, fp32Latency);
+}
+
+TEST_F(WeightsDecompressionPerfTests, keptFP16WeightsSaveMemoryAndTime) {
+    const auto network = MakeNetwork(ngraph::element::f16);
+    const auto kept = Measure(network, {{PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::YES}});
+    const auto converted = Measure(network, {{PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::NO}});
+    std::cout << "FP16 weights kept: " << kept.latency << " ms, " << kept.memory / (1 << 20) << " MB, "
+              << "converted to FP32: " << converted.latency << " ms, " << converted.memory / (1 << 20) << " MB" << std::endl;
+
+#ifdef __linux__
+    // the kept weights are read from the constant, the converted ones take O * K * sizeof(float) more
+    ASSERT_LT(kept.memory + static_cast<int64_t>(O * K * sizeof(float) / 2), converted.memory);
+#endif
+    ASSERT_LT(kept.latency, converted.latency);
+}
+}  // namespace
@@ -23,7 +23,23 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS, InferenceEngine::PluginConfigParams::YES},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT, "2"},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS_PRIORITY, "1"},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUEUE_LIMIT, "4"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS, InferenceEngine::PluginConfigParams::YES},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4"},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS_QUEUE_LIMIT, "1"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_NUMA_LOCAL_MEMORY, InferenceEngine::PluginConfigParams::YES},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_HUGE_PAGES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_ALIGNMENT, "64"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS, InferenceEngine::PluginConfigParams::YES},
+             {InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_WORKSPACE, "workspace"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_RESULT_CACHE_SIZE, "16"}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -59,7 +75,15 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_STREAMS_WEIGHT, "0"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_HUGE_PAGES, "4KB"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_MEMORY_ALIGNMENT, "48"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, "ON"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_RESULT_CACHE_SIZE, "-1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
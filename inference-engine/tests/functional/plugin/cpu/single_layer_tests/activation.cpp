@@ -42,6 +42,11 @@ public:
             data_start_from = 0;
             data_range = 2;
             resolution = 32768;
+        } else if (activationType == ActivationTypes::Log) {
+            // the logarithm is not defined for zero
+            data_start_from = 1;
+            data_range = 15;
+            resolution = 32768;
         } else {
             data_start_from = 0;
             data_range = 15;
@@ -99,7 +104,15 @@ const std::map<ActivationTypes, std::vector<std::vector<float>>> activationTypes
         {Mish,        {{}}},
         {PReLu, {{-0.01f}}},
         {GeluErf,     {{}}},
-        {GeluTanh,    {{}}}
+        {GeluTanh,    {{}}},
+        {Negative,    {{}}},
+        {Floor,       {{}}},
+        {Ceiling,     {{}}},
+        {Sign,        {{}}},
+        {Sin,         {{}}},
+        {Cos,         {{}}},
+        {Log,         {{}}},
+        {Erf,         {{}}}
 };
 
 std::vector<CPUSpecificParams> cpuParams_4D = {
@@ -151,6 +151,7 @@ const std::vector<fusingSpecificParams> fusingParamsSet{
         // eltwise
         fusingRelu,
         fusingPRelu1D,
+        fusingSigmoidLog,
         // depthwise
         fusingReluScaleShift,
         // fake quantize
@@ -0,0 +1,176 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+
+#include <ngraph/opsets/opset6.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        int64_t,                // output size
+        int64_t,                // sampling ratio
+        bool,                   // aligned
+        size_t                  // channels
+> ROIFeatureExtractorLayerCPUTestParams;
+
+namespace {
+const size_t imageSize = 512;
+const std::vector<int64_t> pyramidScales = {4, 8, 16, 32};
+
+// x0, y0, x1, y1 in the image: ROIs of every pyramid level, crossing the image borders and a degenerate one,
+// which is not assigned to any level
+const std::vector<float> rois = {
+        2, 3, 40, 50,
+        100, 50, 300, 260,
+        0, 0, 511, 511,
+        300, 200, 500, 500,
+        -20, -10, 60, 30,
+        10, 10, 10, 10,
+        450, 450, 520, 530
+};
+}  // namespace
+
+class ROIFeatureExtractorLayerCPUTest : public testing::WithParamInterface<ROIFeatureExtractorLayerCPUTestParams>,
+                                        virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ROIFeatureExtractorLayerCPUTestParams> obj) {
+        int64_t outputSize, samplingRatio;
+        bool aligned;
+        size_t channels;
+        std::tie(outputSize, samplingRatio, aligned, channels) = obj.param;
+        std::ostringstream result;
+        result << "outputSize=" << outputSize << "_";
+        result << "samplingRatio=" << samplingRatio << "_";
+        result << "aligned=" << aligned << "_";
+        result << "C=" << channels;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t channels;
+        std::tie(attrs.output_size, attrs.sampling_ratio, attrs.aligned, channels) = this->GetParam();
+        attrs.pyramid_scales = pyramidScales;
+
+        std::vector<std::vector<size_t>> featureShapes;
+        for (auto scale : pyramidScales) {
+            featureShapes.push_back({1, channels, imageSize / scale, imageSize / scale});
+        }
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, featureShapes);
+        ngraph::OutputVector inputs{ngraph::builder::makeConstant<float>(ngraph::element::f32, {rois.size() / 4, 4}, rois)};
+        for (const auto& param : params) {
+            inputs.push_back(param);
+        }
+        auto extractor = std::make_shared<ngraph::opset6::ExperimentalDetectronROIFeatureExtractor>(inputs, attrs);
+        extractor->set_friendly_name("ROIFeatureExtractor");
+        selectedType = std::string("ref_any_") + Precision(Precision::FP32).name();
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset6::Result>(extractor->output(0)),
+                                     std::make_shared<ngraph::opset6::Result>(extractor->output(1))};
+        function = std::make_shared<ngraph::Function>(results, params, "ROIFeatureExtractor");
+    }
+
+    // the interpreter does not support the operation, so the reference is the original Caffe2 algorithm:
+    // the bilinear samples are computed per ROI and per bin without precomputed tables
+    std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> CalculateRefs() override {
+        const auto outputSize = static_cast<size_t>(attrs.output_size);
+        const size_t roisNum = rois.size() / 4;
+        const size_t levelsNum = pyramidScales.size();
+        const size_t channels = inputs.front()->getTensorDesc().getDims()[1];
+
+        std::vector<float> features(roisNum * channels * outputSize * outputSize, 0.f);
+        for (size_t n = 0; n < roisNum; n++) {
+            const float* roi = &rois[4 * n];
+            const float area = (roi[2] - roi[0]) * (roi[3] - roi[1]);
+            if (area <= 0)
+                continue;
+            const int level = std::max(0, std::min(static_cast<int>(levelsNum) - 1,
+                static_cast<int>(std::floor(std::log2(std::sqrt(area) / 224.f + 1e-6f) + 2))));
+
+            const auto& dims = inputs[level]->getTensorDesc().getDims();
+            const int H = static_cast<int>(dims[2]);
+            const int W = static_cast<int>(dims[3]);
+            auto featureMap = as<MemoryBlob>(inputs[level])->rmap().as<const float*>();
+            const float scale = 1.f / pyramidScales[level];
+            const float offset = attrs.aligned ? 0.5f : 0.f;
+            const float x0 = roi[0] * scale - offset;
+            const float y0 = roi[1] * scale - offset;
+            const float roiW = std::max(roi[2] * scale - offset - x0, 1.f);
+            const float roiH = std::max(roi[3] * scale - offset - y0, 1.f);
+            const float binW = roiW / outputSize;
+            const float binH = roiH / outputSize;
+            const int gridW = attrs.sampling_ratio > 0 ? static_cast<int>(attrs.sampling_ratio) : static_cast<int>(std::ceil(binW));
+            const int gridH = attrs.sampling_ratio > 0 ? static_cast<int>(attrs.sampling_ratio) : static_cast<int>(std::ceil(binH));
+
+            auto bilinear = [&](const float* data, float y, float x) -> float {
+                if (y < -1.f || y > H || x < -1.f || x > W)
+                    return 0.f;
+                y = std::max(y, 0.f);
+                x = std::max(x, 0.f);
+                int yLow = static_cast<int>(y), xLow = static_cast<int>(x);
+                int yHigh = yLow + 1, xHigh = xLow + 1;
+                if (yLow >= H - 1) {
+                    yHigh = yLow = H - 1;
+                    y = static_cast<float>(yLow);
+                }
+                if (xLow >= W - 1) {
+                    xHigh = xLow = W - 1;
+                    x = static_cast<float>(xLow);
+                }
+                const float ly = y - yLow, lx = x - xLow;
+                return (1 - ly) * (1 - lx) * data[yLow * W + xLow] + (1 - ly) * lx * data[yLow * W + xHigh] +
+                       ly * (1 - lx) * data[yHigh * W + xLow] + ly * lx * data[yHigh * W + xHigh];
+            };
+
+            for (size_t c = 0; c < channels; c++) {
+                const float* data = featureMap + c * H * W;
+                for (size_t ph = 0; ph < outputSize; ph++) {
+                    for (size_t pw = 0; pw < outputSize; pw++) {
+                        float sum = 0.f;
+                        for (int iy = 0; iy < gridH; iy++) {
+                            const float y = y0 + ph * binH + (iy + .5f) * binH / gridH;
+                            for (int ix = 0; ix < gridW; ix++) {
+                                const float x = x0 + pw * binW + (ix + .5f) * binW / gridW;
+                                sum += bilinear(data, y, x);
+                            }
+                        }
+                        features[((n * channels + c) * outputSize + ph) * outputSize + pw] = sum / (gridH * gridW);
+                    }
+                }
+            }
+        }
+
+        auto toBytes = [](const std::vector<float>& values) {
+            auto bytes = reinterpret_cast<const std::uint8_t*>(values.data());
+            return std::vector<std::uint8_t>(bytes, bytes + values.size() * sizeof(float));
+        };
+        return {{ngraph::element::f32, toBytes(features)}, {ngraph::element::f32, toBytes(rois)}};
+    }
+
+    ngraph::opset6::ExperimentalDetectronROIFeatureExtractor::Attributes attrs;
+};
+
+TEST_P(ROIFeatureExtractorLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "ExperimentalDetectronROIFeatureExtractor");
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ROIFeatureExtractorLayoutTest, ROIFeatureExtractorLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(7, 3),           // output size
+                ::testing::Values(0, 2),           // sampling ratio
+                ::testing::Values(false, true),    // aligned
+                ::testing::Values(3, 17)),         // channels
+                ROIFeatureExtractorLayerCPUTest::getTestCaseName);
+} // namespace
+} // namespace CPULayerTestsDefinitions
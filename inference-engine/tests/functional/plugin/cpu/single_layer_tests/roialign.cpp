@@ -116,7 +116,8 @@ std::vector<CPUSpecificParams> filterCPUInfoForDevice() {
     resCPUParams.push_back(CPUSpecificParams{{nhwc, nc, x}, {nhwc}, {}, {}});
     if (with_cpu_x86_avx512f()) {
         resCPUParams.push_back(CPUSpecificParams{{nChw16c, nc, x}, {nChw16c}, {}, {}});
-    } else if (with_cpu_x86_avx2() || with_cpu_x86_sse42()) {
+    }
+    if (with_cpu_x86_avx2() || with_cpu_x86_sse42()) {
         resCPUParams.push_back(CPUSpecificParams{{nChw8c, nc, x}, {nChw8c}, {}, {}});
     }
     return resCPUParams;
@@ -171,5 +172,35 @@ INSTANTIATE_TEST_SUITE_P(smoke_ROIAlignLayoutTest, ROIAlignLayerCPUTest,
                         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                 ::testing::ValuesIn(filterCPUInfoForDevice())),
                 ROIAlignLayerCPUTest::getTestCaseName);
+
+// adaptive and fixed sampling with a fractional scale over the channel runs of every layout:
+// more channels than the pooling routine accumulates at once, ROIs crossing the borders and a malformed one
+const std::vector<std::vector<size_t>> samplingInputShapeVector = {
+        SizeVector({ 2, 21, 17, 23 }),
+        SizeVector({ 2, 67, 9, 13 })
+};
+
+const std::vector<std::pair<std::vector<float>, std::vector<size_t>>> samplingPropVector = {
+        {{ -4, -6, 30, 21, 5, 3, 41, 37, 12, 8, 12, 8, 20, 10, 50, 40 }, { 1, 0, 1, 0 }}
+};
+
+const auto roiAlignSamplingParams = ::testing::Combine(
+        ::testing::Values(3),                         // bin's column count
+        ::testing::Values(5),                         // bin's row count
+        ::testing::Values(0.375f),                    // scale for given region considering actual input size
+        ::testing::Values(0, 2),                      // pooling ratio for bin
+        ::testing::ValuesIn(samplingPropVector),      // united vector of coordinates and batch id's
+        ::testing::ValuesIn(modeVector),              // pooling mode
+        ::testing::ValuesIn(samplingInputShapeVector) // feature map shape
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ROIAlignSamplingTest, ROIAlignLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        roiAlignSamplingParams,
+                        ::testing::ValuesIn(netPrecisions),
+                        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(filterCPUInfoForDevice())),
+                ROIAlignLayerCPUTest::getTestCaseName);
 } // namespace
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The graph with the nodes preferring the different layouts, the primitive descriptors are selected graph-wide.
+   The graph-wide selection must not add the reorders compared to the node by node one.
+
+        Parameter
+            |
+       Convolution
+        |       |
+        |   Transpose
+        |       |
+        |     MatMul
+        |       |
+        |   Transpose
+        |       |
+          Add
+           |
+          Relu
+*/
+using ConvTransposeMatMulEltwiseParams = std::tuple<SizeVector,    // input shape
+                                                    size_t>;       // number of the output channels
+
+class ConvTransposeMatMulEltwiseTest : public testing::WithParamInterface<ConvTransposeMatMulEltwiseParams>,
+                                       virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ConvTransposeMatMulEltwiseParams> obj) {
+        SizeVector inputShape;
+        size_t channels;
+        std::tie(inputShape, channels) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << channels;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t channels;
+        std::tie(inputShape, channels) = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, PluginConfigParams::YES});
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, channels);
+
+        auto toChannelsLast = std::make_shared<opset1::Transpose>(conv, opset1::Constant::create(element::i64, {4}, {0, 2, 3, 1}));
+        auto weights = builder::makeConstant<float>(element::f32, {channels, channels}, {}, true);
+        auto matmul = std::make_shared<opset1::MatMul>(toChannelsLast, weights);
+        auto toChannelsFirst = std::make_shared<opset1::Transpose>(matmul, opset1::Constant::create(element::i64, {4}, {0, 3, 1, 2}));
+
+        auto add = std::make_shared<opset1::Add>(conv, toChannelsFirst);
+        auto relu = std::make_shared<opset1::Relu>(add);
+        function = std::make_shared<Function>(relu, params, "ConvTransposeMatMulEltwise");
+    }
+
+    static size_t countReorders(ExecutableNetwork& execNet) {
+        size_t count = 0;
+        for (const auto& node : execNet.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            const auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(rtInfo.end() != it);
+            const auto type = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != type);
+            if (type->get() == "Reorder")
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_P(ConvTransposeMatMulEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto greedyConfiguration = configuration;
+    greedyConfiguration[PluginConfigParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION] = PluginConfigParams::NO;
+    auto greedyNetwork = getCore()->LoadNetwork(InferenceEngine::CNNNetwork{function}, targetDevice, greedyConfiguration);
+    ASSERT_LE(countReorders(executableNetwork), countReorders(greedyNetwork));
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConvTransposeMatMulEltwise, ConvTransposeMatMulEltwiseTest,
+                        ::testing::Combine(::testing::Values(SizeVector{1, 8, 10, 10}, SizeVector{2, 16, 7, 9}),
+                                           ::testing::Values(16, 32)),
+                        ConvTransposeMatMulEltwiseTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
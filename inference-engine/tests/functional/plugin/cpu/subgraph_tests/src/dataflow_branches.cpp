@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+#include <thread>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The independent branches are executed concurrently in the dataflow mode.
+
+             Parameter
+         /       |       \
+    Convolution  ...  Convolution
+         |               |
+    Convolution  ...  Convolution
+         |               |
+    Convolution  ...  Convolution
+         \       |       /
+              Concat
+*/
+using DataflowBranchesParams = std::tuple<SizeVector,    // input shape
+                                          size_t>;       // number of the branches
+
+class DataflowBranchesTest : public testing::WithParamInterface<DataflowBranchesParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<DataflowBranchesParams> obj) {
+        SizeVector inputShape;
+        size_t branches;
+        std::tie(inputShape, branches) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "branches=" << branches;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t branches;
+        std::tie(inputShape, branches) = this->GetParam();
+        configuration.insert({PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION, PluginConfigParams::YES});
+        configuration.insert({PluginConfigParams::KEY_CPU_THREADS_NUM, "4"});
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        OutputVector outputs;
+        for (size_t b = 0; b < branches; b++) {
+            // the kernels differ, so the branches are not merged as the same operations
+            const size_t kernel = 2 * b + 1;
+            const auto pad = static_cast<ptrdiff_t>(b);
+            Output<Node> branch = params[0];
+            for (size_t i = 0; i < 3; i++) {
+                branch = builder::makeConvolution(branch, element::f32, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                                  op::PadType::EXPLICIT, inputShape[1]);
+            }
+            outputs.push_back(branch);
+        }
+        auto concat = std::make_shared<opset1::Concat>(outputs, 1);
+        function = std::make_shared<Function>(concat, params, "DataflowBranches");
+    }
+
+    std::map<std::string, uint64_t> getMemoryPlan(const ExecutableNetwork& execNet) {
+        return execNet.GetMetric(METRIC_KEY(CPU_MEMORY_PLAN)).as<std::map<std::string, uint64_t>>();
+    }
+};
+
+TEST_P(DataflowBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the dataflow execution gives the same results as the sequential one
+    auto sequentialConfiguration = configuration;
+    sequentialConfiguration[PluginConfigParams::KEY_CPU_DATAFLOW_EXECUTION] = PluginConfigParams::NO;
+    auto sequentialNetwork = getCore()->LoadNetwork(cnnNetwork, targetDevice, sequentialConfiguration);
+    auto sequentialRequest = sequentialNetwork.CreateInferRequest();
+    size_t i = 0;
+    for (const auto& input : cnnNetwork.getInputsInfo()) {
+        sequentialRequest.SetBlob(input.first, inputs[i++]);
+    }
+    sequentialRequest.Infer();
+    const auto outputs = GetOutputs();
+    i = 0;
+    for (const auto& output : cnnNetwork.getOutputsInfo()) {
+        FuncTestUtils::compareBlobs(outputs[i++], sequentialRequest.GetBlob(output.first), 0.f);
+    }
+
+    // the nodes of one level may run concurrently, so the memory is reused only between the levels:
+    // more activations are alive at once than in the sequential order, but the memory is still reused
+    auto plan = getMemoryPlan(executableNetwork);
+    auto sequentialPlan = getMemoryPlan(sequentialNetwork);
+    ASSERT_LE(plan["LOWER_BOUND_BYTES"], plan["PLANNED_BYTES"]);
+    ASSERT_LT(plan["PLANNED_BYTES"], plan["NAIVE_BYTES"]);
+    ASSERT_EQ(sequentialPlan["NAIVE_BYTES"], plan["NAIVE_BYTES"]);
+    // the levels are not built for a single thread
+    if (std::thread::hardware_concurrency() > 1) {
+        ASSERT_GT(plan["LOWER_BOUND_BYTES"], sequentialPlan["LOWER_BOUND_BYTES"]);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_DataflowBranches, DataflowBranchesTest,
+                        ::testing::Combine(::testing::Values(SizeVector{1, 8, 16, 16}, SizeVector{2, 16, 9, 7}),
+                                           ::testing::Values(2, 3)),
+                        DataflowBranchesTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
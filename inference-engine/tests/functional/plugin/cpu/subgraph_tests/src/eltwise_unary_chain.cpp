@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The unary ops are fused into the Eltwise node of the Subtract.
+
+    Parameter    Parameter
+         \          /
+          Subtract
+              |
+            Sign
+              |
+          Negative
+              |
+            Floor
+              |
+           Ceiling
+              |
+             Sin
+              |
+             Cos
+              |
+             Log
+*/
+class EltwiseUnaryChainTest : public testing::WithParamInterface<SizeVector>,
+                              virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SizeVector> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto inputShape = this->GetParam();
+
+        // Sign makes the values exact, so the ops after it are compared at the points away from
+        // the discontinuities of Floor and Ceiling, and Log gets cos(sin(x)) > 0
+        auto params = builder::makeParams(element::f32, {inputShape, inputShape});
+        std::shared_ptr<Node> chain = std::make_shared<opset1::Subtract>(params[0], params[1]);
+        chain = std::make_shared<opset1::Sign>(chain);
+        chain = std::make_shared<opset1::Negative>(chain);
+        chain = std::make_shared<opset1::Floor>(chain);
+        chain = std::make_shared<opset1::Ceiling>(chain);
+        chain = std::make_shared<opset1::Sin>(chain);
+        chain = std::make_shared<opset1::Cos>(chain);
+        chain = std::make_shared<opset1::Log>(chain);
+        function = std::make_shared<Function>(chain, params, "EltwiseUnaryChain");
+    }
+};
+
+TEST_P(EltwiseUnaryChainTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_EltwiseUnaryChain, EltwiseUnaryChainTest,
+                        ::testing::Values(SizeVector{1, 3, 8, 8}, SizeVector{2, 17, 5, 3}),
+                        EltwiseUnaryChainTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
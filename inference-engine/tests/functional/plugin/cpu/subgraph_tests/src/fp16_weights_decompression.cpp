@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ie_system_conf.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *   Constant(f16)
+ *        |
+ *     Convert    Parameter
+ *         \      /
+ *          MatMul
+ */
+using FP16WeightsMatMulParams = std::tuple<SizeVector,  // input shape
+                                           SizeVector,  // weights shape
+                                           bool>;       // transpose B
+
+class FP16WeightsMatMul : public testing::WithParamInterface<FP16WeightsMatMulParams>,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FP16WeightsMatMulParams> obj) {
+        SizeVector inputShape, weightsShape;
+        bool transposeB;
+        std::tie(inputShape, weightsShape, transposeB) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "WS=" << CommonTestUtils::vec2str(weightsShape) << "_";
+        result << "Transp_B=" << transposeB;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::YES});
+        SizeVector inputShape, weightsShape;
+        bool transposeB;
+        std::tie(inputShape, weightsShape, transposeB) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto weights = builder::makeConstant<float>(element::f16, weightsShape, {}, true, 1.f, -1.f);
+        auto convert = std::make_shared<opset1::Convert>(weights, element::f32);
+        auto matMul = builder::makeMatMul(params[0], convert, false, transposeB);
+        function = std::make_shared<Function>(matMul, params, "FP16WeightsMatMul");
+    }
+};
+
+TEST_P(FP16WeightsMatMul, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the weights are converted by FullyConnected on the fly instead of the Convert node
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+}
+
+/*
+ *   Constant(f16)
+ *        |
+ *     Convert    Parameter
+ *         \      /
+ *           Add
+ */
+class FP16WeightsEltwise : public testing::WithParamInterface<SizeVector>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SizeVector> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigParams::KEY_CPU_KEEP_FP16_WEIGHTS, PluginConfigParams::YES});
+        const auto shape = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {shape});
+        auto constant = builder::makeConstant<float>(element::f16, shape, {}, true, 1.f, -1.f);
+        auto convert = std::make_shared<opset1::Convert>(constant, element::f32);
+        auto add = std::make_shared<opset1::Add>(params[0], convert);
+        function = std::make_shared<Function>(add, params, "FP16WeightsEltwise");
+    }
+};
+
+TEST_P(FP16WeightsEltwise, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // Eltwise reads FP16 inputs on avx2 and newer machines only
+    if (with_cpu_x86_avx2())
+        CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FP16Weights, FP16WeightsMatMul,
+                        ::testing::Combine(::testing::Values(SizeVector{2, 64}, SizeVector{1, 3, 64}, SizeVector{7, 64}),
+                                           ::testing::Values(SizeVector{64, 35}),
+                                           ::testing::Values(false)),
+                        FP16WeightsMatMul::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FP16WeightsTransposed, FP16WeightsMatMul,
+                        ::testing::Combine(::testing::Values(SizeVector{2, 63}),
+                                           ::testing::Values(SizeVector{16, 63}),
+                                           ::testing::Values(true)),
+                        FP16WeightsMatMul::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FP16Weights, FP16WeightsEltwise,
+                        ::testing::Values(SizeVector{1, 64, 67}, SizeVector{96, 64}),
+                        FP16WeightsEltwise::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
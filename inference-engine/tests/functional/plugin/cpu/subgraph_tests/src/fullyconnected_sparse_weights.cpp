@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *   Parameter    Constant(sparse)
+ *        \      /
+ *         MatMul
+ */
+using FullyConnectedSparseWeightsParams = std::tuple<SizeVector,    // input shape
+                                                     SizeVector,    // weights shape [O, K]
+                                                     size_t,        // length of the zero blocks along K
+                                                     size_t>;       // every n-th block is not zero
+
+class FullyConnectedSparseWeights : public testing::WithParamInterface<FullyConnectedSparseWeightsParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FullyConnectedSparseWeightsParams> obj) {
+        SizeVector inputShape, weightsShape;
+        size_t blockSize, nonZeroBlockStep;
+        std::tie(inputShape, weightsShape, blockSize, nonZeroBlockStep) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "WS=" << CommonTestUtils::vec2str(weightsShape) << "_";
+        result << "Block=" << blockSize << "_";
+        result << "NonZeroStep=" << nonZeroBlockStep;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape, weightsShape;
+        size_t blockSize, nonZeroBlockStep;
+        std::tie(inputShape, weightsShape, blockSize, nonZeroBlockStep) = this->GetParam();
+
+        std::vector<float> weightsValues(shape_size(weightsShape), 0.f);
+        for (size_t i = 0; i < weightsValues.size(); i++) {
+            if ((i / blockSize) % nonZeroBlockStep == 0)
+                weightsValues[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / 4.f;
+        }
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto weights = opset1::Constant::create(element::f32, weightsShape, weightsValues);
+        auto matMul = builder::makeMatMul(params[0], weights, false, true);
+        function = std::make_shared<Function>(matMul, params, "FullyConnectedSparseWeights");
+
+        // the zero blocks are skipped by the reference implementation instead of the inner product primitive
+        selectedType = "ref_any_FP32";
+    }
+};
+
+TEST_P(FullyConnectedSparseWeights, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_BlockSparse, FullyConnectedSparseWeights,
+                        ::testing::Combine(::testing::Values(SizeVector{2, 128}, SizeVector{1, 5, 128}),
+                                           ::testing::Values(SizeVector{48, 128}),
+                                           ::testing::Values(16, 32),
+                                           ::testing::Values(4, 10)),
+                        FullyConnectedSparseWeights::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
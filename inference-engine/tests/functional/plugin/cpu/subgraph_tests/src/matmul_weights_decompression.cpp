@@ -0,0 +1,150 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *   Constant(u8/i8)
+ *        |
+ *     Convert    Constant
+ *         \      /
+ *         Subtract   Constant
+ *             \      /
+ *             Multiply
+ *                |
+ *            [Reshape]    Parameter
+ *                  \      /
+ *                   MatMul
+ */
+using MatMulWeightsDecompressionParams = std::tuple<SizeVector,    // input shape
+                                                    SizeVector,    // weights shape
+                                                    bool,          // transpose B
+                                                    element::Type, // weights precision
+                                                    float,         // maximal absolute value of the weights
+                                                    bool>;         // with zero points
+
+class MatMulWeightsDecompression : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulWeightsDecompressionParams> obj) {
+        SizeVector inputShape, weightsShape;
+        bool transposeB, withZeroPoints;
+        element::Type weightsPrecision;
+        float weightsRange;
+        std::tie(inputShape, weightsShape, transposeB, weightsPrecision, weightsRange, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "WS=" << CommonTestUtils::vec2str(weightsShape) << "_";
+        result << "Transp_B=" << transposeB << "_";
+        result << "WPRC=" << weightsPrecision << "_";
+        result << "WRange=" << weightsRange << "_";
+        result << "ZP=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape, weightsShape;
+        bool transposeB, withZeroPoints;
+        element::Type weightsPrecision;
+        float weightsRange;
+        std::tie(inputShape, weightsShape, transposeB, weightsPrecision, weightsRange, withZeroPoints) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        const bool grouped = weightsShape.size() == 3;
+        const float lowest = weightsPrecision.is_signed() ? -weightsRange : 0.f;
+        auto weights = builder::makeConstant<float>(weightsPrecision, weightsShape, {}, true, weightsRange, lowest);
+        std::shared_ptr<Node> decompression = std::make_shared<opset1::Convert>(weights, element::f32);
+
+        // per output channel (or group of the input channels) decompression constants
+        SizeVector channelShape(weightsShape.size(), 1);
+        channelShape[transposeB ? 0 : 1] = weightsShape[transposeB ? 0 : 1];
+        if (grouped)
+            channelShape[1] = weightsShape[1];
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, channelShape, {}, true, 2.f, lowest / 2);
+            decompression = std::make_shared<opset1::Subtract>(decompression, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, channelShape, {}, true, 0.1f, 0.01f);
+        decompression = std::make_shared<opset1::Multiply>(decompression, scales);
+        if (grouped) {
+            auto shape = opset1::Constant::create(element::i64, Shape{2}, {weightsShape[0], weightsShape[1] * weightsShape[2]});
+            decompression = std::make_shared<opset1::Reshape>(decompression, shape, false);
+        }
+
+        auto matMul = builder::makeMatMul(params[0], decompression, false, transposeB);
+        function = std::make_shared<Function>(matMul, params, "MatMulWeightsDecompression");
+    }
+};
+
+TEST_P(MatMulWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the decompression is done by FullyConnected on the fly instead of the constant nodes
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+const std::vector<element::Type> weightsPrecisions = {
+    element::u8, element::i8
+};
+
+// the values fitting 4 bits are packed two per byte
+const std::vector<float> weightsRanges = {
+    7.f, 100.f
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PerChannel, MatMulWeightsDecompression,
+                        ::testing::Combine(::testing::Values(SizeVector{2, 64}, SizeVector{1, 3, 64}, SizeVector{7, 64}),
+                                           ::testing::Values(SizeVector{64, 35}),
+                                           ::testing::Values(false),
+                                           ::testing::ValuesIn(weightsPrecisions),
+                                           ::testing::ValuesIn(weightsRanges),
+                                           ::testing::Values(true, false)),
+                        MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_PerChannelTransposed, MatMulWeightsDecompression,
+                        ::testing::Combine(::testing::Values(SizeVector{2, 63}),
+                                           ::testing::Values(SizeVector{16, 63}),
+                                           ::testing::Values(true),
+                                           ::testing::ValuesIn(weightsPrecisions),
+                                           ::testing::ValuesIn(weightsRanges),
+                                           ::testing::Values(true)),
+                        MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Grouped, MatMulWeightsDecompression,
+                        ::testing::Combine(::testing::Values(SizeVector{4, 64}),
+                                           ::testing::Values(SizeVector{16, 4, 16}),
+                                           ::testing::Values(true),
+                                           ::testing::ValuesIn(weightsPrecisions),
+                                           ::testing::ValuesIn(weightsRanges),
+                                           ::testing::Values(true, false)),
+                        MatMulWeightsDecompression::getTestCaseName);
+
+// the groups of whole chunks of the decompression kernel
+INSTANTIATE_TEST_SUITE_P(smoke_GroupedByChunks, MatMulWeightsDecompression,
+                        ::testing::Combine(::testing::Values(SizeVector{5, 64}),
+                                           ::testing::Values(SizeVector{16, 2, 32}),
+                                           ::testing::Values(true),
+                                           ::testing::ValuesIn(weightsPrecisions),
+                                           ::testing::ValuesIn(weightsRanges),
+                                           ::testing::Values(true, false)),
+                        MatMulWeightsDecompression::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
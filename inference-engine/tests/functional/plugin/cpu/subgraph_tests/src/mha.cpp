@@ -0,0 +1,148 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *  Parameter(Q)      Parameter(K)
+ *       |                 |
+ *   Transpose         Transpose
+ *       |                 |
+ *  [Multiply]             |
+ *         \              /
+ *             MatMul
+ *               |
+ *      [Multiply/Divide]
+ *               |
+ *             [Add] <- Parameter(mask)
+ *               |
+ *            Softmax    Parameter(V)
+ *               |           |
+ *               |       Transpose
+ *                \         /
+ *                  MatMul
+ *                    |
+ *                Transpose
+ */
+enum class ScaleType {
+    None,
+    Multiply,
+    Divide,
+    QueryMultiply
+};
+
+using MHAParams = std::tuple<size_t,       // batch
+                             size_t,       // sequence length
+                             size_t,       // heads
+                             size_t,       // head size
+                             ScaleType,    // scale
+                             bool,         // with mask
+                             bool>;        // transposed key is passed to MatMul with transpose_b
+
+class MHATest : public testing::WithParamInterface<MHAParams>, virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MHAParams> obj) {
+        size_t batch, seqLength, heads, headSize;
+        ScaleType scaleType;
+        bool withMask, transposeB;
+        std::tie(batch, seqLength, heads, headSize, scaleType, withMask, transposeB) = obj.param;
+
+        std::ostringstream result;
+        result << "B=" << batch << "_";
+        result << "S=" << seqLength << "_";
+        result << "H=" << heads << "_";
+        result << "D=" << headSize << "_";
+        result << "Scale=" << static_cast<int>(scaleType) << "_";
+        result << "Mask=" << withMask << "_";
+        result << "Transp_B=" << transposeB;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t batch, seqLength, heads, headSize;
+        ScaleType scaleType;
+        bool withMask, transposeB;
+        std::tie(batch, seqLength, heads, headSize, scaleType, withMask, transposeB) = this->GetParam();
+
+        const SizeVector dataShape = {batch, seqLength, heads, headSize};
+        std::vector<SizeVector> inputShapes = {dataShape, dataShape, dataShape};
+        if (withMask)
+            inputShapes.push_back({batch, 1, 1, seqLength});
+        auto params = builder::makeParams(element::f32, inputShapes);
+
+        auto transpose = [](const Output<Node>& input, const std::vector<int64_t>& order) {
+            return std::make_shared<opset1::Transpose>(input, opset1::Constant::create(element::i64, {order.size()}, order));
+        };
+        const float scale = 1.f / std::sqrt(static_cast<float>(headSize));
+
+        std::shared_ptr<Node> q = transpose(params[0], {0, 2, 1, 3});
+        if (scaleType == ScaleType::QueryMultiply)
+            q = std::make_shared<opset1::Multiply>(q, opset1::Constant::create(element::f32, {}, {scale}));
+        auto k = transpose(params[1], transposeB ? std::vector<int64_t>{0, 2, 1, 3} : std::vector<int64_t>{0, 2, 3, 1});
+        auto v = transpose(params[2], {0, 2, 1, 3});
+
+        std::shared_ptr<Node> scores = std::make_shared<opset1::MatMul>(q, k, false, transposeB);
+        if (scaleType == ScaleType::Multiply)
+            scores = std::make_shared<opset1::Multiply>(scores, opset1::Constant::create(element::f32, {}, {scale}));
+        else if (scaleType == ScaleType::Divide)
+            scores = std::make_shared<opset1::Divide>(scores, opset1::Constant::create(element::f32, {}, {1.f / scale}));
+        if (withMask)
+            scores = std::make_shared<opset1::Add>(scores, params[3]);
+        auto softmax = std::make_shared<opset1::Softmax>(scores, 3);
+        auto attention = std::make_shared<opset1::MatMul>(softmax, v);
+        auto result = transpose(attention, {0, 2, 1, 3});
+        function = std::make_shared<Function>(result, params, "MHA");
+
+        selectedType = "ref_any_FP32";
+    }
+};
+
+TEST_P(MHATest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "MHA");
+    // the scores are not materialized by the separate nodes
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", 0);
+    CheckNodeOfTypeCount(executableNetwork, "MatMul", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Transpose", 0);
+}
+
+namespace {
+
+// BERT-like attention with the mask
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_Masked, MHATest,
+                        ::testing::Combine(::testing::Values(1, 2),
+                                           ::testing::Values(7, 40),
+                                           ::testing::Values(4),
+                                           ::testing::Values(16),
+                                           ::testing::Values(ScaleType::Multiply, ScaleType::Divide),
+                                           ::testing::Values(true),
+                                           ::testing::Values(true, false)),
+                        MHATest::getTestCaseName);
+
+// ViT-like attention without the mask
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_NotMasked, MHATest,
+                        ::testing::Combine(::testing::Values(1),
+                                           ::testing::Values(50),
+                                           ::testing::Values(3),
+                                           ::testing::Values(64),
+                                           ::testing::Values(ScaleType::None, ScaleType::QueryMultiply),
+                                           ::testing::Values(false),
+                                           ::testing::Values(true, false)),
+                        MHATest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,95 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ie_system_conf.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *   Parameter   Parameter  [Parameter]
+ *       |           |          |
+ *  FakeQuantize     |          |
+ *         \         |         /
+ *       LSTMSequence / GRUSequence
+ */
+using QuantizedRNNSequenceParams = std::tuple<std::string,  // cell type
+                                              size_t,       // batch
+                                              size_t,       // sequence length
+                                              size_t,       // input size
+                                              size_t>;      // hidden size
+
+class QuantizedRNNSequence : public testing::WithParamInterface<QuantizedRNNSequenceParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<QuantizedRNNSequenceParams> obj) {
+        std::string cellType;
+        size_t batch, seqLength, inputSize, hiddenSize;
+        std::tie(cellType, batch, seqLength, inputSize, hiddenSize) = obj.param;
+
+        std::ostringstream result;
+        result << "Cell=" << cellType << "_";
+        result << "N=" << batch << "_";
+        result << "T=" << seqLength << "_";
+        result << "IS=" << inputSize << "_";
+        result << "HS=" << hiddenSize;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::string cellType;
+        size_t batch, seqLength, inputSize, hiddenSize;
+        std::tie(cellType, batch, seqLength, inputSize, hiddenSize) = this->GetParam();
+
+        const bool isLSTM = cellType == "LSTM";
+        const size_t gates = isLSTM ? 4 : 3;
+        std::vector<SizeVector> inputShapes = {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}};
+        if (isLSTM)
+            inputShapes.push_back({batch, 1, hiddenSize});
+        auto params = builder::makeParams(element::f32, inputShapes);
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(params));
+
+        // the quantized values are shifted, so the data shift of the primitive is not zero
+        paramOuts[0] = builder::makeFakeQuantize(paramOuts[0], element::f32, 256, {}, {0.f}, {10.f}, {-1.f}, {1.f});
+
+        const std::vector<Shape> WRB = {{1, gates * hiddenSize, inputSize}, {1, gates * hiddenSize, hiddenSize},
+                                        {1, gates * hiddenSize}, {batch}};
+        auto rnn = isLSTM ? builder::makeLSTM(paramOuts, WRB, hiddenSize, {"sigmoid", "tanh", "tanh"}, {}, {}, 0.f, true)
+                          : builder::makeGRU(paramOuts, WRB, hiddenSize, {"sigmoid", "tanh"}, {}, {}, 0.f, false, true);
+        function = std::make_shared<Function>(rnn->outputs(), params, "QuantizedRNNSequence");
+
+        // the weights are quantized per output channel by the node
+        threshold = 0.05f;
+        selectedType = std::string("ref_any_") + (with_cpu_x86_avx512_core() ? "U8" : "FP32");
+    }
+};
+
+TEST_P(QuantizedRNNSequence, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "RNNSeq");
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_QuantizedRNNSequence, QuantizedRNNSequence,
+                        ::testing::Combine(::testing::Values("LSTM", "GRU"),
+                                           ::testing::Values(1, 3),
+                                           ::testing::Values(2, 5),
+                                           ::testing::Values(16),
+                                           ::testing::Values(32)),
+                        QuantizedRNNSequence::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* SoftSign as the ONNX importer decomposes it is fused into a single Eltwise node together with the Subtract.
+   Without the fusion the Divide cannot join the Eltwise node of Abs, as both of them read the Subtract.
+
+    Parameter    Parameter
+         \          /
+          Subtract
+           |     |
+           |    Abs
+           |     |
+           |   Add(1)
+           |     |
+           Divide
+*/
+class SoftSignFusionTest : public testing::WithParamInterface<SizeVector>,
+                           virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SizeVector> obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto inputShape = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {inputShape, inputShape});
+        auto subtract = std::make_shared<opset1::Subtract>(params[0], params[1]);
+        auto abs = std::make_shared<opset1::Abs>(subtract);
+        auto add = std::make_shared<opset1::Add>(abs, opset1::Constant::create(element::f32, Shape{}, {1.f}));
+        auto divide = std::make_shared<opset1::Divide>(subtract, add);
+        function = std::make_shared<Function>(divide, params, "SoftSignFusion");
+    }
+};
+
+TEST_P(SoftSignFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_SoftSignFusion, SoftSignFusionTest,
+                        ::testing::Values(SizeVector{1, 3, 8, 8}, SizeVector{2, 17, 5, 3}),
+                        SoftSignFusionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -116,6 +116,14 @@ const auto fusingSqrt = fusingSpecificParams{std::make_shared<postNodesMgr>(std:
                 return ngraph::builder::makeActivation(inpNode, ngPrc, ngraph::helpers::Sqrt);
             }, "Sqrt"}}), {"Sqrt"}};
 
+const auto fusingSigmoidLog = fusingSpecificParams{std::make_shared<postNodesMgr>(std::vector<postNodeBuilder>{
+            {[](std::shared_ptr<ngraph::Node> inpNode, const ngraph::element::Type& ngPrc, ngraph::ParameterVector& params){
+                return ngraph::builder::makeActivation(inpNode, ngPrc, ngraph::helpers::Sigmoid);
+            }, "Sigmoid"},
+            {[](std::shared_ptr<ngraph::Node> inpNode, const ngraph::element::Type& ngPrc, ngraph::ParameterVector& params){
+                return ngraph::builder::makeActivation(inpNode, ngPrc, ngraph::helpers::Log);
+            }, "Log"}}), {"Sigmoid", "Log"}};
+
 const auto fusingPReluPerChannel = fusingSpecificParams{std::make_shared<postNodesMgr>(std::vector<postNodeBuilder>{
             {[](std::shared_ptr<ngraph::Node> inpNode, const ngraph::element::Type& ngPrc, ngraph::ParameterVector& params){
                 auto shape = inpNode->get_shape();
@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/cpu_convert.h"
+
+using namespace InferenceEngine;
+
+TEST(CpuConvertTest, FloatToIntegerSaturates) {
+    // 37 elements: full vectors for every ISA plus a scalar tail
+    std::vector<float> src(37);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (i % 2 ? -1.f : 1.f) * 40.7f * i;
+
+    std::vector<uint8_t> u8(src.size());
+    std::vector<int8_t> i8(src.size());
+    std::vector<int32_t> i32(src.size());
+    cpu_convert(src.data(), u8.data(), Precision::FP32, Precision::U8, src.size());
+    cpu_convert(src.data(), i8.data(), Precision::FP32, Precision::I8, src.size());
+    cpu_convert(src.data(), i32.data(), Precision::FP32, Precision::I32, src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        const float truncated = std::trunc(src[i]);
+        EXPECT_EQ(static_cast<uint8_t>(std::min(std::max(truncated, 0.f), 255.f)), u8[i]) << i;
+        EXPECT_EQ(static_cast<int8_t>(std::min(std::max(truncated, -128.f), 127.f)), i8[i]) << i;
+        EXPECT_EQ(static_cast<int32_t>(truncated), i32[i]) << i;
+    }
+}
+
+TEST(CpuConvertTest, FloatToIntegerSaturatesOutOfRange) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const int32_t i32Max = std::numeric_limits<int32_t>::max();
+    const int32_t i32Min = std::numeric_limits<int32_t>::lowest();
+    struct Case {
+        float value;
+        uint8_t u8;
+        int8_t i8;
+        int32_t i32;
+    };
+    const std::vector<Case> cases = {
+        {nan, 0, 0, 0},
+        {1e10f, 255, 127, i32Max},
+        {-1e10f, 0, -128, i32Min},
+        {2147483520.f, 255, 127, 2147483520},
+        {2147483648.f, 255, 127, i32Max},
+        {-2147483648.f, 0, -128, i32Min},
+        {255.9f, 255, 127, 255},
+        {-128.9f, 0, -128, -128},
+    };
+
+    for (const auto &c : cases) {
+        // the first element goes through the vector body, the last one through the scalar tail on every ISA
+        std::vector<float> src(37, 1.f);
+        src.front() = c.value;
+        src.back() = c.value;
+
+        std::vector<uint8_t> u8(src.size());
+        std::vector<int8_t> i8(src.size());
+        std::vector<int32_t> i32(src.size());
+        cpu_convert(src.data(), u8.data(), Precision::FP32, Precision::U8, src.size());
+        cpu_convert(src.data(), i8.data(), Precision::FP32, Precision::I8, src.size());
+        cpu_convert(src.data(), i32.data(), Precision::FP32, Precision::I32, src.size());
+
+        for (size_t i : {static_cast<size_t>(0), src.size() - 1}) {
+            EXPECT_EQ(c.u8, u8[i]) << c.value << " at " << i;
+            EXPECT_EQ(c.i8, i8[i]) << c.value << " at " << i;
+            EXPECT_EQ(c.i32, i32[i]) << c.value << " at " << i;
+        }
+    }
+}
+
+TEST(CpuConvertTest, IntegerToIntegerSaturates) {
+    std::vector<int32_t> src(37);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (i % 2 ? -1 : 1) * static_cast<int32_t>(i * i * i * 7);
+
+    std::vector<uint8_t> u8(src.size());
+    std::vector<int16_t> i16(src.size());
+    std::vector<int64_t> i64(src.size());
+    cpu_convert(src.data(), u8.data(), Precision::I32, Precision::U8, src.size());
+    cpu_convert(src.data(), i16.data(), Precision::I32, Precision::I16, src.size());
+    cpu_convert(src.data(), i64.data(), Precision::I32, Precision::I64, src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        EXPECT_EQ(static_cast<uint8_t>(std::min(std::max(src[i], 0), 255)), u8[i]) << i;
+        EXPECT_EQ(static_cast<int16_t>(std::min(std::max(src[i], -32768), 32767)), i16[i]) << i;
+        EXPECT_EQ(src[i], i64[i]) << i;
+    }
+}
+
+TEST(CpuConvertTest, HalfPrecisionRoundTrip) {
+    std::vector<float> src(37);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (i % 2 ? -0.25f : 0.5f) * i;
+    src[1] = 1e6f;
+
+    std::vector<uint16_t> f16(src.size());
+    std::vector<float> dst(src.size());
+    cpu_convert(src.data(), f16.data(), Precision::FP32, Precision::FP16, src.size());
+    cpu_convert(f16.data(), dst.data(), Precision::FP16, Precision::FP32, src.size());
+
+    EXPECT_EQ(65504.f, dst[1]);
+    for (size_t i = 2; i < src.size(); i++)
+        EXPECT_EQ(src[i], dst[i]) << i;
+}
+
+TEST(CpuConvertTest, ToBoolean) {
+    std::vector<float> src = {0.f, -0.f, 0.5f, -3.f, 1e-30f};
+    std::vector<uint8_t> dst(src.size());
+    cpu_convert(src.data(), dst.data(), Precision::FP32, Precision::BOOL, src.size());
+
+    EXPECT_EQ((std::vector<uint8_t>{0, 0, 1, 1, 1}), dst);
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory_allocator.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(MemoryAllocatorTest, ScopeSetsCurrentAllocator) {
+    auto allocator = std::make_shared<MKLDNNMemoryAllocator>(false, Config::TransparentHugePages);
+    ASSERT_EQ(nullptr, MKLDNNMemoryAllocator::current());
+    {
+        MKLDNNMemoryAllocator::Scope scope{allocator.get()};
+        ASSERT_EQ(allocator.get(), MKLDNNMemoryAllocator::current());
+        {
+            MKLDNNMemoryAllocator::Scope nested{nullptr};
+            ASSERT_EQ(nullptr, MKLDNNMemoryAllocator::current());
+        }
+        ASSERT_EQ(allocator.get(), MKLDNNMemoryAllocator::current());
+    }
+    ASSERT_EQ(nullptr, MKLDNNMemoryAllocator::current());
+}
+
+TEST(MemoryAllocatorTest, LeavesSmallBuffersToDefaultAllocation) {
+    auto allocator = std::make_shared<MKLDNNMemoryAllocator>(true, Config::HugePages2MB);
+    ASSERT_EQ(nullptr, allocator->allocate(1024));
+    ASSERT_EQ(0u, allocator->getStatistics().allocations);
+}
+
+#if defined(__linux__)
+TEST(MemoryAllocatorTest, CountsAllocatedMemory) {
+    auto allocator = std::make_shared<MKLDNNMemoryAllocator>(true, Config::TransparentHugePages);
+    const size_t size = 4 * 1024 * 1024 + 1;
+    {
+        auto buffer = allocator->allocate(size);
+        ASSERT_NE(nullptr, buffer);
+        ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(buffer.get()) % 4096);
+        static_cast<char*>(buffer.get())[size - 1] = 1;
+
+        auto statistics = allocator->getStatistics();
+        ASSERT_EQ(1u, statistics.allocations);
+        ASSERT_GE(statistics.allocatedBytes, size);
+        ASSERT_EQ(statistics.allocatedBytes, statistics.peakAllocatedBytes);
+        ASSERT_EQ(0u, statistics.hugePagesBytes);
+    }
+    auto statistics = allocator->getStatistics();
+    ASSERT_EQ(0u, statistics.allocations);
+    ASSERT_EQ(0u, statistics.allocatedBytes);
+    ASSERT_EQ(0u, statistics.transparentHugePagesBytes);
+    ASSERT_EQ(0u, statistics.numaLocalBytes);
+    ASSERT_GT(statistics.peakAllocatedBytes, size);
+}
+#endif
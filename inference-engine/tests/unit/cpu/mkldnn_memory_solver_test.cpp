@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <limits>
+#include <random>
 #include <vector>
 #include <gtest/gtest.h>
 #include <ie_common.h>
@@ -114,7 +117,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
 
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{    //  |            __________
             {6, 7, 3},         //  |   ____    |_3________|
             {2, 5, 2},         //  |  |_4__|_____ |    |
@@ -123,7 +126,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 5);  // size ordered placement alone gives 6
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -233,9 +236,7 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MKLDNNPlugin::MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int off1 = ms.getOffset(box1.id);
@@ -273,3 +274,48 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, HeuristicsHaveNoOverlapping) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> start_dist(0, 50), time_dist(0, 10), size_dist(1, 100);
+
+    std::vector<Box> boxes;
+    for (int n = 0; n < 200; n++) {
+        const int start = start_dist(gen);
+        boxes.push_back({start, n % 20 == 0 ? -1 : start + time_dist(gen), size_dist(gen), n});
+    }
+    int max_ts = 0;
+    for (const auto& box : boxes)
+        max_ts = std::max(max_ts, std::max(box.start, box.finish));
+
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    auto check_no_overlapping = [&](int64_t required) {
+        for (size_t i = 0; i < boxes.size(); i++) {
+            const auto& box1 = boxes[i];
+            const int64_t off1 = ms.getOffset(box1.id);
+            ASSERT_LE(off1 + box1.size, required);
+            for (size_t j = i + 1; j < boxes.size(); j++) {
+                const auto& box2 = boxes[j];
+                const int64_t off2 = ms.getOffset(box2.id);
+                const int finish1 = box1.finish == -1 ? max_ts : box1.finish;
+                const int finish2 = box2.finish == -1 ? max_ts : box2.finish;
+                ASSERT_TRUE(finish1 < box2.start || box1.start > finish2 ||
+                            off1 + box1.size <= off2 || off1 >= off2 + box2.size) << "Box overlapping is detected";
+            }
+        }
+    };
+
+    using Heuristic = MKLDNNPlugin::MemorySolver::Heuristic;
+    int64_t min_required = std::numeric_limits<int64_t>::max();
+    for (auto heuristic : {Heuristic::BySize, Heuristic::ByLifetime, Heuristic::ByConflicts, Heuristic::ByStart}) {
+        const int64_t required = ms.solve(heuristic);
+        EXPECT_GE(required, ms.maxDepth());
+        check_no_overlapping(required);
+        min_required = std::min(min_required, required);
+    }
+
+    const int64_t required = ms.solve();
+    EXPECT_EQ(required, min_required);
+    EXPECT_LT(required, ms.totalSize());
+    check_no_overlapping(required);
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "mkldnn_shared_workspace.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(SharedWorkspaceTest, ReturnsSameWorkspaceForSameNameAndExecutor) {
+    int executor = 0, otherExecutor = 0;
+    auto workspace = MKLDNNSharedWorkspace::get("workspace", &executor);
+    ASSERT_EQ(workspace, MKLDNNSharedWorkspace::get("workspace", &executor));
+    ASSERT_NE(workspace, MKLDNNSharedWorkspace::get("workspace", &otherExecutor));
+    ASSERT_NE(workspace, MKLDNNSharedWorkspace::get("other", &executor));
+}
+
+#if defined(__linux__)
+TEST(SharedWorkspaceTest, GrowsInPlace) {
+    int executor = 0;
+    auto workspace = MKLDNNSharedWorkspace::get("growsInPlace", &executor);
+
+    auto small = workspace->allocate(0, 1024);
+    ASSERT_NE(nullptr, small);
+    small->data()[1023] = 1;
+    ASSERT_EQ(4096u, workspace->getStatistics().allocatedBytes);
+
+    // a bigger graph on the same stream commits more pages of the same buffer
+    const size_t size = 1024 * 1024 + 1;
+    auto big = workspace->allocate(0, size);
+    ASSERT_NE(nullptr, big);
+    ASSERT_EQ(small->data(), big->data());
+    ASSERT_EQ(1, small->data()[1023]);
+    big->data()[size - 1] = 1;
+
+    auto statistics = workspace->getStatistics();
+    ASSERT_EQ(2u, statistics.graphs);
+    ASSERT_EQ(1024u + size, statistics.requiredBytes);
+    ASSERT_EQ(1024u * 1024 + 4096, statistics.allocatedBytes);
+
+    // another stream gets its own buffer
+    auto other = workspace->allocate(1, 1024);
+    ASSERT_NE(nullptr, other);
+    ASSERT_NE(small->data(), other->data());
+
+    big.reset();
+    statistics = workspace->getStatistics();
+    ASSERT_EQ(2u, statistics.graphs);
+    ASSERT_EQ(2048u, statistics.requiredBytes);
+}
+
+TEST(SharedWorkspaceTest, CountsWaitsForBufferOfStream) {
+    int executor = 0;
+    auto workspace = MKLDNNSharedWorkspace::get("countsWaits", &executor);
+    auto first = workspace->allocate(0, 1024);
+    auto second = workspace->allocate(0, 1024);
+
+    std::unique_lock<std::mutex> lock = first->lock();
+    std::thread waiting{[&] {
+        second->lock();
+    }};
+    while (workspace->getStatistics().waits == 0)
+        std::this_thread::yield();
+    lock.unlock();
+    waiting.join();
+    ASSERT_EQ(1u, workspace->getStatistics().waits);
+}
+#endif
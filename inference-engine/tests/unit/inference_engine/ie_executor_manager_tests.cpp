@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <threading/ie_executor_manager.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 
 using namespace ::testing;
 using namespace std;
@@ -36,3 +37,26 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, returnTheSameSharedStreamsExecutorForTheSameConfig) {
+    ExecutorManagerImpl _manager;
+    auto executor1 = _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"Shared", 2});
+    auto executor2 = _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"Shared", 2});
+    auto executor3 = _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"Shared", 1});
+
+    ASSERT_EQ(executor1, executor2);
+    ASSERT_NE(executor1, executor3);
+    ASSERT_EQ(2, _manager.getSharedCPUStreamsExecutorsNumber());
+
+    _manager.clear("Shared");
+    ASSERT_EQ(0, _manager.getSharedCPUStreamsExecutorsNumber());
+}
+
+TEST(ExecutorManagerTests, destroyRetiredExecutorsOnNextRequest) {
+    ExecutorManagerImpl _manager;
+    _manager.retireCPUStreamsExecutor(std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"Retired", 1}));
+    ASSERT_EQ(1, _manager.getRetiredCPUStreamsExecutorsNumber());
+
+    _manager.getSharedCPUStreamsExecutor(IStreamsExecutor::Config{"Shared", 1});
+    ASSERT_EQ(0, _manager.getRetiredCPUStreamsExecutorsNumber());
+}
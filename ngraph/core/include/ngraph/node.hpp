@@ -33,6 +33,7 @@
 #include "ngraph/op/util/variable.hpp"
 #include "ngraph/op/util/variable_value.hpp"
 #include "ngraph/output_vector.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -500,10 +501,17 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        // Provenance is rarely used, so it is allocated on first modification only
+        struct Provenance
+        {
+            std::unordered_set<std::string> tags;
+            std::set<std::shared_ptr<Node>> group;
+        };
+        Provenance& provenance();
+        std::unique_ptr<Provenance> m_provenance;
+        // most of the operations have up to two inputs and a single output
+        StableVector<descriptor::Input, 2> m_inputs;
+        StableVector<descriptor::Output, 1> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -14,19 +16,43 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *
+         *        The folding is incremental: the nodes which were not folded by the previous run
+         *        on the same function and whose inputs were neither replaced nor changed since then
+         *        are skipped. Only the consumers of the replaced outputs are revalidated, so the
+         *        function stays valid after the pass, which it declares with the
+         *        KEEP_FUNCTION_VALID property.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
         public:
             NGRAPH_RTTI_DECLARATION;
+            ConstantFolding() { set_property(PassProperty::KEEP_FUNCTION_VALID, true); }
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+            /// \brief Statistics of the last run including the bodies of the sub-graph operations
+            struct Statistics
+            {
+                size_t nodes = 0;
+                // nodes not changed since the previous run which were not tried to be folded
+                size_t skipped = 0;
+                size_t folded = 0;
+                size_t revalidated = 0;
+            };
+
+            const Statistics& get_statistics() const { return m_statistics; }
+
         private:
+            bool fold(const std::shared_ptr<ngraph::Function>& f);
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
-            bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+            /// The nodes whose inputs were replaced are added to \p touched
+            bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f,
+                                               std::unordered_set<Node*>& touched);
+
+            Statistics m_statistics;
         };
     } // namespace pass
 } // namespace ngraph
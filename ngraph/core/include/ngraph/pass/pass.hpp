@@ -24,6 +24,9 @@ namespace ngraph
             REQUIRE_STATIC_SHAPE = 0x1,
             // Pass transformation will change the function's dynamic state
             CHANGE_DYNAMIC_STATE = 1 << 1,
+            // Pass revalidates the nodes it changes, so the Validate pass following it in
+            // the Manager is not run for its changes
+            KEEP_FUNCTION_VALID = 1 << 2,
         };
 
         typedef EnumMask<PassProperty> PassPropertyMask;
@@ -0,0 +1,231 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief Sequence container whose elements never move once created.
+    ///
+    /// Node input and output descriptors keep raw pointers to each other, so their
+    /// storage must be reference stable. std::deque provides that, but allocates
+    /// a map and a 512-byte block even for a single element, which dominates the
+    /// footprint of small nodes. StableVector keeps the first N elements inline and
+    /// allocates each further element separately behind a vector of pointers, so a
+    /// container of up to N elements costs no allocation at all.
+    ///
+    /// \note Moving the container relocates the inline elements, the pointers to them
+    ///       have to be updated by the owner like after a copy.
+    template <typename T, std::size_t N = 0>
+    class StableVector
+    {
+        template <typename Container, typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator() = default;
+            Iterator(Container* container, std::size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+
+            reference operator*() const { return (*m_container)[m_index]; }
+            pointer operator->() const { return &(*m_container)[m_index]; }
+            reference operator[](difference_type n) const { return (*m_container)[m_index + n]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int) { return Iterator(m_container, m_index++); }
+            Iterator& operator--()
+            {
+                --m_index;
+                return *this;
+            }
+            Iterator operator--(int) { return Iterator(m_container, m_index--); }
+            Iterator& operator+=(difference_type n)
+            {
+                m_index += n;
+                return *this;
+            }
+            Iterator& operator-=(difference_type n)
+            {
+                m_index -= n;
+                return *this;
+            }
+            Iterator operator+(difference_type n) const
+            {
+                return Iterator(m_container, m_index + n);
+            }
+            Iterator operator-(difference_type n) const
+            {
+                return Iterator(m_container, m_index - n);
+            }
+            difference_type operator-(const Iterator& other) const
+            {
+                return static_cast<difference_type>(m_index) -
+                       static_cast<difference_type>(other.m_index);
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+
+        private:
+            Container* m_container = nullptr;
+            std::size_t m_index = 0;
+        };
+
+        using InlineStorage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<StableVector, T>;
+        using const_iterator = Iterator<const StableVector, const T>;
+
+        StableVector() = default;
+        ~StableVector() { clear(); }
+
+        StableVector(const StableVector& other) { copy_from(other); }
+        StableVector& operator=(const StableVector& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                copy_from(other);
+            }
+            return *this;
+        }
+
+        StableVector(StableVector&& other) { move_from(other); }
+        StableVector& operator=(StableVector&& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        size_type size() const { return m_inline_size + m_allocated.size(); }
+        bool empty() const { return size() == 0; }
+        /// \brief Reserves room for the pointers of the elements beyond the inline ones;
+        ///        the elements themselves are allocated on insertion.
+        void reserve(size_type n)
+        {
+            if (n > N)
+            {
+                m_allocated.reserve(n - N);
+            }
+        }
+        void clear()
+        {
+            m_allocated.clear();
+            for (size_type i = 0; i < m_inline_size; ++i)
+            {
+                inline_element(i).~T();
+            }
+            m_inline_size = 0;
+        }
+
+        reference operator[](size_type i)
+        {
+            return i < m_inline_size ? inline_element(i) : *m_allocated[i - N];
+        }
+        const_reference operator[](size_type i) const
+        {
+            return i < m_inline_size ? inline_element(i) : *m_allocated[i - N];
+        }
+        reference at(size_type i)
+        {
+            check_range(i);
+            return (*this)[i];
+        }
+        const_reference at(size_type i) const
+        {
+            check_range(i);
+            return (*this)[i];
+        }
+        reference back() { return (*this)[size() - 1]; }
+        const_reference back() const { return (*this)[size() - 1]; }
+
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (m_inline_size != N)
+            {
+                new (&m_inline[m_inline_size]) T(std::forward<Args>(args)...);
+                return inline_element(m_inline_size++);
+            }
+            m_allocated.emplace_back(std::unique_ptr<T>(new T(std::forward<Args>(args)...)));
+            return *m_allocated.back();
+        }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, size()); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size()); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+    private:
+        T& inline_element(size_type i) { return *reinterpret_cast<T*>(&m_inline[i]); }
+        const T& inline_element(size_type i) const
+        {
+            return *reinterpret_cast<const T*>(&m_inline[i]);
+        }
+
+        void copy_from(const StableVector& other)
+        {
+            reserve(other.size());
+            for (const auto& element : other)
+            {
+                emplace_back(element);
+            }
+        }
+
+        // the allocated elements are taken over, only the inline ones are moved
+        void move_from(StableVector& other)
+        {
+            for (size_type i = 0; i < other.m_inline_size; ++i)
+            {
+                emplace_back(std::move(other.inline_element(i)));
+            }
+            m_allocated = std::move(other.m_allocated);
+            other.clear();
+        }
+
+        void check_range(size_type i) const
+        {
+            if (i >= size())
+            {
+                throw std::out_of_range("StableVector index out of range");
+            }
+        }
+
+        std::array<InlineStorage, N> m_inline;
+        size_type m_inline_size = 0;
+        std::vector<std::unique_ptr<T>> m_allocated;
+    };
+} // namespace ngraph
@@ -3,7 +3,10 @@
 //
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <map>
+#include <mutex>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 
@@ -12,15 +15,145 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    // Inputs and outputs of a node which was not folded. The node is not folded again until they
+    // change: the outputs reflect the attributes changed in place, e.g. a Convert destination type
+    struct FoldingSignature
+    {
+        struct Input
+        {
+            size_t producer;
+            size_t index;
+            element::Type type;
+            PartialShape shape;
+
+            bool operator==(const Input& other) const
+            {
+                return producer == other.producer && index == other.index &&
+                       type == other.type && shape == other.shape;
+            }
+        };
+
+        std::vector<Input> inputs;
+        std::vector<std::pair<element::Type, PartialShape>> outputs;
+        bool disabled;
+
+        bool operator==(const FoldingSignature& other) const
+        {
+            return disabled == other.disabled && inputs == other.inputs &&
+                   outputs == other.outputs;
+        }
+    };
+
+    FoldingSignature get_folding_signature(const Node& node)
+    {
+        FoldingSignature signature;
+        signature.inputs.reserve(node.get_input_size());
+        for (const auto& input : node.inputs())
+        {
+            const auto& source = input.get_source_output();
+            signature.inputs.push_back({source.get_node()->get_instance_id(),
+                                        source.get_index(),
+                                        input.get_element_type(),
+                                        input.get_partial_shape()});
+        }
+        signature.outputs.reserve(node.get_output_size());
+        for (const auto& output : node.outputs())
+        {
+            signature.outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+        }
+        signature.disabled = node.get_rt_info().count("DISABLED_CONSTANT_FOLDING") != 0;
+        return signature;
+    }
+
+    // Nodes of a function which were not folded by the previous run indexed by the instance id
+    using FoldingState = unordered_map<size_t, FoldingSignature>;
+
+    // The state is kept aside of the function, so it is shared by the passes of all managers
+    shared_ptr<FoldingState> get_folding_state(const shared_ptr<Function>& f)
+    {
+        static mutex states_mutex;
+        static map<const Function*, pair<weak_ptr<Function>, shared_ptr<FoldingState>>> states;
+
+        lock_guard<mutex> lock(states_mutex);
+        for (auto it = states.begin(); it != states.end();)
+        {
+            if (it->second.first.expired())
+                it = states.erase(it);
+            else
+                ++it;
+        }
+        auto& state = states[f.get()];
+        if (!state.second)
+        {
+            state = {f, make_shared<FoldingState>()};
+        }
+        return state.second;
+    }
+
+    vector<pair<element::Type, PartialShape>> get_output_types(const Node& node)
+    {
+        vector<pair<element::Type, PartialShape>> types;
+        types.reserve(node.get_output_size());
+        for (const auto& output : node.outputs())
+            types.emplace_back(output.get_element_type(), output.get_partial_shape());
+        return types;
+    }
+
+    void add_consumers(const Output<Node>& output, unordered_set<Node*>& nodes)
+    {
+        for (const auto& input : output.get_target_inputs())
+            nodes.insert(input.get_node());
+    }
+} // namespace
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    bool rewritten = pre_calculated_values_folding(f);
+    m_statistics = {};
+    return fold(f);
+}
+
+bool ngraph::pass::ConstantFolding::fold(const std::shared_ptr<ngraph::Function>& f)
+{
+    // nodes whose inputs were replaced or changed by this run
+    unordered_set<Node*> touched;
+    bool rewritten = pre_calculated_values_folding(f, touched);
+
+    const auto state = get_folding_state(f);
+    FoldingState not_folded;
+
+    auto revalidate = [&](const std::shared_ptr<Node>& node) {
+        const auto types = get_output_types(*node);
+        node->validate_and_infer_types();
+        m_statistics.revalidated++;
+        if (types != get_output_types(*node))
+        {
+            for (const auto& output : node->outputs())
+                add_consumers(output, touched);
+        }
+    };
 
     for (const auto& node : f->get_ordered_ops())
     {
-        if (rewritten)
+        m_statistics.nodes++;
+        if (touched.count(node.get()))
         {
-            node->validate_and_infer_types();
+            revalidate(node);
+        }
+
+        const auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node);
+        auto signature = get_folding_signature(*node);
+        // the bodies of the sub-graph operations are tracked separately
+        if (!sub_graph_node)
+        {
+            const auto it = state->find(node->get_instance_id());
+            if (it != state->end() && it->second == signature)
+            {
+                m_statistics.skipped++;
+                not_folded.emplace(node->get_instance_id(), std::move(signature));
+                continue;
+            }
         }
 
         OutputVector replacements(node->get_output_size());
@@ -49,24 +182,30 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
                     node_output.replace(replacement);
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(node, replacement);
+                    add_consumers(replacement, touched);
 
                     rewritten = true;
                 }
             }
+            m_statistics.folded++;
         }
         else
         {
+            not_folded.emplace(node->get_instance_id(), std::move(signature));
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            if (sub_graph_node)
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
+                const auto& sub_graph = sub_graph_node->get_function();
+                if (sub_graph && fold(sub_graph))
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    rewritten = true;
+                    revalidate(node);
                 }
             }
         }
     }
 
+    *state = std::move(not_folded);
     return rewritten;
 }
 
@@ -81,7 +220,7 @@ void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
 }
 
 bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
-    const std::shared_ptr<ngraph::Function>& f)
+    const std::shared_ptr<ngraph::Function>& f, std::unordered_set<Node*>& touched)
 {
     deque<shared_ptr<Node>> nodes;
     set<shared_ptr<Node>> visited;
@@ -120,6 +259,7 @@ bool ngraph::pass::ConstantFolding::pre_calculated_values_folding(
                     input_value.replace(replacement);
                     // Propagate runtime info attributes to replacement consumer nodes
                     copy_runtime_info_to_target_inputs(input_node, replacement);
+                    add_consumers(replacement->output(0), touched);
 
                     rewritten = true;
                 }
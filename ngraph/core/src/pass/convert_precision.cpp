@@ -5,6 +5,7 @@
 #include "transformations/convert_precision.hpp"
 #include "itt.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -165,6 +166,17 @@ namespace
                 }
             };
 
+        // Constants which are decompressed during the inference by the Convert operations the plugin
+        // marked explicitly stay in the compressed precision, as the Converts already produce the
+        // required one
+        auto is_runtime_decompression = [&](const std::vector<Input<Node>>& consumers) {
+            return std::all_of(consumers.begin(), consumers.end(), [&](const Input<Node>& input) {
+                const auto convert = dynamic_cast<const opset1::Convert*>(input.get_node());
+                return convert && convert->get_destination_type() == to &&
+                       convert->get_rt_info().count("RUNTIME_DECOMPRESSION");
+            });
+        };
+
         auto convert_node_output_precision = [&](const std::shared_ptr<ngraph::Node>& node) {
             for (auto output : node->outputs())
             {
@@ -175,6 +187,8 @@ namespace
                     auto it = const_to_internal_output.find(node.get());
                     if (it != const_to_internal_output.end())
                     {
+                        if (is_runtime_decompression(it->second))
+                            return false;
                         return fuse_type_to_constant(node, to, it->second);
                     }
 
@@ -15,6 +15,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
@@ -116,7 +117,12 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             }
             else
             {
-                function_changed = function_pass->run_on_function(func);
+                const bool changed = function_pass->run_on_function(func);
+                // the changes of the pass keeping the function valid don't require validation
+                if (!function_pass->get_property(PassProperty::KEEP_FUNCTION_VALID))
+                {
+                    function_changed = changed;
+                }
             }
         }
         else if (auto node_pass = dynamic_pointer_cast<NodePass>(pass))
@@ -155,7 +161,15 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         pass_timer.stop();
         if (profile_enabled)
         {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name();
+            if (auto constant_folding = dynamic_pointer_cast<ConstantFolding>(pass))
+            {
+                const auto& statistics = constant_folding->get_statistics();
+                cout << " (nodes: " << statistics.nodes << ", skipped: " << statistics.skipped
+                     << ", folded: " << statistics.folded
+                     << ", revalidated: " << statistics.revalidated << ")";
+            }
+            cout << "\n";
         }
     }
     if (profile_enabled)
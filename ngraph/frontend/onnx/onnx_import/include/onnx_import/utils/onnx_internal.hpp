@@ -38,6 +38,19 @@ namespace ngraph
             /// graph.
             std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
                                                         const std::string& model_path);
+
+            /// \brief      Imports and converts an ONNX model taking exclusive ownership of its
+            ///             ModelProto. Initializers raw data is referenced by the created
+            ///             constants in place, so the proto lives as long as those constants.
+            ///
+            /// \param[in]  model_proto Unique pointer to a ModelProto object.
+            /// \param[in]  model_path  The path to the imported onnx model.
+            ///
+            /// \return     An nGraph function that represents a single output from the created
+            /// graph.
+            std::shared_ptr<Function>
+                import_onnx_model(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto,
+                                  const std::string& model_path);
         } // namespace detail
     }     // namespace onnx_import
 } // namespace ngraph
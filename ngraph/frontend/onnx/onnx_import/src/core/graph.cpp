@@ -64,11 +64,13 @@ namespace ngraph
         {
             std::map<std::string, Tensor> initializers;
             // Process all initializers in the graph
-            for (const auto& initializer_tensor : m_model->get_graph().initializer())
+            // the initializers are accessed mutably to let the constants own their raw data
+            for (auto& initializer_tensor :
+                 *m_model->get_model_proto()->mutable_graph()->mutable_initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{initializer_tensor, m_model->get_model_proto()};
                     std::shared_ptr<default_opset::Constant> ng_constant;
                     // For each initializer create a Constant node and store it in cache
                     try
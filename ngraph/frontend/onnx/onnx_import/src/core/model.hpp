@@ -38,6 +38,14 @@ namespace ngraph
 
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
+            /// \brief Shared ownership of the model proto for constants referencing its raw data
+            ///
+            /// \note  The model is the only owner of the proto passed to it, so the constants
+            ///        may reference the initializers of the proto like their own memory.
+            const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& get_model_proto() const
+            {
+                return m_model_proto;
+            }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
             const OpsetImports& get_opset_imports() const;
             const std::string& get_producer_version() const
@@ -71,7 +79,7 @@ namespace ngraph
             void enable_opset_domain(const std::string& domain);
 
         private:
-            const std::unique_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
+            const std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -495,6 +497,22 @@ namespace ngraph
                 }
             }
 
+            /// \brief Creates a tensor whose constants reference its raw data in place instead
+            ///        of copying it.
+            ///
+            /// \param model_proto Model exclusively owning the tensor proto. The constants keep
+            ///                    it alive and may write to the raw data like to their own memory.
+            Tensor(ONNX_NAMESPACE::TensorProto& tensor,
+                   std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
+                : Tensor(static_cast<const ONNX_NAMESPACE::TensorProto&>(tensor))
+            {
+                m_model_proto = std::move(model_proto);
+                if (tensor.has_raw_data())
+                {
+                    m_raw_data = tensor.mutable_raw_data();
+                }
+            }
+
             Tensor(const Tensor&) = default;
             Tensor(Tensor&&) = default;
 
@@ -606,11 +624,58 @@ namespace ngraph
             }
 
         private:
+            template <typename T>
+            static bool is_aligned_for(const void* ptr)
+            {
+                return reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) == 0;
+            }
+
+            /// \brief Creates a constant that references the tensor data without copying:
+            ///        either a view into the memory mapped external data file or a view into
+            ///        the raw data of the model proto.
+            ///
+            /// \return Constant or nullptr if data can't be shared as is
+            template <typename T>
+            std::shared_ptr<ngraph::op::Constant>
+                make_shared_ng_constant(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    return nullptr;
+                }
+                const size_t byte_size = shape_size(m_shape) * type.size();
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    auto buffer =
+                        detail::TensorExternalData(*m_tensor_proto).load_external_data_mapped();
+                    if (buffer && buffer->size() == byte_size &&
+                        is_aligned_for<T>(buffer->get_ptr()))
+                    {
+                        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                else if (m_model_proto && m_raw_data)
+                {
+                    if (m_raw_data->size() == byte_size && is_aligned_for<T>(m_raw_data->data()))
+                    {
+                        auto owner = m_model_proto;
+                        auto buffer = std::make_shared<
+                            runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+                            &(*m_raw_data)[0], m_raw_data->size(), owner);
+                        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                return nullptr;
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                auto constant = make_shared_ng_constant<T>(type);
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -619,6 +684,8 @@ namespace ngraph
             }
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
+            std::string* m_raw_data = nullptr;
             Shape m_shape;
         };
 
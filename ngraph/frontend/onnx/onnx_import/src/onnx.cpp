@@ -19,9 +19,12 @@ namespace ngraph
         std::shared_ptr<Function> import_onnx_model(std::istream& stream,
                                                     const std::string& model_path)
         {
-            ONNX_NAMESPACE::ModelProto model_proto{onnx_common::parse_from_istream(stream)};
+            // the model proto is owned by the imported function constants that reference
+            // initializers raw data in place, so it is parsed directly into its own storage
+            std::unique_ptr<ONNX_NAMESPACE::ModelProto> model_proto{
+                new ONNX_NAMESPACE::ModelProto{onnx_common::parse_from_istream(stream)}};
 
-            return detail::import_onnx_model(model_proto, model_path);
+            return detail::import_onnx_model(std::move(model_proto), model_path);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -97,12 +97,19 @@ namespace ngraph
             std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
                                                         const std::string& model_path)
             {
-                transform::expand_onnx_functions(model_proto);
-                transform::fixup_legacy_operators(model_proto);
-                transform::update_external_data_paths(model_proto, model_path);
+                return import_onnx_model(
+                    common::make_unique<ONNX_NAMESPACE::ModelProto>(model_proto), model_path);
+            }
+
+            std::shared_ptr<Function>
+                import_onnx_model(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto,
+                                  const std::string& model_path)
+            {
+                transform::expand_onnx_functions(*model_proto);
+                transform::fixup_legacy_operators(*model_proto);
+                transform::update_external_data_paths(*model_proto, model_path);
 
-                auto p_model_proto = common::make_unique<ONNX_NAMESPACE::ModelProto>(model_proto);
-                auto model = common::make_unique<Model>(std::move(p_model_proto));
+                auto model = common::make_unique<Model>(std::move(model_proto));
                 Graph graph{std::move(model)};
                 return graph.convert();
             }
@@ -2,9 +2,24 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
@@ -16,6 +31,116 @@ namespace ngraph
     {
         namespace detail
         {
+            MappedFile::~MappedFile()
+            {
+                if (m_data == nullptr)
+                {
+                    return;
+                }
+#ifdef _WIN32
+                UnmapViewOfFile(m_data);
+#else
+                munmap(m_data, m_size);
+#endif
+            }
+
+            std::shared_ptr<MappedFile> MappedFile::get(const std::string& path)
+            {
+                static std::mutex cache_mutex;
+                static std::map<std::string, std::weak_ptr<MappedFile>> cache;
+
+                std::lock_guard<std::mutex> lock(cache_mutex);
+                // the files unmapped since the last lookup are dropped, so the cache holds only
+                // the mappings alive at the moment
+                for (auto it = cache.begin(); it != cache.end();)
+                {
+                    if (it->second.expired())
+                    {
+                        it = cache.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                const auto cached = cache.find(path);
+                if (cached != cache.end())
+                {
+                    if (auto mapped = cached->second.lock())
+                    {
+                        return mapped;
+                    }
+                }
+
+                std::shared_ptr<MappedFile> mapped{new MappedFile()};
+#ifdef _WIN32
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+                std::wstring wpath = file_util::multi_byte_char_to_wstring(path.c_str());
+                HANDLE file = CreateFileW(wpath.c_str(),
+#else
+                HANDLE file = CreateFileA(path.c_str(),
+#endif
+                                          GENERIC_READ,
+                                          FILE_SHARE_READ,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL,
+                                          nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return nullptr;
+                }
+                LARGE_INTEGER file_size;
+                if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+                {
+                    CloseHandle(file);
+                    return nullptr;
+                }
+                HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                CloseHandle(file);
+                if (mapping == nullptr)
+                {
+                    return nullptr;
+                }
+                void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                CloseHandle(mapping);
+                if (data == nullptr)
+                {
+                    return nullptr;
+                }
+                mapped->m_size = static_cast<size_t>(file_size.QuadPart);
+#else
+                const int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    return nullptr;
+                }
+                struct stat file_stat;
+                if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+                {
+                    close(fd);
+                    return nullptr;
+                }
+                // private writable mapping: pages stay shared with the page cache until
+                // someone modifies the constant data in place
+                void* data = mmap(nullptr,
+                                  static_cast<size_t>(file_stat.st_size),
+                                  PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE,
+                                  fd,
+                                  0);
+                close(fd);
+                if (data == MAP_FAILED)
+                {
+                    return nullptr;
+                }
+                mapped->m_size = static_cast<size_t>(file_stat.st_size);
+#endif
+                mapped->m_data = static_cast<char*>(data);
+                cache[path] = mapped;
+                return mapped;
+            }
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -72,6 +197,29 @@ namespace ngraph
                 return read_data;
             }
 
+            std::shared_ptr<MappedBuffer> TensorExternalData::load_external_data_mapped() const
+            {
+                auto mapped = MappedFile::get(m_data_location);
+                if (!mapped)
+                {
+                    return nullptr;
+                }
+
+                const size_t offset = static_cast<size_t>(m_offset);
+                const size_t length =
+                    m_data_length == 0 ? mapped->size() - std::min(offset, mapped->size())
+                                       : static_cast<size_t>(m_data_length);
+                if (m_offset < 0 || m_data_length < 0 || offset + length > mapped->size())
+                    throw error::invalid_external_data{*this};
+
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                return std::make_shared<MappedBuffer>(mapped->data() + offset, length, mapped);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
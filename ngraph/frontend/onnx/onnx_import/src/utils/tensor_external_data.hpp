@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
 
 namespace ngraph
 {
@@ -12,6 +16,32 @@ namespace ngraph
     {
         namespace detail
         {
+            /// \brief  Copy-on-write memory mapping of a whole external data file
+            class MappedFile
+            {
+            public:
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+                ~MappedFile();
+
+                /// \brief      Maps the file or returns the mapping already held by
+                ///             other initializers, so each file is mapped only once.
+                ///
+                /// \return     Mapping of the file or nullptr if it can't be mapped
+                static std::shared_ptr<MappedFile> get(const std::string& path);
+
+                char* data() const { return m_data; }
+                size_t size() const { return m_size; }
+
+            private:
+                MappedFile() = default;
+
+                char* m_data = nullptr;
+                size_t m_size = 0;
+            };
+
+            using MappedBuffer = runtime::SharedBuffer<std::shared_ptr<MappedFile>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -27,6 +57,15 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Provides external data as a view into the memory mapped file,
+                ///             without reading it into memory
+                ///
+                /// \note       If reading data from external files fails,
+                ///             the invalid_external_data exception is thrown.
+                ///
+                /// \return     Buffer referencing the mapping or nullptr if the file can't be mapped
+                std::shared_ptr<MappedBuffer> load_external_data_mapped() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
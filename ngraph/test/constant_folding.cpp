@@ -3430,3 +3430,75 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, incremental_skips_unchanged_nodes)
+{
+    auto input = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto scale = make_shared<op::v1::Multiply>(op::Constant::create(element::f32, Shape{2}, {1, 2}),
+                                               op::Constant::create(element::f32, Shape{2}, {3, 4}));
+    auto add = make_shared<op::v1::Add>(input, scale);
+    auto f = make_shared<Function>(add, ParameterVector{input});
+
+    pass::ConstantFolding constant_folding;
+    ASSERT_TRUE(constant_folding.run_on_function(f));
+    EXPECT_EQ(constant_folding.get_statistics().folded, 1);
+    EXPECT_EQ(constant_folding.get_statistics().skipped, 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+
+    // the new pass instance folds the same function incrementally
+    pass::ConstantFolding next_constant_folding;
+    ASSERT_FALSE(next_constant_folding.run_on_function(f));
+    const auto& statistics = next_constant_folding.get_statistics();
+    EXPECT_EQ(statistics.folded, 0);
+    EXPECT_EQ(statistics.revalidated, 0);
+    EXPECT_EQ(statistics.skipped, statistics.nodes);
+    EXPECT_EQ(statistics.nodes, f->get_ordered_ops().size());
+}
+
+TEST(constant_folding, incremental_folds_changed_inputs)
+{
+    auto input = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto relu = make_shared<op::v0::Relu>(input);
+    auto add = make_shared<op::v1::Add>(relu, op::Constant::create(element::f32, Shape{2}, {1, 2}));
+    auto convert = make_shared<op::v0::Convert>(
+        op::Constant::create(element::f32, Shape{2}, {3, 4}), element::i32);
+    convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"];
+    auto f = make_shared<Function>(OutputVector{add, convert}, ParameterVector{input});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(f), 1);
+
+    // the input of the unchanged node is replaced and the folding of another node is enabled
+    relu->output(0).replace(op::Constant::create(element::f32, Shape{2}, {5, 6})->output(0));
+    convert->get_rt_info().erase("DISABLED_CONSTANT_FOLDING");
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+    range_test_check(get_result_constant<float>(f, 0), vector<float>{6, 8});
+    range_test_check(get_result_constant<int32_t>(f, 1), vector<int32_t>{3, 4});
+}
+
+TEST(constant_folding, incremental_folds_changed_outputs)
+{
+    auto input = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto convert = make_shared<op::v0::Convert>(input, element::i32);
+    auto f = make_shared<Function>(convert, ParameterVector{input});
+
+    pass::ConstantFolding constant_folding;
+    ASSERT_FALSE(constant_folding.run_on_function(f));
+
+    // the destination type is changed in place, so the inputs of the convert are the same
+    convert->set_convert_element_type(element::f16);
+    f->validate_nodes_and_infer_types();
+
+    pass::ConstantFolding next_constant_folding;
+    ASSERT_FALSE(next_constant_folding.run_on_function(f));
+    const auto& statistics = next_constant_folding.get_statistics();
+    EXPECT_EQ(statistics.nodes, 3);
+    // only the parameter is skipped, the convert and its result are tried to be folded again
+    EXPECT_EQ(statistics.skipped, 1);
+}
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <fstream>
+
 #include "default_opset.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -89,6 +92,54 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_mapped_in_place)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO,
+        "onnx/external_data/external_data_two_tensors_data_in_the_same_file.prototxt"));
+
+    // both constants are views into the same mapping of the file at their offsets
+    std::vector<const char*> constants_data;
+    for (const auto& op : function->get_ordered_ops())
+    {
+        if (const auto constant = as_type_ptr<op::Constant>(op))
+        {
+            constants_data.push_back(constant->get_data_ptr<char>());
+        }
+    }
+    ASSERT_EQ(2u, constants_data.size());
+    std::sort(constants_data.begin(), constants_data.end());
+    EXPECT_EQ(4096, constants_data[1] - constants_data[0]);
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {3, 2, 1}, second: {1, 2, 3} read from external file
+    test_case.add_input<int32_t>({2, 3, 1});
+
+    test_case.add_expected_output<int32_t>({3, 3, 3});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_length_out_of_range_exception)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_length_out_of_range.prototxt"));
+        FAIL() << "Data beyond the end of external data file not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_PRED_FORMAT2(
+            testing::IsSubstring,
+            std::string("tensor.data, offset: 8, data_length: 16, sha1_digest: 0)"),
+            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
@@ -143,3 +194,30 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path)
 
     test_case.run();
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_initializer_raw_data_in_place)
+{
+    std::shared_ptr<Function> function;
+    {
+        const auto path =
+            file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.prototxt");
+        std::ifstream stream{path, std::ios::in | std::ios::binary};
+        ASSERT_TRUE(stream.is_open());
+        function = onnx_import::import_onnx_model(stream, path);
+    }
+
+    // the raw data initializer is referenced in the model proto kept alive by the constant only
+    for (const auto& op : function->get_ordered_ops())
+    {
+        if (const auto constant = as_type_ptr<op::Constant>(op))
+        {
+            EXPECT_EQ((std::vector<float>{1.f, 2.f, 3.f, 4.f}), constant->cast_vector<float>());
+        }
+    }
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {3.f, 6.f, 9.f, 12.f});
+
+    test_case.run();
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/stable_vector.hpp"
+
+using namespace ngraph;
+
+TEST(stable_vector, references_survive_growth)
+{
+    StableVector<std::string> v;
+    auto& first = v.emplace_back("first");
+    const std::string* first_ptr = &first;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        v.emplace_back(std::to_string(i));
+    }
+    ASSERT_EQ(v.size(), 1001);
+    EXPECT_EQ(first_ptr, &v[0]);
+    EXPECT_EQ(v.at(0), "first");
+    EXPECT_EQ(v.back(), "999");
+}
+
+TEST(stable_vector, inline_references_survive_growth)
+{
+    StableVector<std::string, 2> v;
+    const std::string* first_ptr = &v.emplace_back("first");
+    const std::string* second_ptr = &v.emplace_back("second");
+    // the inline elements are stored in the container itself
+    EXPECT_GE(reinterpret_cast<const char*>(first_ptr), reinterpret_cast<const char*>(&v));
+    EXPECT_LT(reinterpret_cast<const char*>(second_ptr),
+              reinterpret_cast<const char*>(&v) + sizeof(v));
+
+    const std::string* third_ptr = &v.emplace_back("third");
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        v.emplace_back(std::to_string(i));
+    }
+    ASSERT_EQ(v.size(), 1003);
+    EXPECT_EQ(first_ptr, &v[0]);
+    EXPECT_EQ(second_ptr, &v[1]);
+    EXPECT_EQ(third_ptr, &v[2]);
+    EXPECT_EQ(v.at(1), "second");
+    EXPECT_EQ(v.back(), "999");
+
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    v.emplace_back("again");
+    EXPECT_EQ(v.at(0), "again");
+}
+
+TEST(stable_vector, move_keeps_allocated_elements)
+{
+    StableVector<std::string, 1> v;
+    v.emplace_back("inline");
+    const std::string* allocated_ptr = &v.emplace_back("allocated");
+
+    StableVector<std::string, 1> moved(std::move(v));
+    EXPECT_TRUE(v.empty());
+    ASSERT_EQ(moved.size(), 2);
+    EXPECT_EQ(moved[0], "inline");
+    EXPECT_EQ(allocated_ptr, &moved[1]);
+
+    v = std::move(moved);
+    ASSERT_EQ(v.size(), 2);
+    EXPECT_EQ(v[0], "inline");
+    EXPECT_EQ(allocated_ptr, &v[1]);
+}
+
+TEST(stable_vector, copy_is_deep)
+{
+    StableVector<std::vector<int>, 1> v;
+    v.emplace_back(3, 1);
+    v.emplace_back(2, 2);
+
+    StableVector<std::vector<int>, 1> copy(v);
+    ASSERT_EQ(copy.size(), v.size());
+    EXPECT_NE(&copy[0], &v[0]);
+    EXPECT_EQ(copy[0], v[0]);
+
+    copy[1].push_back(5);
+    EXPECT_EQ(v[1].size(), 2);
+
+    v = copy;
+    EXPECT_EQ(v[1].size(), 3);
+}
+
+TEST(stable_vector, iteration_and_range_check)
+{
+    StableVector<int, 2> v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_THROW(v.at(0), std::out_of_range);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        v.emplace_back(i);
+    }
+    int expected = 0;
+    for (auto& value : v)
+    {
+        EXPECT_EQ(value, expected++);
+        value *= 2;
+    }
+    const auto& cv = v;
+    EXPECT_EQ(cv.end() - cv.begin(), 5);
+    EXPECT_EQ(*(cv.begin() + 4), 8);
+    EXPECT_THROW(v.at(5), std::out_of_range);
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <iostream>
+
+#include "common.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    {
+      SCOPED_TIMER(available_devices);
+      Core ie;
+      ie.SetConfig({{CONFIG_KEY(AVAILABLE_DEVICES_CACHE_TTL), "60"}});
+      {
+        SCOPED_TIMER(probe_devices);
+        ie.GetAvailableDevices();
+      }
+      {
+        SCOPED_TIMER(cached_devices);
+        ie.GetAvailableDevices();
+      }
+    }
+    {
+      SCOPED_TIMER(lazy_discovery);
+      Core ie;
+      ie.SetConfig({{CONFIG_KEY(LAZY_DEVICE_DISCOVERY), CONFIG_VALUE(YES)}});
+      {
+        SCOPED_TIMER(load_plugin);
+        ie.GetVersions(device);
+      }
+      {
+        SCOPED_TIMER(probe_devices);
+        ie.GetAvailableDevices();
+      }
+      {
+        SCOPED_TIMER(load_network);
+        ie.LoadNetwork(model, device);
+      }
+    }
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}